@@ -155,6 +155,21 @@ static inline int mbox_try_get(mbox_t *mbox, msg_t *msg)
     return _mbox_get(mbox, msg, NON_BLOCKING);
 }
 
+/**
+ * @brief Get up to @p max messages from mailbox at once
+ *
+ * All available messages (up to @p max) are retrieved with interrupts
+ * disabled only once. If the mailbox is empty, this function will block until
+ * a message becomes available.
+ *
+ * @param[in] mbox  ptr to mailbox to operate on
+ * @param[out] buf  storage for at least @p max retrieved messages
+ * @param[in] max   maximum number of messages to retrieve, must be > 0
+ *
+ * @return  number of retrieved messages, always > 0
+ */
+unsigned mbox_get_bulk(mbox_t *mbox, msg_t *buf, unsigned max);
+
 #ifdef __cplusplus
 }
 #endif
@@ -147,6 +147,18 @@
  * }
  * ~~~~~~~~~~~~~~~~~~~~~~~~
  *
+ * Lock-free message queue
+ * -----------------------
+ * With the `core_msg_lockfree` module, messages are put into and taken from a
+ * message queue using atomic compare-and-swap instead of disabling
+ * interrupts, as long as the receiver is not blocked waiting for a message and
+ * no sender is blocked on a full queue. All other cases are still handled with
+ * interrupts disabled, so the semantics of the API do not change. Messages of
+ * different senders that race for the queue may be received in a different
+ * order than they were sent, messages of a single sender keep their order.
+ * CPUs without native compare-and-swap fall back to the emulation in
+ * `atomic_c11.c`, which disables interrupts for the swap only.
+ *
  * Timing & messages
  * =================
  * Timing out the reception of a message or sending messages at a certain time
@@ -309,6 +321,25 @@ int msg_receive(msg_t *m);
  */
 int msg_try_receive(msg_t *m);
 
+/**
+ * @brief Receive up to @p max messages at once.
+ *
+ * Takes as many queued messages as available (up to @p max) from the message
+ * queue of the calling thread with interrupts disabled only once. If no
+ * message is queued, this function blocks until a single message was
+ * received, just like @ref msg_receive().
+ *
+ * Messages are stored in @p buf in the order they would have been received
+ * by calling @ref msg_receive() repeatedly.
+ *
+ * @param[out] buf  Preallocated array of at least @p max ``msg_t``
+ *                  structures, must not be NULL.
+ * @param[in] max   Maximum number of messages to receive, must be > 0.
+ *
+ * @return  Number of messages received, always > 0.
+ */
+unsigned msg_receive_bulk(msg_t *buf, unsigned max);
+
 /**
  * @brief Send a message, block until reply received.
  *
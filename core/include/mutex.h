@@ -11,6 +11,19 @@
  * @defgroup    core_sync_mutex Mutex
  * @ingroup     core_sync
  * @brief       Mutex for thread synchronization
+ *
+ * Priority inheritance
+ * ====================
+ * With the `core_mutex_priority_inheritance` module, a thread that blocks on
+ * a mutex lends its priority to the owner of the mutex until the owner
+ * unlocks it, if the owner's priority is lower. This bounds the time a high
+ * priority thread waits for a mutex held by a low priority thread to the
+ * time the low priority thread holds the mutex, independent of threads with
+ * priorities in between. When unlocking a mutex, the owner keeps the highest
+ * priority of the threads still waiting for any other mutex it holds, or gets
+ * back its own priority if there are none, so mutexes may be unlocked in any
+ * order. Priorities are not inherited transitively (if the owner itself waits
+ * for another mutex).
  * @{
  *
  * @file
@@ -23,7 +36,9 @@
 #define MUTEX_H
 
 #include <stddef.h>
+#include <stdint.h>
 
+#include "kernel_types.h"
 #include "list.h"
 
 #ifdef __cplusplus
@@ -40,18 +55,35 @@ typedef struct {
      * @internal
      */
     list_node_t queue;
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    /**
+     * @brief   The current owner of the mutex or KERNEL_PID_UNDEF
+     * @internal
+     */
+    kernel_pid_t owner;
+    /**
+     * @brief   Entry in the list of mutexes held by the owner
+     * @internal
+     */
+    list_node_t owner_entry;
+#endif
 } mutex_t;
 
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
 /**
  * @brief Static initializer for mutex_t.
  * @details This initializer is preferable to mutex_init().
  */
-#define MUTEX_INIT { { NULL } }
+#define MUTEX_INIT { { NULL }, KERNEL_PID_UNDEF, { NULL } }
 
 /**
  * @brief Static initializer for mutex_t with a locked mutex
  */
+#define MUTEX_INIT_LOCKED { { MUTEX_LOCKED }, KERNEL_PID_UNDEF, { NULL } }
+#else
+#define MUTEX_INIT { { NULL } }
 #define MUTEX_INIT_LOCKED { { MUTEX_LOCKED } }
+#endif
 
 /**
  * @cond INTERNAL
@@ -156,6 +156,36 @@ int ringbuffer_peek_one(const ringbuffer_t *__restrict rb);
  */
 unsigned ringbuffer_peek(const ringbuffer_t *__restrict rb, char *buf, unsigned n);
 
+/**
+ * @brief           Get the largest contiguous free region behind the newest element.
+ * @details         Elements can be written directly into the region, e.g. by DMA,
+ *                  and have to be made available for reading with ringbuffer_commit().
+ *                  No other function adding elements may be called in between.
+ * @param[in,out]   rb       Ringbuffer to operate on.
+ * @param[out]      region   Start of the free region.
+ * @returns         Number of elements that fit in @p region. 0 iff rb is full.
+ */
+unsigned ringbuffer_reserve(ringbuffer_t *__restrict rb, char **region);
+
+/**
+ * @brief           Make elements written to a region obtained by ringbuffer_reserve()
+ *                  available for reading.
+ * @param[in,out]   rb    Ringbuffer to operate on.
+ * @param[in]       n     Number of elements written, at most the size of the region.
+ */
+void ringbuffer_commit(ringbuffer_t *__restrict rb, unsigned n);
+
+/**
+ * @brief           Get the largest contiguous region of the oldest elements,
+ *                  without removing them.
+ * @details         The elements can be read or parsed in place and are removed with
+ *                  ringbuffer_remove() afterwards.
+ * @param[in]       rb       Ringbuffer to operate on.
+ * @param[out]      region   Start of the region.
+ * @returns         Number of elements in @p region. 0 iff rb is empty.
+ */
+unsigned ringbuffer_peek_region(const ringbuffer_t *__restrict rb, char **region);
+
 #ifdef __cplusplus
 }
 #endif
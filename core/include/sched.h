@@ -148,6 +148,19 @@ int sched_run(void);
  */
 void sched_set_status(thread_t *process, thread_status_t status);
 
+/**
+ * @brief   Change the priority of the specified thread
+ *
+ * A thread on the runqueue is moved to the end of the runqueue of its new
+ * priority. This function does not yield, so the caller has to trigger the
+ * scheduler if the change requires a different thread to run.
+ *
+ * @param[in]   thread      Pointer to the thread control block of the
+ *                          targeted thread
+ * @param[in]   priority    The new priority of the thread
+ */
+void sched_change_priority(thread_t *thread, uint8_t priority);
+
 /**
  * @brief       Yield if approriate.
  *
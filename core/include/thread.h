@@ -168,6 +168,10 @@ struct _thread {
     msg_t *msg_array;               /**< memory holding messages sent
                                          to this thread's message queue */
 #endif
+#if defined(MODULE_CORE_MUTEX_PRIORITY_INHERITANCE) || defined(DOXYGEN)
+    list_node_t mutexes_held;       /**< mutexes owned by this thread   */
+    uint8_t base_priority;          /**< priority without inherited ones */
+#endif
 #if defined(DEVELHELP) || defined(SCHED_TEST_STACK) \
     || defined(MODULE_MPU_STACK_GUARD) || defined(DOXYGEN)
     char *stack_start;              /**< thread's stack start address   */
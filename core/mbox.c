@@ -18,6 +18,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <string.h>
 
 #include "mbox.h"
@@ -120,3 +121,40 @@ int _mbox_get(mbox_t *mbox, msg_t *msg, int blocking)
         return 0;
     }
 }
+
+unsigned mbox_get_bulk(mbox_t *mbox, msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    unsigned irqstate = irq_disable();
+    unsigned n = 0;
+
+    while ((n < max) && cib_avail(&mbox->cib)) {
+        /* copy msg from queue */
+        buf[n++] = mbox->msg_array[cib_get_unsafe(&mbox->cib)];
+    }
+    if (n == 0) {
+        sched_active_thread->wait_data = (void*)buf;
+        _wait(&mbox->readers, irqstate);
+        /* sender has copied message */
+        return 1;
+    }
+
+    DEBUG("mbox: Thread %"PRIkernel_pid" mbox 0x%08x: mbox_get_bulk(): "
+            "got %u queued messages.\n", sched_active_pid, (unsigned)mbox, n);
+    /* wake up one blocked writer per freed slot, but switch only once */
+    uint16_t process_priority = THREAD_PRIORITY_IDLE;
+    list_node_t *next;
+    for (unsigned i = 0; (i < n) && (next = list_remove_head(&mbox->writers)); i++) {
+        thread_t *thread = container_of((clist_node_t*)next, thread_t, rq_entry);
+        sched_set_status(thread, STATUS_PENDING);
+        if (thread->priority < process_priority) {
+            process_priority = thread->priority;
+        }
+    }
+    irq_restore(irqstate);
+    if (process_priority < THREAD_PRIORITY_IDLE) {
+        sched_switch(process_priority);
+    }
+    return n;
+}
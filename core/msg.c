@@ -32,6 +32,9 @@
 #endif
 #include "irq.h"
 #include "cib.h"
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
@@ -39,24 +42,160 @@
 static int _msg_receive(msg_t *m, int block);
 static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned state);
 
-static int queue_msg(thread_t *target, const msg_t *m)
+#ifdef MODULE_SCHED_TRACE
+static inline void _trace_send(const msg_t *m, kernel_pid_t from, kernel_pid_t to)
+{
+    sched_trace_record(SCHED_TRACE_MSG_SEND, 0, from, to, m->type);
+}
+
+static inline void _trace_recv(const msg_t *m, unsigned numof)
+{
+    for (unsigned i = 0; i < numof; i++) {
+        sched_trace_record(SCHED_TRACE_MSG_RECV, 0, sched_active_pid,
+                           m[i].sender_pid, m[i].type);
+    }
+}
+#else
+#define _trace_send(m, from, to)
+#define _trace_recv(m, numof)
+#endif
+
+#ifdef MODULE_CORE_MSG_LOCKFREE
+/*
+ * Producers claim a slot by advancing write_count with compare-and-swap and
+ * publish it by setting its sender_pid last. The (single) receiver only takes
+ * the slot at read_count once it is published, so a producer preempted while
+ * filling its slot holds back the queue, but never exposes a partial message.
+ * Free slots have their sender_pid set to KERNEL_PID_UNDEF.
+ */
+static int _queue_put(thread_t *target, const msg_t *m)
+{
+    cib_t *cib = &target->msg_queue;
+    unsigned write = __atomic_load_n(&cib->write_count, __ATOMIC_RELAXED);
+
+    do {
+        /* mask is UINT_MAX for threads without queue, so they are always full */
+        if ((int)(write - __atomic_load_n(&cib->read_count, __ATOMIC_ACQUIRE))
+            > (int)cib->mask) {
+            return 0;
+        }
+    } while (!__atomic_compare_exchange_n(&cib->write_count, &write, write + 1,
+                                          false, __ATOMIC_SEQ_CST,
+                                          __ATOMIC_RELAXED));
+
+    msg_t *dest = &target->msg_array[write & cib->mask];
+    dest->type = m->type;
+    dest->content = m->content;
+    __atomic_store_n(&dest->sender_pid, m->sender_pid, __ATOMIC_SEQ_CST);
+    return 1;
+}
+
+static int _queue_get(thread_t *me, msg_t *m)
+{
+    cib_t *cib = &me->msg_queue;
+    unsigned read = __atomic_load_n(&cib->read_count, __ATOMIC_RELAXED);
+
+    if (read == __atomic_load_n(&cib->write_count, __ATOMIC_SEQ_CST)) {
+        return 0;
+    }
+
+    msg_t *src = &me->msg_array[read & cib->mask];
+    kernel_pid_t sender_pid = __atomic_load_n(&src->sender_pid,
+                                              __ATOMIC_SEQ_CST);
+    if (sender_pid == KERNEL_PID_UNDEF) {
+        /* claimed, but still being written */
+        return 0;
+    }
+    m->sender_pid = sender_pid;
+    m->type = src->type;
+    m->content = src->content;
+    __atomic_store_n(&src->sender_pid, KERNEL_PID_UNDEF, __ATOMIC_RELAXED);
+    __atomic_store_n(&cib->read_count, read + 1, __ATOMIC_SEQ_CST);
+    return 1;
+}
+
+/*
+ * The receiver may have gone RECEIVE_BLOCKED while we were filling our slot
+ * (it preempted us and found the queue head unpublished). Hand it the queue
+ * head in that case. Returns 1 if the receiver was woken up.
+ */
+static int _queue_deliver(thread_t *target)
+{
+    int res = 0;
+    unsigned state = irq_disable();
+
+    if ((target->status == STATUS_RECEIVE_BLOCKED) &&
+        _queue_get(target, (msg_t *)target->wait_data)) {
+        sched_set_status(target, STATUS_PENDING);
+        res = 1;
+    }
+    irq_restore(state);
+    return res;
+}
+#else /* MODULE_CORE_MSG_LOCKFREE */
+/* must be called with interrupts disabled */
+static int _queue_put(thread_t *target, const msg_t *m)
 {
     int n = cib_put(&(target->msg_queue));
+
+    if (n < 0) {
+        return 0;
+    }
+    target->msg_array[n] = *m;
+    return 1;
+}
+
+/* must be called with interrupts disabled */
+static int _queue_get(thread_t *me, msg_t *m)
+{
+    int n = cib_get(&(me->msg_queue));
+
     if (n < 0) {
+        return 0;
+    }
+    *m = me->msg_array[n];
+    return 1;
+}
+#endif /* MODULE_CORE_MSG_LOCKFREE */
+
+static int queue_msg(thread_t *target, const msg_t *m)
+{
+    if (!_queue_put(target, m)) {
         DEBUG("queue_msg(): message queue is full (or there is none)\n");
         return 0;
     }
 
     DEBUG("queue_msg(): queuing message\n");
-    msg_t *dest = &target->msg_array[n];
-    *dest = *m;
 #if MODULE_CORE_THREAD_FLAGS
+    unsigned state = irq_disable();
     target->flags |= THREAD_FLAG_MSG_WAITING;
     thread_flags_wake(target);
+    irq_restore(state);
 #endif
     return 1;
 }
 
+#ifdef MODULE_CORE_MSG_LOCKFREE
+/* queues m without disabling interrupts if the target is not waiting for it,
+ * returns 0 if the locked path has to take care of the message */
+static int _msg_send_queued(msg_t *m, kernel_pid_t target_pid)
+{
+    thread_t *target = (thread_t *) sched_threads[target_pid];
+
+    if ((target == NULL) || (target->status == STATUS_RECEIVE_BLOCKED)) {
+        return 0;
+    }
+    m->sender_pid = sched_active_pid;
+    if (!queue_msg(target, m)) {
+        return 0;
+    }
+    if (_queue_deliver(target)) {
+        thread_yield_higher();
+    }
+    return 1;
+}
+#endif
+
 int msg_send(msg_t *m, kernel_pid_t target_pid)
 {
     if (irq_is_in()) {
@@ -65,6 +204,12 @@ int msg_send(msg_t *m, kernel_pid_t target_pid)
     if (sched_active_pid == target_pid) {
         return msg_send_to_self(m);
     }
+    _trace_send(m, sched_active_pid, target_pid);
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    if (_msg_send_queued(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, true, irq_disable());
 }
 
@@ -76,6 +221,12 @@ int msg_try_send(msg_t *m, kernel_pid_t target_pid)
     if (sched_active_pid == target_pid) {
         return msg_send_to_self(m);
     }
+    _trace_send(m, sched_active_pid, target_pid);
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    if (_msg_send_queued(m, target_pid)) {
+        return 1;
+    }
+#endif
     return _msg_send(m, target_pid, false, irq_disable());
 }
 
@@ -173,6 +324,11 @@ static int _msg_send(msg_t *m, kernel_pid_t target_pid, bool block, unsigned sta
 
 int msg_send_to_self(msg_t *m)
 {
+    _trace_send(m, sched_active_pid, sched_active_pid);
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    m->sender_pid = sched_active_pid;
+    return queue_msg((thread_t *) sched_active_thread, m);
+#else
     unsigned state = irq_disable();
 
     m->sender_pid = sched_active_pid;
@@ -180,6 +336,7 @@ int msg_send_to_self(msg_t *m)
 
     irq_restore(state);
     return res;
+#endif
 }
 
 int msg_send_int(msg_t *m, kernel_pid_t target_pid)
@@ -198,6 +355,7 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
 
     m->sender_pid = KERNEL_PID_ISR;
+    _trace_send(m, KERNEL_PID_ISR, target_pid);
     if (target->status == STATUS_RECEIVE_BLOCKED) {
         DEBUG("msg_send_int: Direct msg copy from %" PRIkernel_pid " to %"
               PRIkernel_pid ".\n", thread_getpid(), target_pid);
@@ -213,13 +371,24 @@ int msg_send_int(msg_t *m, kernel_pid_t target_pid)
     }
     else {
         DEBUG("msg_send_int: Receiver not waiting.\n");
+#ifdef MODULE_CORE_MSG_LOCKFREE
+        if (!queue_msg(target, m)) {
+            return 0;
+        }
+        if (_queue_deliver(target)) {
+            sched_context_switch_request = 1;
+        }
+        return 1;
+#else
         return (queue_msg(target, m));
+#endif
     }
 }
 
 int msg_send_receive(msg_t *m, msg_t *reply, kernel_pid_t target_pid)
 {
     assert(sched_active_pid != target_pid);
+    _trace_send(m, sched_active_pid, target_pid);
     unsigned state = irq_disable();
     thread_t *me = (thread_t*) sched_threads[sched_active_pid];
     sched_set_status(me, STATUS_REPLY_BLOCKED);
@@ -248,6 +417,7 @@ int msg_reply(msg_t *m, msg_t *reply)
 
     DEBUG("msg_reply(): %" PRIkernel_pid ": Direct msg copy.\n",
           sched_active_thread->pid);
+    _trace_send(reply, sched_active_pid, target->pid);
     /* copy msg to target */
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
@@ -269,6 +439,7 @@ int msg_reply_int(msg_t *m, msg_t *reply)
         return -1;
     }
 
+    _trace_send(reply, KERNEL_PID_ISR, target->pid);
     msg_t *target_message = (msg_t*) target->wait_data;
     *target_message = *reply;
     sched_set_status(target, STATUS_PENDING);
@@ -278,38 +449,103 @@ int msg_reply_int(msg_t *m, msg_t *reply)
 
 int msg_try_receive(msg_t *m)
 {
-    return _msg_receive(m, 0);
+    int res = _msg_receive(m, 0);
+
+    if (res == 1) {
+        _trace_recv(m, 1);
+    }
+    return res;
 }
 
 int msg_receive(msg_t *m)
 {
-    return _msg_receive(m, 1);
+    int res = _msg_receive(m, 1);
+
+    _trace_recv(m, 1);
+    return res;
+}
+
+unsigned msg_receive_bulk(msg_t *buf, unsigned max)
+{
+    assert(max > 0);
+
+    thread_t *me = (thread_t *) sched_active_thread;
+    unsigned n = 0;
+
+    if (thread_has_msg_queue(me)) {
+        unsigned state = irq_disable();
+
+        while ((n < max) && _queue_get(me, &buf[n])) {
+            n++;
+        }
+        if (n > 0) {
+            uint16_t sender_prio = THREAD_PRIORITY_IDLE;
+
+            /* take the messages of blocked senders into the just freed
+             * queue space */
+            for (unsigned i = 0; (i < n) && (me->msg_waiters.next != NULL); i++) {
+                list_node_t *next = list_remove_head(&me->msg_waiters);
+                thread_t *sender = container_of((clist_node_t *)next, thread_t,
+                                                rq_entry);
+
+                _queue_put(me, (msg_t *)sender->wait_data);
+                if (sender->status != STATUS_REPLY_BLOCKED) {
+                    sender->wait_data = NULL;
+                    sched_set_status(sender, STATUS_PENDING);
+                    if (sender->priority < sender_prio) {
+                        sender_prio = sender->priority;
+                    }
+                }
+            }
+            irq_restore(state);
+            if (sender_prio < THREAD_PRIORITY_IDLE) {
+                sched_switch(sender_prio);
+            }
+            DEBUG("msg_receive_bulk: %" PRIkernel_pid ": got %u queued messages.\n",
+                  sched_active_thread->pid, n);
+            _trace_recv(buf, n);
+            return n;
+        }
+        irq_restore(state);
+    }
+    /* nothing queued, so wait for a single message */
+    _msg_receive(buf, 1);
+    _trace_recv(buf, 1);
+    return 1;
 }
 
 static int _msg_receive(msg_t *m, int block)
 {
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    thread_t *self = (thread_t *) sched_active_thread;
+
+    /* blocked senders are only taken over with interrupts disabled */
+    if ((self->msg_waiters.next == NULL) && thread_has_msg_queue(self) &&
+        _queue_get(self, m)) {
+        return 1;
+    }
+#endif
     unsigned state = irq_disable();
     DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive.\n",
           sched_active_thread->pid);
 
     thread_t *me = (thread_t*) sched_threads[sched_active_pid];
 
-    int queue_index = -1;
+    int queued = 0;
 
     if (thread_has_msg_queue(me)) {
-        queue_index = cib_get(&(me->msg_queue));
+        queued = _queue_get(me, m);
     }
 
     /* no message, fail */
-    if ((!block) && ((!me->msg_waiters.next) && (queue_index == -1))) {
+    if ((!block) && ((!me->msg_waiters.next) && (!queued))) {
         irq_restore(state);
         return -1;
     }
 
-    if (queue_index >= 0) {
+    if (queued) {
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): We've got a queued message.\n",
               sched_active_thread->pid);
-        *m = me->msg_array[queue_index];
     }
     else {
         me->wait_data = (void *) m;
@@ -321,7 +557,7 @@ static int _msg_receive(msg_t *m, int block)
         DEBUG("_msg_receive: %" PRIkernel_pid ": _msg_receive(): No thread in waiting list.\n",
               sched_active_thread->pid);
 
-        if (queue_index < 0) {
+        if (!queued) {
             DEBUG("_msg_receive(): %" PRIkernel_pid ": No msg in queue. Going blocked.\n",
                   sched_active_thread->pid);
             sched_set_status(me, STATUS_RECEIVE_BLOCKED);
@@ -344,16 +580,18 @@ static int _msg_receive(msg_t *m, int block)
 
         thread_t *sender = container_of((clist_node_t*)next, thread_t, rq_entry);
 
-        if (queue_index >= 0) {
+        /* copy msg */
+        msg_t *sender_msg = (msg_t*) sender->wait_data;
+
+        if (queued) {
             /* We've already got a message from the queue. As there is a
              * waiter, take it's message into the just freed queue space.
              */
-            m = &(me->msg_array[cib_put(&(me->msg_queue))]);
+            _queue_put(me, sender_msg);
+        }
+        else {
+            *m = *sender_msg;
         }
-
-        /* copy msg */
-        msg_t *sender_msg = (msg_t*) sender->wait_data;
-        *m = *sender_msg;
 
         /* remove sender from queue */
         uint16_t sender_prio = THREAD_PRIORITY_IDLE;
@@ -383,7 +621,23 @@ int msg_avail(void)
     int queue_index = -1;
 
     if (thread_has_msg_queue(me)) {
+#ifdef MODULE_CORE_MSG_LOCKFREE
+        cib_t *cib = &me->msg_queue;
+        unsigned read = __atomic_load_n(&cib->read_count, __ATOMIC_RELAXED);
+        unsigned write = __atomic_load_n(&cib->write_count, __ATOMIC_SEQ_CST);
+
+        /* only published slots can be received, and only up to the first
+         * slot that is still being written */
+        queue_index = 0;
+        while ((read != write) &&
+               (__atomic_load_n(&me->msg_array[read & cib->mask].sender_pid,
+                                __ATOMIC_SEQ_CST) != KERNEL_PID_UNDEF)) {
+            queue_index++;
+            read++;
+        }
+#else
         queue_index = cib_avail(&(me->msg_queue));
+#endif
     }
 
     return queue_index;
@@ -392,6 +646,12 @@ int msg_avail(void)
 void msg_init_queue(msg_t *array, int num)
 {
     thread_t *me = (thread_t*) sched_active_thread;
+#ifdef MODULE_CORE_MSG_LOCKFREE
+    /* an unset sender marks a free slot */
+    for (int i = 0; i < num; i++) {
+        array[i].sender_pid = KERNEL_PID_UNDEF;
+    }
+#endif
     me->msg_array = array;
     cib_init(&(me->msg_queue), num);
 }
@@ -32,6 +32,80 @@
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+static inline void _set_owner(mutex_t *mutex, thread_t *owner)
+{
+    if (owner == NULL) {
+        mutex->owner = KERNEL_PID_UNDEF;
+        return;
+    }
+    mutex->owner = owner->pid;
+    list_add(&owner->mutexes_held, &mutex->owner_entry);
+}
+
+/* waiters are sorted by priority when queued, but may have inherited a
+ * higher priority since, so all of them are checked */
+static uint8_t _waiters_priority(mutex_t *mutex, uint8_t priority)
+{
+    if (mutex->queue.next == MUTEX_LOCKED) {
+        return priority;
+    }
+    for (list_node_t *node = mutex->queue.next; node; node = node->next) {
+        thread_t *waiter = container_of((clist_node_t *)node, thread_t,
+                                        rq_entry);
+
+        if (waiter->priority < priority) {
+            priority = waiter->priority;
+        }
+    }
+    return priority;
+}
+
+/* returns 1 if the priority of the owner was lowered */
+static inline int _release_owner(mutex_t *mutex)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    mutex->owner = KERNEL_PID_UNDEF;
+    if (owner == NULL) {
+        return 0;
+    }
+    list_remove(&owner->mutexes_held, &mutex->owner_entry);
+
+    /* the owner keeps the priorities inherited through the mutexes it still
+     * holds, independent of the order they were locked in */
+    uint8_t priority = owner->base_priority;
+
+    for (list_node_t *node = owner->mutexes_held.next; node;
+         node = node->next) {
+        priority = _waiters_priority(container_of(node, mutex_t, owner_entry),
+                                     priority);
+    }
+    if (owner->priority != priority) {
+        DEBUG("mutex: thread %" PRIkernel_pid " continues with priority %"
+              PRIu8 "\n", owner->pid, priority);
+        sched_change_priority(owner, priority);
+        return 1;
+    }
+    return 0;
+}
+
+static inline void _inherit_priority(mutex_t *mutex, thread_t *me)
+{
+    thread_t *owner = (thread_t *)thread_get(mutex->owner);
+
+    if ((owner != NULL) && (owner->priority > me->priority)) {
+        DEBUG("mutex: thread %" PRIkernel_pid " inherits priority %" PRIu8
+              "\n", owner->pid, me->priority);
+        sched_change_priority(owner, me->priority);
+    }
+}
+#else
+#define _set_owner(mutex, owner)        (void)(mutex)
+#define _release_owner(mutex)           ((void)(mutex), 0)
+#define _inherit_priority(mutex, me)    (void)(mutex)
+#endif
+
 int _mutex_lock(mutex_t *mutex, int blocking)
 {
     unsigned irqstate = irq_disable();
@@ -41,6 +115,9 @@ int _mutex_lock(mutex_t *mutex, int blocking)
     if (mutex->queue.next == NULL) {
         /* mutex is unlocked. */
         mutex->queue.next = MUTEX_LOCKED;
+        /* there is no owner to boost when locked from an ISR or before the
+         * scheduler was started */
+        _set_owner(mutex, irq_is_in() ? NULL : (thread_t *)sched_active_thread);
         DEBUG("PID[%" PRIkernel_pid "]: mutex_wait early out.\n",
               sched_active_pid);
         irq_restore(irqstate);
@@ -58,6 +135,7 @@ int _mutex_lock(mutex_t *mutex, int blocking)
         else {
             thread_add_to_list(&mutex->queue, me);
         }
+        _inherit_priority(mutex, me);
         irq_restore(irqstate);
         thread_yield_higher();
         /* We were woken up by scheduler. Waker removed us from queue.
@@ -83,10 +161,16 @@ void mutex_unlock(mutex_t *mutex)
         return;
     }
 
+    int lowered = _release_owner(mutex);
+
     if (mutex->queue.next == MUTEX_LOCKED) {
         mutex->queue.next = NULL;
         /* the mutex was locked and no thread was waiting for it */
         irq_restore(irqstate);
+        /* a waiter that gave up may have lent its priority */
+        if (lowered) {
+            thread_yield_higher();
+        }
         return;
     }
 
@@ -94,6 +178,9 @@ void mutex_unlock(mutex_t *mutex)
 
     thread_t *process = container_of((clist_node_t*)next, thread_t, rq_entry);
 
+    /* the woken up thread owns the mutex now */
+    _set_owner(mutex, process);
+
     DEBUG("mutex_unlock: waking up waiting thread %" PRIkernel_pid "\n",
           process->pid);
     sched_set_status(process, STATUS_PENDING);
@@ -114,6 +201,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
     unsigned irqstate = irq_disable();
 
     if (mutex->queue.next) {
+        (void)_release_owner(mutex);
         if (mutex->queue.next == MUTEX_LOCKED) {
             mutex->queue.next = NULL;
         }
@@ -122,6 +210,7 @@ void mutex_unlock_and_sleep(mutex_t *mutex)
             thread_t *process = container_of((clist_node_t*)next, thread_t,
                                              rq_entry);
             DEBUG("PID[%" PRIkernel_pid "]: waking up waiter.\n", process->pid);
+            _set_owner(mutex, process);
             sched_set_status(process, STATUS_PENDING);
             if (!mutex->queue.next) {
                 mutex->queue.next = MUTEX_LOCKED;
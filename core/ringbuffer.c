@@ -20,6 +20,8 @@
 
 #include <string.h>
 
+#include "assert.h"
+
 /**
  * @brief           Add an element to the end of the ringbuffer.
  * @details         This helper function does not check the pre-requirements for adding,
@@ -54,14 +56,27 @@ static char get_head(ringbuffer_t *restrict rb)
 
 unsigned ringbuffer_add(ringbuffer_t *restrict rb, const char *buf, unsigned n)
 {
-    unsigned i;
-    for (i = 0; i < n; i++) {
-        if (ringbuffer_full(rb)) {
-            break;
+    unsigned free = ringbuffer_get_free(rb);
+
+    if (n > free) {
+        n = free;
+    }
+    if (n > 0) {
+        unsigned pos = rb->start + rb->avail;
+        if (pos >= rb->size) {
+            pos -= rb->size;
         }
-        add_tail(rb, buf[i]);
+        unsigned bytes_till_end = rb->size - pos;
+        if (bytes_till_end >= n) {
+            memcpy(rb->buf + pos, buf, n);
+        }
+        else {
+            memcpy(rb->buf + pos, buf, bytes_till_end);
+            memcpy(rb->buf, buf + bytes_till_end, n - bytes_till_end);
+        }
+        rb->avail += n;
     }
-    return i;
+    return n;
 }
 
 int ringbuffer_add_one(ringbuffer_t *restrict rb, char c)
@@ -121,7 +136,7 @@ unsigned ringbuffer_remove(ringbuffer_t *restrict rb, unsigned n)
         rb->avail -= n;
 
         /* compensate underflow */
-        if (rb->start > rb->size) {
+        if (rb->start >= rb->size) {
             rb->start -= rb->size;
         }
     }
@@ -140,3 +155,36 @@ unsigned ringbuffer_peek(const ringbuffer_t *restrict rb_, char *buf, unsigned n
     ringbuffer_t rb = *rb_;
     return ringbuffer_get(&rb, buf, n);
 }
+
+unsigned ringbuffer_reserve(ringbuffer_t *restrict rb, char **region)
+{
+    unsigned pos;
+
+    if (rb->avail == 0) {
+        /* nothing to preserve, so offer the whole buffer */
+        rb->start = 0;
+    }
+    pos = rb->start + rb->avail;
+    if (pos >= rb->size) {
+        /* free space ends at the oldest element */
+        pos -= rb->size;
+        *region = rb->buf + pos;
+        return rb->start - pos;
+    }
+    *region = rb->buf + pos;
+    return rb->size - pos;
+}
+
+void ringbuffer_commit(ringbuffer_t *restrict rb, unsigned n)
+{
+    assert(n <= ringbuffer_get_free(rb));
+    rb->avail += n;
+}
+
+unsigned ringbuffer_peek_region(const ringbuffer_t *restrict rb, char **region)
+{
+    unsigned bytes_till_end = rb->size - rb->start;
+
+    *region = rb->buf + rb->start;
+    return (rb->avail < bytes_till_end) ? rb->avail : bytes_till_end;
+}
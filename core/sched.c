@@ -19,6 +19,7 @@
  * @}
  */
 
+#include <assert.h>
 #include <stdint.h>
 
 #include "sched.h"
@@ -37,6 +38,14 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+#include "sched_round_robin.h"
+#endif
+
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -132,6 +141,17 @@ int __attribute__((used)) sched_run(void)
     }
 #endif
 
+#ifdef MODULE_SCHED_TRACE
+    sched_trace_record(SCHED_TRACE_SWITCH,
+                       (active_thread) ? active_thread->status : STATUS_NOT_FOUND,
+                       (active_thread) ? active_thread->pid : KERNEL_PID_UNDEF,
+                       next_thread->pid, 0);
+#endif
+
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    sched_round_robin_switch(next_thread);
+#endif
+
     next_thread->status = STATUS_RUNNING;
     sched_active_pid = next_thread->pid;
     sched_active_thread = (volatile thread_t *) next_thread;
@@ -166,6 +186,9 @@ void sched_set_status(thread_t *process, thread_status_t status)
                   process->pid, process->priority);
             clist_rpush(&sched_runqueues[process->priority], &(process->rq_entry));
             runqueue_bitcache |= 1 << process->priority;
+#ifdef MODULE_SCHED_ROUND_ROBIN
+            sched_round_robin_ready(process);
+#endif
         }
     }
     else {
@@ -183,6 +206,31 @@ void sched_set_status(thread_t *process, thread_status_t status)
     process->status = status;
 }
 
+void sched_change_priority(thread_t *thread, uint8_t priority)
+{
+    assert(priority < SCHED_PRIO_LEVELS);
+
+    if (thread->priority == priority) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+
+    DEBUG("sched_change_priority: thread %" PRIkernel_pid " from %" PRIu8
+          " to %" PRIu8 ".\n", thread->pid, thread->priority, priority);
+    if (thread->status >= STATUS_ON_RUNQUEUE) {
+        clist_remove(&sched_runqueues[thread->priority], &thread->rq_entry);
+        if (!sched_runqueues[thread->priority].next) {
+            runqueue_bitcache &= ~(1 << thread->priority);
+        }
+        clist_rpush(&sched_runqueues[priority], &thread->rq_entry);
+        runqueue_bitcache |= 1 << priority;
+    }
+    thread->priority = priority;
+
+    irq_restore(state);
+}
+
 void sched_switch(uint16_t other_prio)
 {
     thread_t *active_thread = (thread_t *) sched_active_thread;
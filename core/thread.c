@@ -29,6 +29,9 @@
 #include "debug.h"
 #include "bitarithm.h"
 #include "sched.h"
+#ifdef MODULE_SCHED_ROUND_ROBIN
+#include "sched_round_robin.h"
+#endif
 
 volatile thread_t *thread_get(kernel_pid_t pid)
 {
@@ -226,6 +229,16 @@ kernel_pid_t thread_create(char *stack, int stacksize, char priority, int flags,
     thread->priority = priority;
     thread->status = STATUS_STOPPED;
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    /* a reused pid must not keep the quantum of a former thread */
+    sched_round_robin_set_quantum(pid, 0);
+#endif
+
+#ifdef MODULE_CORE_MUTEX_PRIORITY_INHERITANCE
+    thread->base_priority = priority;
+    thread->mutexes_held.next = NULL;
+#endif
+
     thread->rq_entry.next = NULL;
 
 #ifdef MODULE_CORE_MSG
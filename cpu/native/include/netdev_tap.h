@@ -27,6 +27,7 @@ extern "C" {
 #include <stdint.h>
 #include "net/netdev.h"
 
+#include "net/ethernet.h"
 #include "net/ethernet/hdr.h"
 
 #ifdef __MACH__
@@ -35,6 +36,43 @@ extern "C" {
 #include "net/if.h"
 #endif
 
+/**
+ * @brief   Maximum number of frames read from the TAP per wakeup
+ *
+ * @details On every SIGIO of the TAP's file descriptor the driver reads all
+ *          pending frames, up to this number, into a receive queue and
+ *          reports them one after another to the upper layer, instead of
+ *          reading one frame and signaling itself again for the next one.
+ *          Every queue slot takes one full Ethernet frame in the device
+ *          descriptor. Must be at least 1 and must not exceed 255.
+ */
+#ifndef NETDEV_TAP_RX_QUEUE_SIZE
+#define NETDEV_TAP_RX_QUEUE_SIZE    (4U)
+#endif
+
+/**
+ * @brief   A received frame waiting in the receive queue
+ */
+typedef struct {
+    uint16_t len;                       /**< length of the frame */
+    uint8_t data[ETHERNET_FRAME_LEN];   /**< the frame */
+} netdev_tap_frame_t;
+
+/**
+ * @brief   Counters of the tap interface
+ *
+ * The average number of frames per wakeup is
+ * netdev_tap_stats_t::rx_frames / netdev_tap_stats_t::rx_wakeups. The
+ * receive counters can be read via @ref NETOPT_RX_BATCH_STATS.
+ */
+typedef struct {
+    uint32_t rx_wakeups;                /**< handled receive signals */
+    uint32_t rx_frames;                 /**< frames read from the TAP */
+    uint32_t rx_filtered;               /**< frames too short or not for us */
+    uint32_t rx_max_batch;              /**< most frames read on one wakeup */
+    uint32_t tx_frames;                 /**< frames written to the TAP */
+} netdev_tap_stats_t;
+
 /**
  * @brief tap interface state
  */
@@ -44,6 +82,13 @@ typedef struct netdev_tap {
     int tap_fd;                         /**< host file descriptor for the TAP */
     uint8_t addr[ETHERNET_ADDR_LEN];    /**< The MAC address of the TAP */
     uint8_t promiscous;                 /**< Flag for promiscous mode */
+    uint8_t rx_head;                    /**< first frame in the receive queue */
+    uint8_t rx_num;                     /**< frames in the receive queue */
+    /**
+     * @brief   Frames read from the TAP, not yet passed to the upper layer
+     */
+    netdev_tap_frame_t rx_queue[NETDEV_TAP_RX_QUEUE_SIZE];
+    netdev_tap_stats_t stats;           /**< counters */
 } netdev_tap_t;
 
 /**
@@ -40,6 +40,10 @@
 
 #include "native_internal.h"
 
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
+
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
@@ -260,7 +264,13 @@ void native_irq_handler(void)
 
         if (native_irq_handlers[sig] != NULL) {
             DEBUG("native_irq_handler: calling interrupt handler for %i\n", sig);
+#ifdef MODULE_SCHED_TRACE
+            sched_trace_irq_enter(sig);
+#endif
             native_irq_handlers[sig]();
+#ifdef MODULE_SCHED_TRACE
+            sched_trace_irq_exit(sig);
+#endif
         }
         else if (sig == SIGUSR1) {
             warnx("native_irq_handler: ignoring SIGUSR1");
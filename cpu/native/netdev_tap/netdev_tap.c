@@ -60,6 +60,7 @@
 #include "net/ethernet/hdr.h"
 #include "netdev_tap.h"
 #include "net/netopt.h"
+#include "net/netstats.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -94,17 +95,7 @@ static inline int _set_promiscous(netdev_t *netdev, int value)
     return value;
 }
 
-static inline void _isr(netdev_t *netdev)
-{
-    if (netdev->event_callback) {
-        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
-    }
-#if DEVELHELP
-    else {
-        puts("netdev_tap: _isr(): no event_callback set.");
-    }
-#endif
-}
+static void _isr(netdev_t *netdev);
 
 static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
 {
@@ -124,6 +115,20 @@ static int _get(netdev_t *dev, netopt_t opt, void *value, size_t max_len)
             *((bool*)value) = (bool)_get_promiscous(dev);
             res = sizeof(bool);
             break;
+        case NETOPT_RX_BATCH_STATS:
+            if (max_len < sizeof(netstats_rx_batch_t)) {
+                res = -EOVERFLOW;
+            }
+            else {
+                const netdev_tap_stats_t *stats = &((netdev_tap_t *)dev)->stats;
+                netstats_rx_batch_t *batch = value;
+
+                batch->wakeups = stats->rx_wakeups;
+                batch->frames = stats->rx_frames;
+                batch->max_batch = stats->rx_max_batch;
+                res = sizeof(netstats_rx_batch_t);
+            }
+            break;
         default:
             res = netdev_eth_get(dev, opt, value, max_len);
             break;
@@ -204,73 +209,127 @@ static void _continue_reading(netdev_tap_t *dev)
     _native_in_syscall--;
 }
 
-static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+static bool _accept_frame(netdev_tap_t *dev, const uint8_t *frame,
+                          size_t len)
 {
-    netdev_tap_t *dev = (netdev_tap_t*)netdev;
-    (void)info;
-
-    if (!buf) {
-        if (len > 0) {
-            /* no memory available in pktbuf, discarding the frame */
-            DEBUG("netdev_tap: discarding the frame\n");
-
-            /* repeating `real_read` for small size on tap device results in
-             * freeze for some reason. Using a large buffer for now. */
-            /*
-            uint8_t buf[4];
-            while (real_read(dev->tap_fd, buf, sizeof(buf)) > 0) {
-            }
-            */
+    const ethernet_hdr_t *hdr = (const ethernet_hdr_t *)frame;
 
-            static uint8_t nullbuf[ETHERNET_FRAME_LEN];
-
-            real_read(dev->tap_fd, nullbuf, sizeof(nullbuf));
+    if (len < sizeof(ethernet_hdr_t)) {
+        DEBUG("netdev_tap: frame too short (%u bytes) => Dropped\n",
+              (unsigned)len);
+        return false;
+    }
+    if (!(dev->promiscous) && !_is_addr_multicast((uint8_t *)hdr->dst) &&
+        !_is_addr_broadcast((uint8_t *)hdr->dst) &&
+        (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
+        DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
+              "That's not me => Dropped\n",
+              hdr->dst[0], hdr->dst[1], hdr->dst[2],
+              hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+        return false;
+    }
+    return true;
+}
 
-            _continue_reading(dev);
+/**
+ * @brief   Reads all pending frames from the TAP into the receive queue
+ *
+ * @return  Number of frames read
+ */
+static unsigned _read_frames(netdev_tap_t *dev)
+{
+    unsigned frames = 0;
+
+    while (dev->rx_num < NETDEV_TAP_RX_QUEUE_SIZE) {
+        unsigned idx = (dev->rx_head + dev->rx_num) % NETDEV_TAP_RX_QUEUE_SIZE;
+        netdev_tap_frame_t *frame = &dev->rx_queue[idx];
+        int nread = real_read(dev->tap_fd, frame->data, sizeof(frame->data));
+
+        DEBUG("netdev_tap: read %d bytes\n", nread);
+        if (nread > 0) {
+            if (!_accept_frame(dev, frame->data, nread)) {
+                dev->stats.rx_filtered++;
+                continue;
+            }
+            frame->len = nread;
+            dev->rx_num++;
+            frames++;
+        }
+        else if (nread == 0) {
+            DEBUG("_native_handle_tap_input: ignoring null-event\n");
+            break;
+        }
+        else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            /* all pending frames were read */
+            break;
+        }
+        else {
+            err(EXIT_FAILURE, "netdev_tap: read");
         }
-
-        /* no way of figuring out packet size without racey buffering,
-         * so we return the maximum possible size */
-        return ETHERNET_FRAME_LEN;
     }
+    return frames;
+}
 
-    int nread = real_read(dev->tap_fd, buf, len);
-    DEBUG("netdev_tap: read %d bytes\n", nread);
+static void _isr(netdev_t *netdev)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    unsigned frames = _read_frames(dev);
 
-    if (nread > 0) {
-        ethernet_hdr_t *hdr = (ethernet_hdr_t *)buf;
-        if (!(dev->promiscous) && !_is_addr_multicast(hdr->dst) &&
-            !_is_addr_broadcast(hdr->dst) &&
-            (memcmp(hdr->dst, dev->addr, ETHERNET_ADDR_LEN) != 0)) {
-            DEBUG("netdev_tap: received for %02x:%02x:%02x:%02x:%02x:%02x\n"
-                  "That's not me => Dropped\n",
-                  hdr->dst[0], hdr->dst[1], hdr->dst[2],
-                  hdr->dst[3], hdr->dst[4], hdr->dst[5]);
+    dev->stats.rx_wakeups++;
+    dev->stats.rx_frames += frames;
+    if (frames > dev->stats.rx_max_batch) {
+        dev->stats.rx_max_batch = frames;
+    }
 
-            native_async_read_continue(dev->tap_fd);
+    if (dev->rx_num == NETDEV_TAP_RX_QUEUE_SIZE) {
+        /* the full queue may have stopped draining the TAP */
+        _continue_reading(dev);
+    }
+    else {
+        native_async_read_continue(dev->tap_fd);
+    }
 
-            return 0;
-        }
+    if (!netdev->event_callback) {
+#if DEVELHELP
+        puts("netdev_tap: _isr(): no event_callback set.");
+#endif
+        return;
+    }
+    /* every call of _recv() by the upper layer takes one frame out of the
+     * queue */
+    for (unsigned i = dev->rx_num; (i > 0) && (dev->rx_num > 0); i--) {
+        netdev->event_callback(netdev, NETDEV_EVENT_RX_COMPLETE);
+    }
+}
 
-        _continue_reading(dev);
+static int _recv(netdev_t *netdev, void *buf, size_t len, void *info)
+{
+    netdev_tap_t *dev = (netdev_tap_t*)netdev;
+    netdev_tap_frame_t *frame = &dev->rx_queue[dev->rx_head];
+    int res = frame->len;
+    (void)info;
 
-        return nread;
+    if (dev->rx_num == 0) {
+        return 0;
     }
-    else if (nread == -1) {
-        if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
-        }
-        else {
-            err(EXIT_FAILURE, "netdev_tap: read");
+    if (!buf) {
+        if (len == 0) {
+            /* the exact size of the frame is known */
+            return res;
         }
+        /* no memory available in pktbuf, discarding the frame */
+        DEBUG("netdev_tap: discarding the frame\n");
     }
-    else if (nread == 0) {
-        DEBUG("_native_handle_tap_input: ignoring null-event\n");
+    else if (len < frame->len) {
+        DEBUG("netdev_tap: buffer too small, discarding the frame\n");
+        res = -ENOBUFS;
     }
     else {
-        errx(EXIT_FAILURE, "internal error _rx_event");
+        memcpy(buf, frame->data, frame->len);
     }
-
-    return -1;
+    dev->rx_head = (dev->rx_head + 1) % NETDEV_TAP_RX_QUEUE_SIZE;
+    dev->rx_num--;
+    return res;
 }
 
 static int _send(netdev_t *netdev, const iolist_t *iolist)
@@ -284,6 +343,9 @@ static int _send(netdev_t *netdev, const iolist_t *iolist)
 
     int res = _native_writev(dev->tap_fd, iov, n);
 
+    if (res > 0) {
+        dev->stats.tx_frames++;
+    }
     if (netdev->event_callback) {
         netdev->event_callback(netdev, NETDEV_EVENT_TX_COMPLETE);
     }
@@ -333,6 +395,9 @@ static int _init(netdev_t *netdev)
 #endif
     /* initialize device descriptor */
     dev->promiscous = 0;
+    dev->rx_head = 0;
+    dev->rx_num = 0;
+    memset(&dev->stats, 0, sizeof(dev->stats));
     /* implicitly create the tap interface */
     if ((dev->tap_fd = real_open(clonedev, O_RDWR | O_NONBLOCK)) == -1) {
         err(EXIT_FAILURE, "open(%s)", clonedev);
@@ -0,0 +1,187 @@
+#! /usr/bin/env python3
+
+#
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+#
+
+"""
+sched_trace2chrome
+
+Converts a binary dump of the `sched_trace` module into the Chrome trace event
+format.
+
+Description
+-----------
+
+The dump is written by `sched_trace_dump()`, e.g. using the shell command
+`schedtrace dump <file>` on `native`. The resulting JSON file can be opened in
+`chrome://tracing` or https://ui.perfetto.dev and shows:
+
+- one track per thread with the intervals the thread was running, annotated
+  with the state the thread left the CPU in
+- one track with the interrupts
+- the messages as flow arrows from sender to receiver
+
+A summary of the CPU time used by each thread is printed to stderr.
+
+Usage
+-----
+
+    usage: sched_trace2chrome.py [-h] [-o OUTFILE] infile
+"""
+
+import sys
+import json
+import struct
+import argparse
+from collections import defaultdict, deque
+
+MAGIC = 0x43525452
+VERSION = 1
+HDR_FMT = "IHHIHH"
+NAME_LEN = 14
+ENTRY_FMT = "IBBhhH"
+
+SWITCH, IRQ_ENTER, IRQ_EXIT, MSG_SEND, MSG_RECV = range(5)
+
+# thread_status_t in core/include/sched.h
+STATUS = ["stopped", "sleeping", "mutex blocked", "receive blocked",
+          "send blocked", "reply blocked", "flag blocked any",
+          "flag blocked all", "mbox blocked", "cond blocked", "running",
+          "pending"]
+
+IRQ_TID = -1
+
+
+def parse(data):
+    """Parse a dump and return (hz, {pid: name}, [entries])"""
+    for order in "<>":
+        magic, = struct.unpack_from(order + "I", data)
+        if magic == MAGIC:
+            break
+    else:
+        raise ValueError("not a sched_trace dump")
+    hdr_fmt = order + HDR_FMT
+    _, version, entry_size, hz, names_numof, numof = \
+        struct.unpack_from(hdr_fmt, data)
+    if version != VERSION:
+        raise ValueError("unsupported version {}".format(version))
+    if entry_size != struct.calcsize(order + ENTRY_FMT):
+        raise ValueError("unexpected entry size {}".format(entry_size))
+    offset = struct.calcsize(hdr_fmt)
+    names = {}
+    name_fmt = order + "h{}s".format(NAME_LEN)
+    for _ in range(names_numof):
+        pid, name = struct.unpack_from(name_fmt, data, offset)
+        names[pid] = name.split(b"\0")[0].decode(errors="replace")
+        offset += struct.calcsize(name_fmt)
+    entries = [struct.unpack_from(order + ENTRY_FMT, data,
+                                  offset + i * entry_size)
+               for i in range(numof)]
+    return hz, names, entries
+
+
+def timestamps(entries, hz):
+    """Unwrap the 32 bit tick counter and convert it to microseconds"""
+    res = []
+    now = 0
+    last = entries[0][0] if entries else 0
+    for entry in entries:
+        now += (entry[0] - last) & 0xffffffff
+        last = entry[0]
+        res.append(now * 1000000 / hz)
+    return res
+
+
+def thread_name(names, pid):
+    if pid in names:
+        return "{} ({})".format(names[pid] or "thread", pid)
+    if names and pid > max(names):
+        return "isr"
+    return "pid {}".format(pid)
+
+
+def convert(hz, names, entries):
+    events = []
+    runtime = defaultdict(float)
+    sends = defaultdict(deque)
+    flow_id = 0
+    running = None
+
+    for pid in names:
+        events.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": pid,
+                       "args": {"name": thread_name(names, pid)}})
+    events.append({"ph": "M", "name": "thread_name", "pid": 0, "tid": IRQ_TID,
+                   "args": {"name": "interrupts"}})
+
+    times = timestamps(entries, hz)
+    for ts, (_, event, info, a, b, value) in zip(times, entries):
+        if event == SWITCH:
+            if running is not None:
+                pid, start = running
+                reason = STATUS[info] if info < len(STATUS) else "none"
+                events.append({"ph": "X", "name": "running", "pid": 0,
+                               "tid": pid, "ts": start, "dur": ts - start,
+                               "args": {"left": reason}})
+                runtime[pid] += ts - start
+            running = (b, ts)
+        elif event in (IRQ_ENTER, IRQ_EXIT):
+            events.append({"ph": "B" if event == IRQ_ENTER else "E",
+                           "name": "irq {}".format(value), "pid": 0,
+                           "tid": IRQ_TID, "ts": ts})
+        elif event == MSG_SEND:
+            tid = IRQ_TID if a not in names else a
+            flow_id += 1
+            sends[(a, b)].append(flow_id)
+            events.append({"ph": "i", "s": "t", "pid": 0, "tid": tid,
+                           "ts": ts, "name": "send 0x{:04x}".format(value),
+                           "args": {"to": thread_name(names, b)}})
+            events.append({"ph": "s", "id": flow_id, "name": "msg",
+                           "cat": "msg", "pid": 0, "tid": tid, "ts": ts})
+        elif event == MSG_RECV:
+            events.append({"ph": "i", "s": "t", "pid": 0, "tid": a, "ts": ts,
+                           "name": "recv 0x{:04x}".format(value),
+                           "args": {"from": thread_name(names, b)}})
+            if sends[(b, a)]:
+                events.append({"ph": "f", "bp": "e", "id": sends[(b, a)].popleft(),
+                               "name": "msg", "cat": "msg", "pid": 0,
+                               "tid": a, "ts": ts})
+    if running is not None and times:
+        pid, start = running
+        events.append({"ph": "X", "name": "running", "pid": 0, "tid": pid,
+                       "ts": start, "dur": times[-1] - start})
+        runtime[pid] += times[-1] - start
+
+    return events, runtime, (times[-1] - times[0]) if times else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a sched_trace dump into a Chrome trace")
+    parser.add_argument("infile", type=argparse.FileType("rb"),
+                        help="binary dump written by sched_trace_dump()")
+    parser.add_argument("-o", "--outfile", type=argparse.FileType("w"),
+                        default=sys.stdout, help="JSON output (default: stdout)")
+    args = parser.parse_args()
+
+    try:
+        hz, names, entries = parse(args.infile.read())
+    except (ValueError, struct.error) as exc:
+        sys.exit("{}: {}".format(args.infile.name, exc))
+    events, runtime, total = convert(hz, names, entries)
+    json.dump({"traceEvents": events, "displayTimeUnit": "ns"}, args.outfile)
+
+    print("{} events over {:.0f} us".format(len(entries), total),
+          file=sys.stderr)
+    for pid, usec in sorted(runtime.items()):
+        print("  {:>24}: {:10.0f} us {:6.2f}%".format(
+            thread_name(names, pid), usec, (100 * usec / total) if total else 0),
+              file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
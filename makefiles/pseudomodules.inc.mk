@@ -13,6 +13,10 @@ PSEUDOMODULES += devfs_%
 PSEUDOMODULES += ecc_%
 PSEUDOMODULES += emb6_router
 PSEUDOMODULES += event_%
+PSEUDOMODULES += evtimer_heap
+PSEUDOMODULES += fib_trie
+PSEUDOMODULES += gcoap_resource_index
+PSEUDOMODULES += gcoap_thread
 PSEUDOMODULES += gnrc_ipv6_default
 PSEUDOMODULES += gnrc_ipv6_router
 PSEUDOMODULES += gnrc_ipv6_router_default
@@ -27,6 +31,7 @@ PSEUDOMODULES += gnrc_netapi_callbacks
 PSEUDOMODULES += gnrc_netapi_mbox
 PSEUDOMODULES += gnrc_pktbuf_cmd
 PSEUDOMODULES += gnrc_netif_dedup
+PSEUDOMODULES += gnrc_netif_rx_batch
 PSEUDOMODULES += gnrc_sixloenc
 PSEUDOMODULES += gnrc_sixlowpan_border_router_default
 PSEUDOMODULES += gnrc_sixlowpan_default
@@ -35,6 +40,7 @@ PSEUDOMODULES += gnrc_sixlowpan_iphc_nhc
 PSEUDOMODULES += gnrc_sixlowpan_nd_border_router
 PSEUDOMODULES += gnrc_sixlowpan_router
 PSEUDOMODULES += gnrc_sixlowpan_router_default
+PSEUDOMODULES += gnrc_sock_async
 PSEUDOMODULES += gnrc_sock_check_reuse
 PSEUDOMODULES += gnrc_txtsnd
 PSEUDOMODULES += i2c_scan
@@ -71,12 +77,14 @@ PSEUDOMODULES += scanf_float
 PSEUDOMODULES += schedstatistics
 PSEUDOMODULES += semtech_loramac_rx
 PSEUDOMODULES += sock
+PSEUDOMODULES += sock_async
 PSEUDOMODULES += sock_ip
 PSEUDOMODULES += sock_tcp
 PSEUDOMODULES += sock_udp
 PSEUDOMODULES += stdin
 PSEUDOMODULES += stdio_ethos
 PSEUDOMODULES += stdio_uart_rx
+PSEUDOMODULES += xtimer_heap
 
 # print ascii representation in function od_hex_dump()
 PSEUDOMODULES += od_string
@@ -65,6 +65,39 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep)
                                0)) ? -ENOTCONN : 0;
 }
 
+static int _set_remote(sock_udp_t *sock, struct netbuf *buf,
+                       sock_udp_ep_t *remote)
+{
+    /* convert remote */
+    size_t addr_len;
+#if LWIP_IPV6
+    if (sock->conn->type & NETCONN_TYPE_IPV6) {
+        addr_len = sizeof(ipv6_addr_t);
+        remote->family = AF_INET6;
+    }
+    else {
+#endif
+#if LWIP_IPV4
+        addr_len = sizeof(ipv4_addr_t);
+        remote->family = AF_INET;
+#else
+        (void)sock;
+        return -EPROTO;
+#endif
+#if LWIP_IPV6
+    }
+#endif
+#if LWIP_NETBUF_RECVINFO
+    remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
+#else
+    remote->netif = SOCK_ADDR_ANY_NETIF;
+#endif
+    /* copy address */
+    memcpy(&remote->addr, &buf->addr, addr_len);
+    remote->port = buf->port;
+    return 0;
+}
+
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote)
 {
@@ -81,34 +114,9 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         netbuf_delete(buf);
         return -ENOBUFS;
     }
-    if (remote != NULL) {
-        /* convert remote */
-        size_t addr_len;
-#if LWIP_IPV6
-        if (sock->conn->type & NETCONN_TYPE_IPV6) {
-            addr_len = sizeof(ipv6_addr_t);
-            remote->family = AF_INET6;
-        }
-        else {
-#endif
-#if LWIP_IPV4
-            addr_len = sizeof(ipv4_addr_t);
-            remote->family = AF_INET;
-#else
-            netbuf_delete(buf);
-            return -EPROTO;
-#endif
-#if LWIP_IPV6
-        }
-#endif
-#if LWIP_NETBUF_RECVINFO
-        remote->netif = lwip_sock_bind_addr_to_netif(&buf->toaddr);
-#else
-        remote->netif = SOCK_ADDR_ANY_NETIF;
-#endif
-        /* copy address */
-        memcpy(&remote->addr, &buf->addr, addr_len);
-        remote->port = buf->port;
+    if ((remote != NULL) && (_set_remote(sock, buf, remote) < 0)) {
+        netbuf_delete(buf);
+        return -EPROTO;
     }
     /* copy data */
     for (struct pbuf *q = buf->p; q != NULL; q = q->next) {
@@ -119,6 +127,42 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     return (ssize_t)res;
 }
 
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
+{
+    struct netbuf *buf = *buf_ctx;
+    u16_t len;
+    int res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (buf != NULL) {
+        /* hand out the next pbuf of the chain or release the message */
+        if (netbuf_next(buf) < 0) {
+            netbuf_delete(buf);
+            *buf_ctx = NULL;
+            *data = NULL;
+            return 0;
+        }
+        netbuf_data(buf, data, &len);
+        return len;
+    }
+    if ((res = lwip_sock_recv(sock->conn, timeout, &buf)) < 0) {
+        return res;
+    }
+    if ((remote != NULL) && (_set_remote(sock, buf, remote) < 0)) {
+        netbuf_delete(buf);
+        return -EPROTO;
+    }
+    netbuf_data(buf, data, &len);
+    if (len == 0) {
+        netbuf_delete(buf);
+        *data = NULL;
+        return 0;
+    }
+    *buf_ctx = buf;
+    return len;
+}
+
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote)
 {
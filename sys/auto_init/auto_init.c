@@ -28,6 +28,18 @@
 #include "xtimer.h"
 #endif
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+#include "sched_round_robin.h"
+#endif
+
+#ifdef MODULE_SCHED_TRACE
+#include "sched_trace.h"
+#endif
+
+#ifdef MODULE_EVENT_THREAD
+#include "event/thread.h"
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN
 #include "net/gnrc/sixlowpan.h"
 #endif
@@ -101,6 +113,18 @@ void auto_init(void)
     DEBUG("Auto init xtimer module.\n");
     xtimer_init();
 #endif
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    DEBUG("Auto init sched_round_robin module.\n");
+    sched_round_robin_init();
+#endif
+#ifdef MODULE_SCHED_TRACE
+    DEBUG("Auto init sched_trace module.\n");
+    sched_trace_init();
+#endif
+#ifdef MODULE_EVENT_THREAD
+    DEBUG("Auto init event_thread module.\n");
+    auto_init_event_thread();
+#endif
 #ifdef MODULE_MCI
     DEBUG("Auto init mci module.\n");
     mci_initialize();
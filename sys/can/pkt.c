@@ -21,9 +21,9 @@
 #include <limits.h>
 #include <errno.h>
 
-#include "net/gnrc/pktbuf.h"
 #include "can/pkt.h"
 #include "mutex.h"
+#include "objpool.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -33,27 +33,34 @@
 static int handle;
 static mutex_t _mutex = MUTEX_INIT;
 
+/* packets and rx data are allocated and freed concurrently by the device
+ * threads and the upper layers, the pools need no further locking */
+static can_pkt_t _pkts[CAN_PKT_NUMOF];
+static objpool_t _pkt_pool;
+static can_rx_data_t _rx_data[CAN_RX_DATA_NUMOF];
+static objpool_t _rx_data_pool;
+
 void can_pkt_init(void)
 {
     mutex_lock(&_mutex);
     handle = 1;
+    objpool_init(&_pkt_pool, _pkts, sizeof(_pkts[0]), CAN_PKT_NUMOF);
+    objpool_init(&_rx_data_pool, _rx_data, sizeof(_rx_data[0]),
+                 CAN_RX_DATA_NUMOF);
     mutex_unlock(&_mutex);
 }
 
 static can_pkt_t *_pkt_alloc(int ifnum, const struct can_frame *frame)
 {
-    can_pkt_t *pkt;
+    can_pkt_t *pkt = objpool_alloc(&_pkt_pool);
 
-    gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, NULL, sizeof(*pkt), GNRC_NETTYPE_UNDEF);
-    if (!snip) {
+    if (!pkt) {
         DEBUG("can_pkt_alloc: out of memory\n");
         return NULL;
     }
 
-    pkt = snip->data;
     pkt->entry.ifnum = ifnum;
     pkt->frame = *frame;
-    pkt->snip = snip;
 
     DEBUG("can_pkt_alloc: pkt allocated\n");
 
@@ -132,26 +139,23 @@ void can_pkt_free(can_pkt_t *pkt)
 
     DEBUG("can_pkt_free: free pkt=%p\n", (void*)pkt);
 
-    gnrc_pktbuf_release(pkt->snip);
+    objpool_free(&_pkt_pool, pkt);
 }
 
 can_rx_data_t *can_pkt_alloc_rx_data(void *data, size_t len, void *arg)
 {
-    can_rx_data_t *rx;
+    can_rx_data_t *rx = objpool_alloc(&_rx_data_pool);
 
-    gnrc_pktsnip_t *snip = gnrc_pktbuf_add(NULL, NULL, sizeof(*rx), GNRC_NETTYPE_UNDEF);
-    if (!snip) {
+    if (!rx) {
         DEBUG("can_pkt_alloc_rx_data: out of memory\n");
         return NULL;
     }
 
-    rx = snip->data;
     DEBUG("can_pkt_alloc_rx_data: rx=%p\n", (void *)rx);
 
     rx->data.iov_base = data;
     rx->data.iov_len = len;
     rx->arg = arg;
-    rx->snip = snip;
 
     return rx;
 }
@@ -162,5 +166,5 @@ void can_pkt_free_rx_data(can_rx_data_t *data)
         return;
     }
 
-    gnrc_pktbuf_release(data->snip);
+    objpool_free(&_rx_data_pool, data);
 }
@@ -52,6 +52,27 @@ void event_queue_claim(event_queue_t *queue)
     queue->waiter = (thread_t *)sched_active_thread;
 }
 
+void event_queues_init_detached(event_queue_t *queues, size_t n_queues)
+{
+    for (size_t i = 0; i < n_queues; i++) {
+        event_queue_init_detached(&queues[i]);
+    }
+}
+
+void event_queues_init(event_queue_t *queues, size_t n_queues)
+{
+    for (size_t i = 0; i < n_queues; i++) {
+        event_queue_init(&queues[i]);
+    }
+}
+
+void event_queues_claim(event_queue_t *queues, size_t n_queues)
+{
+    for (size_t i = 0; i < n_queues; i++) {
+        event_queue_claim(&queues[i]);
+    }
+}
+
 void event_post(event_queue_t *queue, event_t *event)
 {
     assert(queue && event);
@@ -96,14 +117,16 @@ event_t *event_get(event_queue_t *queue)
     return result;
 }
 
-event_t *event_wait(event_queue_t *queue)
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues)
 {
-    assert(queue);
-    event_t *result;
+    assert(queues && n_queues);
+    event_t *result = NULL;
 
     do {
         unsigned state = irq_disable();
-        result = (event_t *)clist_lpop(&queue->event_list);
+        for (size_t i = 0; (result == NULL) && (i < n_queues); i++) {
+            result = (event_t *)clist_lpop(&queues[i].event_list);
+        }
         irq_restore(state);
         if (result == NULL) {
             thread_flags_wait_any(THREAD_FLAG_EVENT);
@@ -114,6 +137,12 @@ event_t *event_wait(event_queue_t *queue)
     return result;
 }
 
+event_t *event_wait(event_queue_t *queue)
+{
+    assert(queue);
+    return event_wait_multi(queue, 1);
+}
+
 #ifdef MODULE_XTIMER
 event_t *event_wait_timeout(event_queue_t *queue, uint32_t timeout)
 {
@@ -146,3 +175,12 @@ void event_loop(event_queue_t *queue)
         event->handler(event);
     }
 }
+
+void event_loop_multi(event_queue_t *queues, size_t n_queues)
+{
+    event_t *event;
+
+    while ((event = event_wait_multi(queues, n_queues))) {
+        event->handler(event);
+    }
+}
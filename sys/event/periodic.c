@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @{
+ *
+ * @file
+ * @brief       Periodic event implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "event/periodic.h"
+
+static void _event_periodic_callback(void *arg)
+{
+    event_periodic_t *event_periodic = (event_periodic_t *)arg;
+    uint32_t now;
+
+    event_post(event_periodic->queue, event_periodic->event);
+    if (event_periodic->count && (--event_periodic->count == 0)) {
+        return;
+    }
+    now = xtimer_now_usec();
+    /* skip the periods that were missed completely */
+    do {
+        event_periodic->next += event_periodic->interval;
+    } while ((int32_t)(event_periodic->next - now) <= 0);
+    xtimer_set(&event_periodic->timer, event_periodic->next - now);
+}
+
+void event_periodic_init(event_periodic_t *event_periodic,
+                         event_queue_t *queue, event_t *event)
+{
+    event_periodic->timer.callback = _event_periodic_callback;
+    event_periodic->timer.arg = event_periodic;
+    event_periodic->count = 0;
+    event_periodic->queue = queue;
+    event_periodic->event = event;
+}
+
+void event_periodic_start(event_periodic_t *event_periodic, uint32_t interval)
+{
+    assert(interval > 0);
+    event_periodic->interval = interval;
+    event_periodic->next = xtimer_now_usec() + interval;
+    xtimer_set(&event_periodic->timer, interval);
+}
+
+void event_periodic_stop(event_periodic_t *event_periodic)
+{
+    xtimer_remove(&event_periodic->timer);
+}
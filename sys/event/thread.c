@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_thread
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include "event/thread.h"
+
+event_queue_t event_thread_queues[EVENT_QUEUE_PRIO_NUMOF];
+
+static char _stack[EVENT_THREAD_STACKSIZE];
+
+static void *_handler_thread(void *arg)
+{
+    event_queue_t *queues = arg;
+
+    event_queues_claim(queues, EVENT_QUEUE_PRIO_NUMOF);
+    event_loop_multi(queues, EVENT_QUEUE_PRIO_NUMOF);
+    return NULL;
+}
+
+kernel_pid_t event_thread_init(event_queue_t *queues, char *stack,
+                               size_t stack_size, unsigned priority)
+{
+    event_queues_init_detached(queues, EVENT_QUEUE_PRIO_NUMOF);
+    return thread_create(stack, stack_size, priority, THREAD_CREATE_STACKTEST,
+                         _handler_thread, queues, "event");
+}
+
+void auto_init_event_thread(void)
+{
+    event_thread_init(event_thread_queues, _stack, sizeof(_stack),
+                      EVENT_THREAD_PRIO);
+}
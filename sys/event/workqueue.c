@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event_workqueue
+ * @{
+ *
+ * @file
+ * @brief       Event work queue implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "bitarithm.h"
+#include "event/workqueue.h"
+
+static inline unsigned _index(const event_workqueue_worker_t *worker)
+{
+    return worker - worker->wq->workers;
+}
+
+/* takes the oldest job of the worker or, if there is none, of the workers
+ * following it. Marks the worker idle if there is no job at all */
+static event_t *_take(event_workqueue_worker_t *worker)
+{
+    event_workqueue_t *wq = worker->wq;
+    unsigned idx = _index(worker);
+    unsigned state = irq_disable();
+    event_t *job = (event_t *)clist_lpop(&worker->queue.event_list);
+
+    for (unsigned i = 1; (job == NULL) && (i < wq->numof); i++) {
+        event_workqueue_worker_t *victim = &wq->workers[(idx + i) % wq->numof];
+
+        job = (event_t *)clist_lpop(&victim->queue.event_list);
+        if (job != NULL) {
+            worker->stolen++;
+        }
+    }
+    if (job == NULL) {
+        wq->idle |= (1U << idx);
+    }
+    irq_restore(state);
+
+    if (job != NULL) {
+        job->list_node.next = NULL;
+    }
+    return job;
+}
+
+static void *_worker_thread(void *arg)
+{
+    event_workqueue_worker_t *worker = arg;
+
+    event_queue_claim(&worker->queue);
+    while (1) {
+        event_t *job = _take(worker);
+
+        if (job == NULL) {
+            /* a job submitted after _take() marked us idle sets the flag, so
+             * it is not missed */
+            thread_flags_wait_any(THREAD_FLAG_EVENT);
+            continue;
+        }
+        worker->handled++;
+        job->handler(job);
+    }
+    return NULL;
+}
+
+int event_workqueue_init(event_workqueue_t *wq,
+                         event_workqueue_worker_t *workers, unsigned numof,
+                         char *stacks, size_t stack_size, unsigned priority)
+{
+    assert(wq && workers && stacks);
+    assert((numof > 0) && (numof <= EVENT_WORKQUEUE_WORKERS_MAX));
+
+    wq->workers = workers;
+    wq->numof = numof;
+    wq->next = 0;
+    wq->idle = 0;
+    for (unsigned i = 0; i < numof; i++) {
+        event_queue_init_detached(&workers[i].queue);
+        workers[i].wq = wq;
+        workers[i].handled = 0;
+        workers[i].stolen = 0;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        kernel_pid_t pid = thread_create(stacks + (i * stack_size), stack_size,
+                                         priority, THREAD_CREATE_STACKTEST,
+                                         _worker_thread, &workers[i],
+                                         "worker");
+        if (pid < 0) {
+            return pid;
+        }
+    }
+    return 0;
+}
+
+/* returns the worker the calling thread is, if any */
+static event_workqueue_worker_t *_self(event_workqueue_t *wq)
+{
+    thread_t *me = (thread_t *)sched_active_thread;
+
+    if (irq_is_in()) {
+        return NULL;
+    }
+    for (unsigned i = 0; i < wq->numof; i++) {
+        if (wq->workers[i].queue.waiter == me) {
+            return &wq->workers[i];
+        }
+    }
+    return NULL;
+}
+
+void event_workqueue_submit(event_workqueue_t *wq, event_t *job)
+{
+    assert(wq && job && job->handler);
+
+    event_workqueue_worker_t *target;
+    thread_t *waiter = NULL;
+    unsigned state = irq_disable();
+
+    if (job->list_node.next != NULL) {
+        /* still queued */
+        irq_restore(state);
+        return;
+    }
+    if (wq->idle) {
+        unsigned idx = bitarithm_lsb(wq->idle);
+
+        target = &wq->workers[idx];
+        wq->idle &= ~(1U << idx);
+        waiter = target->queue.waiter;
+    }
+    else if ((target = _self(wq)) == NULL) {
+        target = &wq->workers[wq->next];
+        wq->next = (wq->next + 1) % wq->numof;
+    }
+    clist_rpush(&target->queue.event_list, &job->list_node);
+    irq_restore(state);
+
+    if (waiter) {
+        thread_flags_set(waiter, THREAD_FLAG_EVENT);
+    }
+}
+
+void event_workqueue_cancel(event_workqueue_t *wq, event_t *job)
+{
+    assert(wq && job);
+
+    unsigned state = irq_disable();
+    for (unsigned i = 0; i < wq->numof; i++) {
+        if (clist_remove(&wq->workers[i].queue.event_list, &job->list_node)) {
+            break;
+        }
+    }
+    job->list_node.next = NULL;
+    irq_restore(state);
+}
@@ -22,6 +22,8 @@
  * @}
  */
 
+#include <stdbool.h>
+
 #include "div.h"
 #include "irq.h"
 #include "xtimer.h"
@@ -31,6 +33,132 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
+#ifdef MODULE_EVTIMER_HEAP
+/*
+ * Events are kept in a pairing heap ordered by their deadline, so adding an
+ * event is O(1) and removing one is O(log n) amortized. Once added, the
+ * offset of an event holds its absolute deadline in milliseconds. Deadlines
+ * are compared relative to evtimer->base, which is never later than the
+ * earliest deadline, so they may wrap around.
+ *
+ * Each event links to its first child, its next sibling and to its previous
+ * sibling (or its parent, if it is the first child). Events not in the heap
+ * have prev set to NULL, except for the root.
+ */
+static inline uint32_t _now_ms(void)
+{
+    return div_u64_by_125(xtimer_now_usec64() >> 3);
+}
+
+static inline bool _before(const evtimer_t *evtimer, uint32_t a, uint32_t b)
+{
+    return (a - evtimer->base) < (b - evtimer->base);
+}
+
+static inline bool _is_queued(const evtimer_t *evtimer,
+                              const evtimer_event_t *event)
+{
+    return (event == evtimer->events) || (event->prev != NULL);
+}
+
+/* makes the later of two roots the first child of the other one */
+static evtimer_event_t *_meld(const evtimer_t *evtimer, evtimer_event_t *a,
+                              evtimer_event_t *b)
+{
+    if (_before(evtimer, b->offset, a->offset)) {
+        evtimer_event_t *tmp = a;
+
+        a = b;
+        b = tmp;
+    }
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+/* melds a list of siblings into one heap (two-pass pairing) */
+static evtimer_event_t *_merge_pairs(const evtimer_t *evtimer,
+                                     evtimer_event_t *first)
+{
+    evtimer_event_t *pairs = NULL, *res = NULL;
+
+    /* meld pairs from left to right, collecting them in reverse order */
+    while (first) {
+        evtimer_event_t *a = first, *b = first->next;
+
+        first = (b) ? b->next : NULL;
+        a->prev = a->next = NULL;
+        if (b) {
+            b->prev = b->next = NULL;
+            a = _meld(evtimer, a, b);
+        }
+        a->next = pairs;
+        pairs = a;
+    }
+    /* meld the pairs from right to left */
+    while (pairs) {
+        evtimer_event_t *next = pairs->next;
+
+        pairs->next = NULL;
+        res = (res) ? _meld(evtimer, res, pairs) : pairs;
+        pairs = next;
+    }
+    return res;
+}
+
+static void _add_event(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    uint32_t now = _now_ms();
+    uint32_t offset = event->offset;
+
+    DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
+    /* move base up to now, unless the earliest event is overdue already */
+    if ((evtimer->events == NULL) ||
+        !_before(evtimer, evtimer->events->offset, now)) {
+        evtimer->base = now;
+    }
+    else {
+        evtimer->base = evtimer->events->offset;
+    }
+    /* deadlines must stay within 2^32 ms of base */
+    if (offset > (UINT32_MAX - (now - evtimer->base))) {
+        offset = UINT32_MAX - (now - evtimer->base);
+    }
+    event->offset = now + offset;
+    event->next = event->child = event->prev = NULL;
+    evtimer->events = (evtimer->events) ? _meld(evtimer, evtimer->events, event)
+                                        : event;
+}
+
+static void _del_event(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    evtimer_event_t *sub = _merge_pairs(evtimer, event->child);
+
+    if (event == evtimer->events) {
+        evtimer->events = sub;
+    }
+    else {
+        /* unlink event from its siblings */
+        if (event->prev->child == event) {
+            event->prev->child = event->next;
+        }
+        else {
+            event->prev->next = event->next;
+        }
+        if (event->next) {
+            event->next->prev = event->prev;
+        }
+        if (sub) {
+            evtimer->events = _meld(evtimer, evtimer->events, sub);
+        }
+    }
+    event->next = event->child = event->prev = NULL;
+}
+#else /* MODULE_EVTIMER_HEAP */
 static void _add_event_to_list(evtimer_t *evtimer, evtimer_event_t *event)
 {
     DEBUG("evtimer: new event offset %" PRIu32 " ms\n", event->offset);
@@ -91,6 +219,8 @@ static void _del_event_from_list(evtimer_t *evtimer, evtimer_event_t *event)
     }
 }
 
+#endif /* MODULE_EVTIMER_HEAP */
+
 static void _set_timer(xtimer_t *timer, uint32_t offset_ms)
 {
     uint64_t offset_us = (uint64_t)offset_ms * US_PER_MS;
@@ -101,6 +231,110 @@ static void _set_timer(xtimer_t *timer, uint32_t offset_ms)
     xtimer_set64(timer, offset_us);
 }
 
+#ifdef MODULE_EVTIMER_HEAP
+static void _update_timer(evtimer_t *evtimer)
+{
+    if (evtimer->events) {
+        uint32_t now = _now_ms();
+        uint32_t deadline = evtimer->events->offset;
+
+        /* overdue events fire right away */
+        _set_timer(&evtimer->timer,
+                   _before(evtimer, now, deadline) ? (deadline - now) : 0);
+    }
+    else {
+        xtimer_remove(&evtimer->timer);
+    }
+}
+
+void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_add(): adding event with offset %" PRIu32 "\n", event->offset);
+
+    _add_event(evtimer, event);
+    if (evtimer->events == event) {
+        _update_timer(evtimer);
+    }
+    irq_restore(state);
+    if (sched_context_switch_request) {
+        thread_yield_higher();
+    }
+}
+
+void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event)
+{
+    unsigned state = irq_disable();
+
+    DEBUG("evtimer_del(): removing event with deadline %" PRIu32 "\n",
+          event->offset);
+
+    if (_is_queued(evtimer, event)) {
+        bool head = (evtimer->events == event);
+
+        _del_event(evtimer, event);
+        if (head) {
+            _update_timer(evtimer);
+        }
+    }
+    irq_restore(state);
+}
+
+static void _evtimer_handler(void *arg)
+{
+    DEBUG("_evtimer_handler()\n");
+
+    evtimer_t *evtimer = (evtimer_t *)arg;
+    evtimer_event_t *event;
+
+    /* handlers may add events, which moves base, so the time is checked
+     * again for every event */
+    while ((event = evtimer->events)) {
+        uint32_t now = _now_ms();
+
+        if (_before(evtimer, now, event->offset)) {
+            /* all remaining events are in the future */
+            evtimer->base = now;
+            break;
+        }
+        _del_event(evtimer, event);
+        evtimer->callback(event);
+    }
+    _update_timer(evtimer);
+}
+
+evtimer_event_t *evtimer_next(const evtimer_t *evtimer,
+                              const evtimer_event_t *event)
+{
+    /* pre-order traversal of the heap */
+    if (event == NULL) {
+        return evtimer->events;
+    }
+    if (event->child) {
+        return event->child;
+    }
+    while (event) {
+        if (event->next) {
+            return event->next;
+        }
+        /* walk back to the first sibling, its prev is the parent */
+        while (event->prev && (event->prev->child != event)) {
+            event = event->prev;
+        }
+        event = event->prev;
+    }
+    return NULL;
+}
+
+uint32_t evtimer_get_offset(const evtimer_t *evtimer,
+                            const evtimer_event_t *event)
+{
+    uint32_t now = _now_ms();
+
+    return _before(evtimer, now, event->offset) ? (event->offset - now) : 0;
+}
+#else /* MODULE_EVTIMER_HEAP */
 static void _update_timer(evtimer_t *evtimer)
 {
     if (evtimer->events) {
@@ -198,6 +432,27 @@ static void _evtimer_handler(void *arg)
     _update_timer(evtimer);
 }
 
+evtimer_event_t *evtimer_next(const evtimer_t *evtimer,
+                              const evtimer_event_t *event)
+{
+    return (event) ? event->next : evtimer->events;
+}
+
+uint32_t evtimer_get_offset(const evtimer_t *evtimer,
+                            const evtimer_event_t *event)
+{
+    uint32_t offset = 0;
+
+    for (evtimer_event_t *ptr = evtimer->events; ptr; ptr = ptr->next) {
+        offset += ptr->offset;
+        if (ptr == event) {
+            break;
+        }
+    }
+    return offset;
+}
+#endif /* MODULE_EVTIMER_HEAP */
+
 void evtimer_init(evtimer_t *evtimer, evtimer_callback_t handler)
 {
     evtimer->callback = handler;
@@ -213,7 +468,12 @@ void evtimer_print(const evtimer_t *evtimer)
 
     while (list) {
         nr++;
+#ifdef MODULE_EVTIMER_HEAP
+        printf("ev #%d offset=%u\n", nr,
+               (unsigned)evtimer_get_offset(evtimer, list));
+#else
         printf("ev #%d offset=%u\n", nr, (unsigned)list->offset);
-        list = list->next;
+#endif
+        list = evtimer_next(evtimer, list);
     }
 }
@@ -35,6 +35,20 @@ extern "C" {
 #include "mbox.h"
 #endif
 
+/**
+ * @brief Number of CAN packets that can be allocated at once
+ */
+#ifndef CAN_PKT_NUMOF
+#define CAN_PKT_NUMOF       (16U)
+#endif
+
+/**
+ * @brief Number of @p can_rx_data_t that can be allocated at once
+ */
+#ifndef CAN_RX_DATA_NUMOF
+#define CAN_RX_DATA_NUMOF   (16U)
+#endif
+
 /**
  * @brief A CAN packet
  *
@@ -45,7 +59,6 @@ typedef struct {
     atomic_uint ref_count;   /**< Reference counter (for rx frames) */
     int handle;              /**< handle (for tx frames */
     struct can_frame frame;  /**< CAN Frame */
-    gnrc_pktsnip_t *snip;    /**< Pointer to the allocated snip */
 } can_pkt_t;
 
 /**
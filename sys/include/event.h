@@ -47,6 +47,11 @@
  * to be queued. Thus event queues can be used safely and efficiently in combination
  * with thread flags and msg queues.
  *
+ * A thread can also serve an array of event queues of descending priority
+ * with event_wait_multi() or event_loop_multi(): an event is only handled
+ * when all queues of higher priority are empty. This allows to share one
+ * thread (and stack) among several services, see @ref sys_event_thread.
+ *
  * Examples:
  *
  * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
@@ -96,9 +101,11 @@
 #ifndef EVENT_H
 #define EVENT_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #include "irq.h"
+#include "thread.h"
 #include "thread_flags.h"
 #include "clist.h"
 
@@ -158,6 +165,16 @@ typedef struct {
  */
 void event_queue_init(event_queue_t *queue);
 
+/**
+ * @brief   Initialize an array of event queues
+ *
+ * This will set the calling thread as owner of all @p queues.
+ *
+ * @param[out]  queues      event queue objects to initialize
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_queues_init(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Initialize an event queue not binding it to a thread
  *
@@ -165,6 +182,14 @@ void event_queue_init(event_queue_t *queue);
  */
 void event_queue_init_detached(event_queue_t *queue);
 
+/**
+ * @brief   Initialize an array of event queues not binding them to a thread
+ *
+ * @param[out]  queues      event queue objects to initialize
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_queues_init_detached(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Bind an event queue to the calling thread
  *
@@ -177,6 +202,16 @@ void event_queue_init_detached(event_queue_t *queue);
  */
 void event_queue_claim(event_queue_t *queue);
 
+/**
+ * @brief   Bind an array of event queues to the calling thread
+ *
+ * @pre     none of the queues is bound to a thread yet
+ *
+ * @param[out]  queues      event queue objects to bind to a thread
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_queues_claim(event_queue_t *queues, size_t n_queues);
+
 /**
  * @brief   Queue an event
  *
@@ -231,6 +266,22 @@ event_t *event_get(event_queue_t *queue);
  */
 event_t *event_wait(event_queue_t *queue);
 
+/**
+ * @brief   Get next event from an array of event queues, blocking
+ *
+ * The queues are ordered by descending priority: an event is taken from
+ * the first non-empty queue. This function will block until an event becomes
+ * available in any of the queues.
+ *
+ * @note    All queues must be bound to the calling thread!
+ *
+ * @param[in]   queues      event queues to get event from
+ * @param[in]   n_queues    number of queues in @p queues
+ *
+ * @returns     pointer to next event
+ */
+event_t *event_wait_multi(event_queue_t *queues, size_t n_queues);
+
 #if defined(MODULE_XTIMER) || defined(DOXYGEN)
 /**
  * @brief   Get next event from event queue, blocking until timeout expires
@@ -262,6 +313,19 @@ event_t *event_wait_timeout(event_queue_t *queue, uint32_t timeout);
  */
 void event_loop(event_queue_t *queue);
 
+/**
+ * @brief   Event loop serving an array of event queues
+ *
+ * This function will forever sit in a loop, waiting for events to be queued
+ * and executing their handlers. After every event, the queues are checked
+ * again in order, so an event of a queue is only handled when all queues
+ * before it are empty.
+ *
+ * @param[in]   queues      event queues to process, by descending priority
+ * @param[in]   n_queues    number of queues in @p queues
+ */
+void event_loop_multi(event_queue_t *queues, size_t n_queues);
+
 #ifdef __cplusplus
 }
 #endif
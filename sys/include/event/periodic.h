@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_event
+ * @brief       Provides functionality to trigger events periodically
+ *
+ * Like event_timeout, event_periodic does not extend the event structure, so
+ * any event can be posted periodically. The period is kept without drift: a
+ * post is scheduled relative to the time the previous one was due, not to the
+ * time it happened. If the event is still queued when it is due again, it is
+ * not queued twice, and periods missed completely are skipped.
+ *
+ * Example:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * event_periodic_t event_periodic;
+ *
+ * event_periodic_init(&event_periodic, &queue, &event);
+ * event_periodic_set_count(&event_periodic, 10);
+ * event_periodic_start(&event_periodic, 100 * US_PER_MS);
+ * [...]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Periodic event API
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef EVENT_PERIODIC_H
+#define EVENT_PERIODIC_H
+
+#include <stdint.h>
+
+#include "event.h"
+#include "xtimer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Periodic event structure
+ */
+typedef struct {
+    xtimer_t timer;         /**< xtimer object used for the period */
+    uint32_t next;          /**< time the next post is due in us */
+    uint32_t interval;      /**< period in us */
+    uint32_t count;         /**< remaining number of posts, 0 for unlimited */
+    event_queue_t *queue;   /**< event queue to post event to */
+    event_t *event;         /**< event to post periodically */
+} event_periodic_t;
+
+/**
+ * @brief   Initialize a periodic event
+ *
+ * @param[out]  event_periodic  object to initialize
+ * @param[in]   queue           queue that the event will be posted on
+ * @param[in]   event           event to post periodically
+ */
+void event_periodic_init(event_periodic_t *event_periodic,
+                         event_queue_t *queue, event_t *event);
+
+/**
+ * @brief   Start posting the event periodically
+ *
+ * The event is posted for the first time after @p interval.
+ *
+ * @param[in]   event_periodic  periodic event to start
+ * @param[in]   interval        period in us
+ */
+void event_periodic_start(event_periodic_t *event_periodic, uint32_t interval);
+
+/**
+ * @brief   Stop posting the event periodically
+ *
+ * @note    The event might still be queued, use event_cancel() to remove it.
+ *
+ * @param[in]   event_periodic  periodic event to stop
+ */
+void event_periodic_stop(event_periodic_t *event_periodic);
+
+/**
+ * @brief   Limit the number of posts of a periodic event
+ *
+ * @param[in]   event_periodic  periodic event to limit
+ * @param[in]   count           number of posts before stopping, 0 for
+ *                              unlimited
+ */
+static inline void event_periodic_set_count(event_periodic_t *event_periodic,
+                                            uint32_t count)
+{
+    event_periodic->count = count;
+}
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* EVENT_PERIODIC_H */
+/** @} */
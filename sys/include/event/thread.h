@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_thread Shared event thread
+ * @ingroup     sys_event
+ * @brief       Event queues of different priorities served by one thread
+ *
+ * Many services only need a thread to react on timeouts or on data that is
+ * signalled by an interrupt, and spend most of their lifetime blocked. Each
+ * of those threads costs a complete stack. With this module, a single thread
+ * serves the three event queues @ref EVENT_PRIO_HIGHEST, @ref
+ * EVENT_PRIO_MEDIUM and @ref EVENT_PRIO_LOWEST, so such services can post
+ * their events there instead of running a thread of their own. An event is
+ * only handled when all queues of higher priority are empty, but handlers are
+ * never preempted by events of higher priority, so they must not block.
+ *
+ * The thread is started by auto_init with a stack of
+ * @ref EVENT_THREAD_STACKSIZE bytes at priority @ref EVENT_THREAD_PRIO.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * static void _handler(event_t *event)
+ * {
+ *     ...
+ * }
+ *
+ * static event_t _event = { .handler = _handler };
+ *
+ * [...] event_post(EVENT_PRIO_MEDIUM, &_event);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Shared event thread API
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef EVENT_THREAD_H
+#define EVENT_THREAD_H
+
+#include <stddef.h>
+
+#include "event.h"    /* includes core's thread.h */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Stack size of the shared event thread
+ */
+#ifndef EVENT_THREAD_STACKSIZE
+#define EVENT_THREAD_STACKSIZE      (THREAD_STACKSIZE_DEFAULT)
+#endif
+
+/**
+ * @brief   Priority of the shared event thread
+ */
+#ifndef EVENT_THREAD_PRIO
+#define EVENT_THREAD_PRIO           (THREAD_PRIORITY_MAIN - 1)
+#endif
+
+/**
+ * @brief   Priorities of the event queues of an event thread
+ */
+typedef enum {
+    EVENT_QUEUE_PRIO_HIGHEST,       /**< handled first */
+    EVENT_QUEUE_PRIO_MEDIUM,        /**< handled if the highest is empty */
+    EVENT_QUEUE_PRIO_LOWEST,        /**< handled if all others are empty */
+    EVENT_QUEUE_PRIO_NUMOF,         /**< number of event queues */
+} event_queue_prio_t;
+
+/**
+ * @brief   Event queues of the shared event thread
+ */
+extern event_queue_t event_thread_queues[EVENT_QUEUE_PRIO_NUMOF];
+
+/**
+ * @name    Event queues of the shared event thread
+ * @{
+ */
+#define EVENT_PRIO_HIGHEST  (&event_thread_queues[EVENT_QUEUE_PRIO_HIGHEST])
+#define EVENT_PRIO_MEDIUM   (&event_thread_queues[EVENT_QUEUE_PRIO_MEDIUM])
+#define EVENT_PRIO_LOWEST   (&event_thread_queues[EVENT_QUEUE_PRIO_LOWEST])
+/** @} */
+
+/**
+ * @brief   Starts a thread serving an array of event queues
+ *
+ * Events can be posted to @p queues right away, they are handled once the
+ * thread runs.
+ *
+ * @param[out] queues       @ref EVENT_QUEUE_PRIO_NUMOF event queues, by
+ *                          descending priority
+ * @param[in] stack         stack of the thread
+ * @param[in] stack_size    size of @p stack
+ * @param[in] priority      priority of the thread
+ *
+ * @return  PID of the thread
+ * @return  negative value on error, see thread_create()
+ */
+kernel_pid_t event_thread_init(event_queue_t *queues, char *stack,
+                               size_t stack_size, unsigned priority);
+
+/**
+ * @brief   Starts the shared event thread
+ *
+ * @note    Called by auto_init
+ */
+void auto_init_event_thread(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_THREAD_H */
+/** @} */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_event_workqueue Event work queue
+ * @ingroup     sys_event
+ * @brief       Pool of worker threads sharing submitted events
+ *
+ * A work queue runs a fixed number of worker threads that handle the events
+ * (jobs) submitted to it. Unlike a plain @ref event_queue_t served by a single
+ * thread, a job whose handler blocks (e.g. waiting for a response or sleeping)
+ * does not hold back the other jobs as long as a worker is free.
+ *
+ * Every worker owns an @ref event_queue_t. A submitted job is given to an idle
+ * worker if there is one. If all workers are busy, it is queued at the worker
+ * that submits it (if submitted from a job) or at the next worker in turn.
+ * A worker that runs out of jobs steals the oldest job of another worker
+ * before it goes to sleep, so a worker stuck in a long job does not delay the
+ * jobs queued behind it.
+ *
+ * All workers run at the same priority. As RIOT is not time sliced by default,
+ * a handler that never blocks keeps the other workers from running, so more
+ * workers only pay off for jobs that block (see `sys_sched_round_robin`
+ * otherwise).
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #define WORKERS_NUMOF   (4U)
+ *
+ * static event_workqueue_t _wq;
+ * static event_workqueue_worker_t _workers[WORKERS_NUMOF];
+ * static char _stacks[WORKERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+ *
+ * static void _handler(event_t *job)
+ * {
+ *     ...
+ * }
+ *
+ * static event_t _job = { .handler = _handler };
+ *
+ * [...] event_workqueue_init(&_wq, _workers, WORKERS_NUMOF, _stacks[0],
+ *                            sizeof(_stacks[0]), THREAD_PRIORITY_MAIN - 1);
+ * [...] event_workqueue_submit(&_wq, &_job);
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @{
+ *
+ * @file
+ * @brief       Event work queue API
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef EVENT_WORKQUEUE_H
+#define EVENT_WORKQUEUE_H
+
+#include <stddef.h>
+
+#include "event.h"    /* includes core's thread.h */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of workers of a work queue
+ */
+#define EVENT_WORKQUEUE_WORKERS_MAX     (16U)
+
+/**
+ * @brief   Forward declaration of the work queue type
+ */
+typedef struct event_workqueue event_workqueue_t;
+
+/**
+ * @brief   Worker of a work queue
+ */
+typedef struct {
+    event_queue_t queue;        /**< jobs queued at this worker */
+    event_workqueue_t *wq;      /**< work queue the worker belongs to */
+    unsigned handled;           /**< number of jobs handled */
+    unsigned stolen;            /**< number of jobs taken from other workers */
+} event_workqueue_worker_t;
+
+/**
+ * @brief   Work queue
+ */
+struct event_workqueue {
+    event_workqueue_worker_t *workers;  /**< array of the workers */
+    unsigned numof;                     /**< number of workers */
+    unsigned next;                      /**< worker to queue the next job at
+                                         *   if all are busy */
+    unsigned idle;                      /**< bitmap of sleeping workers */
+};
+
+/**
+ * @brief   Starts the workers of a work queue
+ *
+ * Jobs can be submitted right away, they are handled once the workers run.
+ *
+ * @param[out] wq           work queue to initialize
+ * @param[out] workers      @p numof workers
+ * @param[in] numof         number of workers, at most
+ *                          @ref EVENT_WORKQUEUE_WORKERS_MAX
+ * @param[in] stacks        @p numof consecutive stacks of @p stack_size
+ *                          bytes each
+ * @param[in] stack_size    size of a single stack
+ * @param[in] priority      priority of the workers
+ *
+ * @return  0 on success
+ * @return  negative value if a worker could not be started, see
+ *          thread_create()
+ */
+int event_workqueue_init(event_workqueue_t *wq,
+                         event_workqueue_worker_t *workers, unsigned numof,
+                         char *stacks, size_t stack_size, unsigned priority);
+
+/**
+ * @brief   Submits a job to a work queue
+ *
+ * A job that is still queued is not queued a second time. Can be called from
+ * interrupt context.
+ *
+ * @param[in] wq    work queue
+ * @param[in] job   job to submit
+ */
+void event_workqueue_submit(event_workqueue_t *wq, event_t *job);
+
+/**
+ * @brief   Removes a job that was not yet taken by a worker
+ *
+ * @param[in] wq    work queue
+ * @param[in] job   job to remove
+ */
+void event_workqueue_cancel(event_workqueue_t *wq, event_t *job);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVENT_WORKQUEUE_H */
+/** @} */
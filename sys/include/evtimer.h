@@ -31,6 +31,15 @@
  *   example.
  * - uses @ref sys_xtimer "xtimer" as backend
  *
+ * By default, events are kept in a sorted list, so adding and removing an
+ * event takes O(n) with n pending events. With the `evtimer_heap` module,
+ * events are kept in a pairing heap instead: adding is O(1) and removing
+ * O(log n) amortized, at the cost of two more pointers per event. Events
+ * with the same deadline fire in unspecified order then, and an event must
+ * be zero-initialized before it is passed to evtimer_del() for the first
+ * time. Code that needs to look at the pending events uses evtimer_next() and
+ * evtimer_get_offset(), which work with both implementations.
+ *
  * @{
  *
  * @file
@@ -56,7 +65,13 @@ extern "C" {
  */
 typedef struct evtimer_event {
     struct evtimer_event *next; /**< the next event in the queue */
-    uint32_t offset;            /**< offset in milliseconds from previous event */
+#if defined(MODULE_EVTIMER_HEAP) || defined(DOXYGEN)
+    struct evtimer_event *child;    /**< first child in the heap */
+    struct evtimer_event *prev;     /**< previous sibling or parent in the
+                                         heap */
+#endif
+    uint32_t offset;            /**< offset in milliseconds from previous event
+                                     (deadline with `evtimer_heap`) */
 } evtimer_event_t;
 
 /**
@@ -72,6 +87,9 @@ typedef struct {
     evtimer_callback_t callback;    /**< Handler function for this evtimer's
                                          event type */
     evtimer_event_t *events;        /**< Event queue */
+#if defined(MODULE_EVTIMER_HEAP) || defined(DOXYGEN)
+    uint32_t base;                  /**< Reference time for deadlines */
+#endif
 } evtimer_t;
 
 /**
@@ -98,6 +116,33 @@ void evtimer_add(evtimer_t *evtimer, evtimer_event_t *event);
  */
 void evtimer_del(evtimer_t *evtimer, evtimer_event_t *event);
 
+/**
+ * @brief   Iterates over the pending events of an event timer
+ *
+ * The events are visited in unspecified order. The event timer must not be
+ * modified while iterating, e.g. by disabling interrupts or holding the lock
+ * of the thread handling the events.
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     The current event, NULL to get the first one
+ *
+ * @return  The pending event after @p event
+ * @return  NULL, if there are no more events
+ */
+evtimer_event_t *evtimer_next(const evtimer_t *evtimer,
+                              const evtimer_event_t *event);
+
+/**
+ * @brief   Gets the time until a pending event fires
+ *
+ * @param[in] evtimer   An event timer
+ * @param[in] event     A pending event of @p evtimer
+ *
+ * @return  Offset of @p event in milliseconds
+ */
+uint32_t evtimer_get_offset(const evtimer_t *evtimer,
+                            const evtimer_event_t *event);
+
 /**
  * @brief   Print overview of current state of an event timer
  *
@@ -11,6 +11,11 @@
  * @ingroup     net
  * @brief       FIB implementation
  *
+ * With the `fib_trie` module, the entries of single hop tables are indexed by
+ * a prefix trie, so a look-up takes time proportional to the address length
+ * instead of the table size. The trie nodes are shared by all tables, so
+ * `FIB_TRIE_NODES_NUMOF` must be at least twice the total number of entries.
+ *
  * @{
  *
  * @file
@@ -38,7 +38,7 @@ extern "C" {
 /**
  * @brief Container descriptor for a FIB entry
  */
-typedef struct {
+typedef struct fib_entry {
     /** interface ID */
     kernel_pid_t iface_id;
     /** Lifetime of this entry (an absolute time-point is stored by the FIB) */
@@ -51,6 +51,10 @@ typedef struct {
     uint32_t next_hop_flags;
     /** Pointer to the shared generic address */
     universal_address_container_t *next_hop;
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** Next entry with the same prefix in the prefix trie of the table */
+    struct fib_entry *trie_next;
+#endif
 } fib_entry_t;
 
 /**
@@ -133,6 +137,10 @@ typedef struct {
     *   e.g. when the unreachable destination is covered by the prefix
     */
     universal_address_container_t* prefix_rp[FIB_MAX_REGISTERED_RP];
+#if defined(MODULE_FIB_TRIE) || defined(DOXYGEN)
+    /** root of the prefix trie indexing the single hop entries */
+    struct fib_trie_node *trie;
+#endif
 } fib_table_t;
 
 #ifdef __cplusplus
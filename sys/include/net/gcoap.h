@@ -19,9 +19,12 @@
  * response. For a client, gcoap provides a function to send a request, with a
  * callback for reading the server response.
  *
- * gcoap allocates a RIOT message processing thread, so a single instance can
- * serve multiple applications. This approach also means gcoap uses a single UDP
- * port, which supports RFC 6282 compression. Internally, gcoap depends on the
+ * gcoap handles its events on the shared event thread (see
+ * @ref sys_event_thread) at @ref GCOAP_EVENT_PRIO, so a single instance can
+ * serve multiple applications without a thread of its own. With module
+ * `gcoap_thread`, gcoap allocates a RIOT event processing thread instead; use
+ * it if request or response handlers block. This approach also means gcoap
+ * uses a single UDP port, which supports RFC 6282 compression. Internally, gcoap depends on the
  * nanocoap package for base level structs and functionality.
  *
  * gcoap also supports the Observe extension (RFC 7641) for a server. gcoap
@@ -52,6 +55,15 @@
  * gcoap itself defines a resource for `/.well-known/core` discovery, which
  * lists all of the registered paths.
  *
+ * By default, gcoap matches the path of each request against every resource of
+ * every listener. For large resource trees, add the `gcoap_resource_index`
+ * module. It builds a hash index over the resource paths when a listener is
+ * registered and matches requests directly against the Uri-Path options,
+ * without copying the path into a string first. The index holds up to
+ * @ref GCOAP_RESOURCE_INDEX_SIZE resources; gcoap falls back to the linear
+ * search if more resources are registered. Both select the same resource only
+ * if the resources of every listener are ordered by path as described above.
+ *
  * ### Creating a response ###
  *
  * An application resource includes a callback function, a coap_handler_t. After
@@ -180,11 +192,23 @@
  *
  * ### Waiting for a response ###
  *
- * We take advantage of RIOT's asynchronous messaging by using an xtimer to wait
- * for a response, so the gcoap thread does not block while waiting. The user is
- * notified via the same callback, whether the message is received or the wait
- * times out. We track the response with an entry in the
- * `_coap_state.open_reqs` array.
+ * gcoap's events are handled from an @ref event_queue_t. Incoming messages are
+ * signaled by an event of the sock (see @ref net_sock_async_event), and the
+ * wait for a response is limited with an @ref event_timeout_t, so the thread
+ * serving the queue never blocks in the sock. The user is notified via the same callback, whether the
+ * message is received or the wait times out. We track the response with an
+ * entry in the `_coap_state.open_reqs` array.
+ *
+ * ### Receiving messages ###
+ *
+ * With @ref net_gnrc_sock, incoming messages are parsed in place in the packet
+ * buffer (see sock_udp_recv_buf()), which saves copying responses to gcoap's
+ * PDU buffer. Requests do not benefit: the request handler
+ * writes its response to the same buffer it reads the request from, so a
+ * request is still copied to a buffer of @ref GCOAP_PDU_BUF_SIZE bytes and
+ * parsed a second time there. This also holds for each block of a Block1
+ * upload. Other stacks may hand out a message in several chunks, so they copy
+ * every incoming message to that buffer right away.
  *
  * ## Implementation Status ##
  * gcoap includes server and client capability. Available features include:
@@ -222,6 +246,8 @@
 #include "net/sock/udp.h"
 #include "net/nanocoap.h"
 #include "xtimer.h"
+#include "event/callback.h"
+#include "event/timeout.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -233,13 +259,6 @@ extern "C" {
  * @ingroup  config
  * @{
  */
-/**
- * @brief  Size for module message queue
- */
-#ifndef GCOAP_MSG_QUEUE_SIZE
-#define GCOAP_MSG_QUEUE_SIZE    (4)
-#endif
-
 /**
  * @brief   Server port; use RFC 7252 default if not defined
  */
@@ -333,14 +352,6 @@ extern "C" {
  */
 #define GCOAP_SEND_LIMIT_NON    (-1)
 
-/**
- * @ingroup net_gcoap_conf
- * @brief   Time in usec that the event loop waits for an incoming CoAP message
- */
-#ifndef GCOAP_RECV_TIMEOUT
-#define GCOAP_RECV_TIMEOUT      (1 * US_PER_SEC)
-#endif
-
 /**
  * @ingroup net_gcoap_conf
  * @brief   Default time to wait for a non-confirmable response [in usec]
@@ -351,19 +362,6 @@ extern "C" {
 #define GCOAP_NON_TIMEOUT       (5000000U)
 #endif
 
-/**
- * @brief   Identifies waiting timed out for a response to a sent message
- */
-#define GCOAP_MSG_TYPE_TIMEOUT  (0x1501)
-
-/**
- * @brief   Identifies a request to interrupt listening for an incoming message
- *          on a sock
- *
- * Allows the event loop to process IPC messages.
- */
-#define GCOAP_MSG_TYPE_INTR     (0x1502)
-
 /**
  * @ingroup net_gcoap_conf
  * @brief   Maximum number of Observe clients
@@ -435,12 +433,24 @@ extern "C" {
 
 /**
  * @brief Stack size for module thread
+ *
+ * @note    Only used with module `gcoap_thread`.
  */
 #ifndef GCOAP_STACK_SIZE
 #define GCOAP_STACK_SIZE (THREAD_STACKSIZE_DEFAULT + DEBUG_EXTRA_STACKSIZE \
                           + sizeof(coap_pkt_t))
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Queue of the shared event thread gcoap's events are handled from
+ *
+ * @note    Not used with module `gcoap_thread`.
+ */
+#ifndef GCOAP_EVENT_PRIO
+#define GCOAP_EVENT_PRIO        (EVENT_PRIO_MEDIUM)
+#endif
+
 /**
  * @ingroup net_gcoap_conf
  * @brief   Count of PDU buffers available for resending confirmable messages
@@ -449,6 +459,27 @@ extern "C" {
 #define GCOAP_RESEND_BUFS_MAX      (1)
 #endif
 
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Maximum number of resources in the resource index
+ *
+ * Only used with module `gcoap_resource_index`. Includes gcoap's own
+ * `/.well-known/core` resource. Must not exceed 255.
+ */
+#ifndef GCOAP_RESOURCE_INDEX_SIZE
+#define GCOAP_RESOURCE_INDEX_SIZE       (32)
+#endif
+
+/**
+ * @ingroup net_gcoap_conf
+ * @brief   Number of hash buckets of the resource index; must be a power of 2
+ *
+ * Only used with module `gcoap_resource_index`.
+ */
+#ifndef GCOAP_RESOURCE_INDEX_BUCKETS
+#define GCOAP_RESOURCE_INDEX_BUCKETS    (16)
+#endif
+
 /**
  * @brief   A modular collection of resources for a server
  */
@@ -491,8 +522,8 @@ typedef struct {
                                              supports resending message */
     sock_udp_ep_t remote_ep;            /**< Remote endpoint */
     gcoap_resp_handler_t resp_handler;  /**< Callback for the response */
-    xtimer_t response_timer;            /**< Limits wait for response */
-    msg_t timeout_msg;                  /**< For response timer */
+    event_timeout_t resp_evt_tmout;     /**< Limits wait for response */
+    event_callback_t resp_tmout_cb;     /**< Callback for response timeout */
 } gcoap_request_memo_t;
 
 /**
@@ -510,9 +541,11 @@ typedef struct {
  *
  * Must call once before first use.
  *
- * @return  PID of the gcoap thread on success.
- * @return  -EEXIST, if thread already has been created.
- * @return  -EINVAL, if the IP port already is in use.
+ * @return  PID of the gcoap thread on success with module `gcoap_thread`.
+ * @return  KERNEL_PID_UNDEF on success on the shared event thread.
+ * @return  -EEXIST, if gcoap already has been initialized.
+ * @return  -EADDRINUSE, if the IP port already is in use (not reported with
+ *          module `gcoap_thread`).
  */
 kernel_pid_t gcoap_init(void);
 
@@ -732,6 +765,26 @@ int gcoap_get_resource_list(void *buf, size_t maxlen, uint8_t cf);
  */
 int gcoap_add_qstring(coap_pkt_t *pdu, const char *key, const char *val);
 
+/* for testing */
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Finds the resource that handles a request
+ *
+ * Uses the resource index with module `gcoap_resource_index`, the linear
+ * search otherwise.
+ *
+ * @param[in]  pdu          parsed request
+ * @param[out] resource     resource matching path and method of @p pdu
+ * @param[out] listener     listener of @p resource
+ *
+ * @return  0, if a resource was found
+ * @return  -1, if a resource matches the path but not the method
+ * @return  -2, if no resource matches the path
+ */
+int gcoap_find_resource(coap_pkt_t *pdu, const coap_resource_t **resource,
+                        gcoap_listener_t **listener);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
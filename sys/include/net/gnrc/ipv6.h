@@ -144,6 +144,16 @@ extern "C" {
 #define GNRC_IPV6_MSG_QUEUE_SIZE    (8U)
 #endif
 
+/**
+ * @brief   Maximum number of queued messages the IPv6 thread handles per
+ *          wake-up
+ *
+ * @see     msg_receive_bulk()
+ */
+#ifndef GNRC_IPV6_MSG_BULK_SIZE
+#define GNRC_IPV6_MSG_BULK_SIZE     (4U)
+#endif
+
 #ifdef DOXYGEN
 /**
  * @brief   Add a static IPv6 link local address to any network interface
@@ -209,6 +209,34 @@ extern "C" {
 #ifndef GNRC_IPV6_NIB_CONF_MULTIHOP_DAD
 #define GNRC_IPV6_NIB_CONF_MULTIHOP_DAD (0)
 #endif
+
+/**
+ * @brief   Index off-link entries in a prefix trie for longest prefix match
+ *
+ * Makes forwarding table look-ups independent of the number of off-link
+ * entries at the cost of 2 * @ref GNRC_IPV6_NIB_OFFL_NUMOF trie nodes.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_OFFL_TRIE
+#if GNRC_IPV6_NIB_CONF_6LBR
+#define GNRC_IPV6_NIB_CONF_OFFL_TRIE    (1)
+#else
+#define GNRC_IPV6_NIB_CONF_OFFL_TRIE    (0)
+#endif
+#endif
+
+/**
+ * @brief   Index on-link entries by their IPv6 address in a hash table
+ *
+ * Makes neighbor look-ups independent of @ref GNRC_IPV6_NIB_NUMOF at the
+ * cost of two pointers per on-link entry.
+ */
+#ifndef GNRC_IPV6_NIB_CONF_ONL_HASH
+#if GNRC_IPV6_NIB_CONF_ROUTER
+#define GNRC_IPV6_NIB_CONF_ONL_HASH     (1)
+#else
+#define GNRC_IPV6_NIB_CONF_ONL_HASH     (0)
+#endif
+#endif
 /** @} */
 
 /**
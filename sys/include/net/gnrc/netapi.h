@@ -93,6 +93,20 @@ extern "C" {
  */
 #define GNRC_NETAPI_MSG_TYPE_ACK        (0x0205)
 
+/**
+ * @brief   @ref core_msg type for passing a batch of @ref net_gnrc_pkt up the
+ *          network stack with a single message
+ *
+ * @details The message's content is a packet snip whose data is an array of
+ *          pointers to the batched packets (see @ref gnrc_netapi_batch_numof()
+ *          and @ref gnrc_netapi_batch_get()). The receiver holds one reference
+ *          to each of the batched packets and one reference to the batch snip
+ *          itself, which it has to release after it handled all packets.
+ *
+ * @note    0x0206 is already taken by @ref GNRC_NETERR_MSG_TYPE.
+ */
+#define GNRC_NETAPI_MSG_TYPE_RCV_BATCH  (0x0207)
+
 /**
  * @brief   Data structure to be send for setting (@ref GNRC_NETAPI_MSG_TYPE_SET)
  *          and getting (@ref GNRC_NETAPI_MSG_TYPE_GET) options
@@ -215,6 +229,63 @@ static inline int gnrc_netapi_dispatch_receive(gnrc_nettype_t type, uint32_t dem
     return gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV, pkt);
 }
 
+/**
+ * @brief   Sends a batch of packets with a single
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message to all subscribers to
+ *          (@p type, @p demux_ctx).
+ *
+ * The packets themselves are not copied; only an array of @p pkts_numof
+ * pointers is stored in a snip in the packet buffer. Subscribers registered
+ * via a mailbox or a callback are served with one
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV message (or callback) per packet, so only
+ * threads registered by PID need to handle
+ * @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH. If the batch snip can not be
+ * allocated, the packets are dispatched one by one.
+ *
+ * @pre Every subscriber thread to (@p type, @p demux_ctx) handles
+ *      @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH messages.
+ *
+ * @param[in] type          protocol type of the targeted network module.
+ * @param[in] demux_ctx     demultiplexing context for @p type.
+ * @param[in] pkts          packets to dispatch
+ * @param[in] pkts_numof    number of packets in @p pkts
+ *
+ * @return Number of subscribers to (@p type, @p demux_ctx). If there are
+ *         none, the packets are still owned by the caller.
+ */
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *const *pkts,
+                                       unsigned pkts_numof);
+
+/**
+ * @brief   Gets the number of packets in a batch received with
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *
+ * @param[in] batch     the batch snip
+ *
+ * @return  Number of packets in @p batch
+ */
+static inline unsigned gnrc_netapi_batch_numof(const gnrc_pktsnip_t *batch)
+{
+    return batch->size / sizeof(gnrc_pktsnip_t *);
+}
+
+/**
+ * @brief   Gets a packet of a batch received with
+ *          @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH
+ *
+ * @param[in] batch     the batch snip
+ * @param[in] idx       index of the packet; must be less than
+ *                      gnrc_netapi_batch_numof(@p batch)
+ *
+ * @return  The packet at @p idx
+ */
+static inline gnrc_pktsnip_t *gnrc_netapi_batch_get(const gnrc_pktsnip_t *batch,
+                                                    unsigned idx)
+{
+    return ((gnrc_pktsnip_t **)batch->data)[idx];
+}
+
 /**
  * @brief   Shortcut function for sending @ref GNRC_NETAPI_MSG_TYPE_GET messages and
  *          parsing the returned @ref GNRC_NETAPI_MSG_TYPE_ACK message
@@ -14,6 +14,14 @@
  * Network interfaces in the context of GNRC are threads for protocols that are
  * below the network layer.
  *
+ * With module `gnrc_netif_rx_batch` the packets a device driver received while
+ * handling one interrupt (e.g. @ref netdev_tap drains all pending frames) are
+ * passed up with a single @ref GNRC_NETAPI_MSG_TYPE_RCV_BATCH message per
+ * packet type (see @ref gnrc_netapi_dispatch_receive_batch()), at most
+ * @ref GNRC_NETIF_RX_BATCH_SIZE packets at once. All threads subscribed to
+ * the received packet types must handle this message type, as @ref
+ * net_gnrc_ipv6, @ref net_gnrc_udp and @ref net_gnrc_pktdump do.
+ *
  * @{
  *
  * @file
@@ -112,6 +120,21 @@ typedef struct {
 #endif
 #if defined(MODULE_GNRC_SIXLOWPAN) || DOXYGEN
     gnrc_netif_6lo_t sixlo;                 /**< 6Lo component */
+#endif
+#if defined(MODULE_GNRC_NETIF_RX_BATCH) || DOXYGEN
+    /**
+     * @brief   Packets received on the current device interrupt that were not
+     *          passed up yet
+     *
+     * @note    Only available with module `gnrc_netif_rx_batch`.
+     */
+    gnrc_pktsnip_t *rx_batch[GNRC_NETIF_RX_BATCH_SIZE];
+    /**
+     * @brief   Number of packets in gnrc_netif_t::rx_batch
+     *
+     * @note    Only available with module `gnrc_netif_rx_batch`.
+     */
+    uint8_t rx_batch_numof;
 #endif
     uint8_t cur_hl;                         /**< Current hop-limit for out-going packets */
     uint8_t device_type;                    /**< Device type */
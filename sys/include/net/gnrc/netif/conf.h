@@ -137,6 +137,16 @@ extern "C" {
 #define GNRC_NETIF_DEFAULT_HL      (64U)   /**< default hop limit */
 #endif
 
+/**
+ * @brief   Maximum number of packets received on one device interrupt that
+ *          are passed up with a single message
+ *
+ * @note    Only used with module `gnrc_netif_rx_batch`.
+ */
+#ifndef GNRC_NETIF_RX_BATCH_SIZE
+#define GNRC_NETIF_RX_BATCH_SIZE   (8U)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -79,6 +79,20 @@ typedef enum {
  */
 #define GNRC_NETREG_DEMUX_CTX_ALL   (0xffff0000)
 
+/**
+ * @brief   Number of lookup results cached per @ref gnrc_nettype_t
+ *
+ * @details Lookups by @ref gnrc_netreg_num() and @ref gnrc_netreg_lookup()
+ *          are served from a small cache of (type, demux_ctx) results, which
+ *          is flushed for a type whenever an entry of that type is
+ *          (un)registered. Two entries per type cover the common case of the
+ *          lower layer dispatching to @ref GNRC_NETREG_DEMUX_CTX_ALL and the
+ *          protocol's own thread dispatching to a specific demux_ctx.
+ */
+#ifndef GNRC_NETREG_CACHE_SIZE
+#define GNRC_NETREG_CACHE_SIZE      (2U)
+#endif
+
 /**
  * @name    Static entry initialization macros
  * @anchor  net_gnrc_netreg_init_static
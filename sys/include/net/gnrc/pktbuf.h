@@ -18,6 +18,16 @@
  *          this *will* lead to alignment problems and can potentially result
  *          in segmentation/hard faults and other unexpected behaviour.
  *
+ * There are several implementations of the packet buffer to choose from:
+ *
+ * - `gnrc_pktbuf_static` (default): first-fit allocation from a static array
+ *   of @ref GNRC_PKTBUF_SIZE bytes
+ * - `gnrc_pktbuf_sizeclass`: allocation from a static array of
+ *   @ref GNRC_PKTBUF_SIZE bytes with segregated power-of-two size classes
+ *   (buddy system). Allocation and release are independent of the number of
+ *   packets in the buffer at the cost of internal fragmentation.
+ * - `gnrc_pktbuf_malloc`: allocation from the heap via `malloc()`
+ *
  * @{
  *
  * @file
@@ -58,6 +68,19 @@ extern "C" {
 #define GNRC_PKTBUF_SIZE    (6144)
 #endif  /* GNRC_PKTBUF_SIZE */
 
+/**
+ * @def     GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE
+ * @brief   Size of the smallest size class of `gnrc_pktbuf_sizeclass`
+ *
+ * @details Must be a power of two and large enough to hold two pointers.
+ *          Every allocation is rounded up to a power-of-two multiple of this
+ *          value, so it should be chosen to fit a @ref gnrc_pktsnip_t.
+ *          Only relevant if module `gnrc_pktbuf_sizeclass` is used.
+ */
+#ifndef GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE
+#define GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE    (32U)
+#endif
+
 /**
  * @brief   Initializes packet buffer module.
  */
@@ -289,9 +312,35 @@ int gnrc_pktbuf_merge(gnrc_pktsnip_t *pkt);
  *
  * @note    Only available with DEVELHELP defined.
  *
- * @details Statistics include maximum number of reserved bytes.
+ * @details Statistics include maximum number of reserved bytes. With
+ *          `gnrc_pktbuf_sizeclass` the number of free chunks per size class,
+ *          allocation failures and the external fragmentation are printed.
  */
 void gnrc_pktbuf_stats(void);
+
+/**
+ * @brief   Gets the maximum number of bytes that were allocated in the packet
+ *          buffer at the same time
+ *
+ * @note    Only available with DEVELHELP defined. `gnrc_pktbuf_malloc` does
+ *          not keep track of its allocations and always returns 0.
+ *
+ * @details With `gnrc_pktbuf_sizeclass` the allocations are counted in whole
+ *          blocks.
+ *
+ * @return  High-water mark of the packet buffer in bytes since
+ *          initialization resp. the last call of
+ *          @ref gnrc_pktbuf_max_used_reset()
+ */
+size_t gnrc_pktbuf_max_used(void);
+
+/**
+ * @brief   Restarts the high-water mark of @ref gnrc_pktbuf_max_used() at the
+ *          number of bytes currently allocated
+ *
+ * @note    Only available with DEVELHELP defined.
+ */
+void gnrc_pktbuf_max_used_reset(void);
 #endif
 
 /* for testing */
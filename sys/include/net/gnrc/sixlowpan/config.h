@@ -48,6 +48,16 @@ extern "C" {
 #define GNRC_SIXLOWPAN_MSG_QUEUE_SIZE       (8U)
 #endif
 
+/**
+ * @brief   Maximum number of queued messages the 6LoWPAN thread handles per
+ *          wake-up
+ *
+ * @see     msg_receive_bulk()
+ */
+#ifndef GNRC_SIXLOWPAN_MSG_BULK_SIZE
+#define GNRC_SIXLOWPAN_MSG_BULK_SIZE        (4U)
+#endif
+
 /**
  * @brief   Number of datagrams that can be fragmented simultaneously
  *
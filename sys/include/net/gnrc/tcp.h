@@ -22,9 +22,11 @@
 #ifndef NET_GNRC_TCP_H
 #define NET_GNRC_TCP_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "net/gnrc/pkt.h"
 #include "net/gnrc/tcp/tcb.h"
+#include "net/gnrc/tcp/cc.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -52,6 +54,41 @@ int gnrc_tcp_init(void);
  */
 void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb);
 
+/**
+ * @brief Assigns a receive buffer of its own to a TCB.
+ *
+ * By default, a connection takes a buffer of GNRC_TCP_RCV_BUF_SIZE bytes from
+ * a pool of GNRC_TCP_RCV_BUFFERS buffers, that is shared by all connections,
+ * while it is open. A connection with a buffer of its own does not use the
+ * pool and advertises a receive window of up to @p size bytes. The buffer
+ * stays assigned after the connection was closed.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL and the connection must be closed.
+ * @pre @p buf must not be NULL.
+ * @pre @p size must be greater than zero and not exceed UINT16_MAX.
+ *
+ * @param[in,out] tcb    TCB that should use @p buf.
+ * @param[in]     buf    Receive buffer.
+ * @param[in]     size   Size of @p buf in bytes.
+ */
+void gnrc_tcp_tcb_set_rcvbuf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size);
+
+/**
+ * @brief Selects the congestion control of a TCB.
+ *
+ * Connections use GNRC_TCP_CC_DEFAULT unless set otherwise.
+ *
+ * @pre gnrc_tcp_tcb_init() must have been successfully called.
+ * @pre @p tcb must not be NULL and the connection must be closed.
+ * @pre @p cc must not be NULL.
+ *
+ * @param[in,out] tcb   TCB that should use @p cc.
+ * @param[in]     cc    Congestion control, e.g. @ref gnrc_tcp_cc_newreno or
+ *                      @ref gnrc_tcp_cc_cocoa.
+ */
+void gnrc_tcp_tcb_set_cc(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_cc_t *cc);
+
 /**
  * @brief Opens a connection actively.
  *
@@ -122,19 +159,25 @@ int gnrc_tcp_open_passive(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
  * @pre @p data must not be NULL.
  *
  * @note Blocks until up to @p len bytes were transmitted or an error occured.
+ *       Data is sent in up to GNRC_TCP_RTX_QUEUE_SIZE segments in flight, as far as the
+ *       peers receive window allows. The function returns as soon as the last segment
+ *       was sent, without waiting for its acknowledgment. Unacknowledged segments are
+ *       retransmitted in the background.
  *
  * @param[in,out] tcb                        TCB holding the connection information.
  * @param[in]     data                       Pointer to the data that should be transmitted.
  * @param[in]     len                        Number of bytes that should be transmitted.
- * @param[in]     user_timeout_duration_us   If not zero and there was not data transmitted
- *                                           the function returns after user_timeout_duration_us.
+ * @param[in]     user_timeout_duration_us   If not zero, the function returns after
+ *                                           user_timeout_duration_us, even if not all
+ *                                           data was transmitted.
  *                                           If zero, no timeout will be triggered.
  *
  * @returns   The number of successfully transmitted bytes.
  *            -ENOTCONN if connection is not established.
  *            -ECONNRESET if connection was resetted by the peer.
  *            -ECONNABORTED if the connection was aborted.
- *            -ETIMEDOUT if @p user_timeout_duration_us expired.
+ *            -ETIMEDOUT if @p user_timeout_duration_us expired before any data was
+ *                       transmitted.
  */
 ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                       const uint32_t user_timeout_duration_us);
@@ -214,6 +257,40 @@ int gnrc_tcp_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_h
  */
 gnrc_pktsnip_t *gnrc_tcp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src, uint16_t dst);
 
+/**
+ * @brief Prints state, congestion window, RTT estimation and retransmission
+ *        statistics of all open connections to stdout.
+ *
+ * @note  The values of a connection are read under its FSM lock. A connection
+ *        whose FSM is running while this is called is marked as busy, its
+ *        values are read without the lock and may be inconsistent.
+ */
+void gnrc_tcp_stats(void);
+
+/* for testing */
+#if defined(TEST_SUITES) || defined(DOXYGEN)
+/**
+ * @brief   Hook for outgoing segments
+ *
+ * @param[in,out] pkt   Segment to send, starting with the network layer header.
+ *                      The hook may modify the TCP header, the checksum is
+ *                      calculated by the network layer afterwards.
+ *
+ * @return  true, to pass @p pkt on to the network layer.
+ * @return  false, to drop @p pkt.
+ */
+typedef bool (*gnrc_tcp_send_hook_t)(gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief   Sets a hook that sees every outgoing segment, e.g. to inject losses
+ *
+ * @note    Only available for test builds (`TEST_SUITES` defined).
+ *
+ * @param[in] hook   Hook to call from the TCP thread, NULL to remove it.
+ */
+void gnrc_tcp_set_send_hook(gnrc_tcp_send_hook_t hook);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       RIOT's TCP implementation for the GNRC network stack.
+ *
+ * @{
+ *
+ * @file
+ * @brief       GNRC TCP congestion control interface
+ *
+ * Loss detection (retransmission timeout, fast retransmit after
+ * GNRC_TCP_DUP_ACK_THRESHOLD duplicate ACKs, NewReno fast recovery) and the
+ * RTT estimation of RFC 6298 are common to all connections. A congestion
+ * control decides how the congestion window grows with new acknowledgments,
+ * how far it shrinks on loss and how the RTO backs off on timeouts.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef NET_GNRC_TCP_CC_H
+#define NET_GNRC_TCP_CC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Congestion control operations.
+ */
+typedef struct gnrc_tcp_cc {
+    const char *name;   /**< Name of the congestion control */
+
+    /**
+     * @brief Sets the initial cwnd and ssthresh, once the connection is established.
+     *
+     * @param[in,out] tcb   TCB holding the connection information.
+     */
+    void (*init)(gnrc_tcp_tcb_t *tcb);
+
+    /**
+     * @brief Grows cwnd on an ACK for new data, outside of fast recovery.
+     *
+     * @param[in,out] tcb     TCB holding the connection information.
+     * @param[in]     acked   Number of newly acknowledged bytes.
+     */
+    void (*ack)(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+    /**
+     * @brief Sets ssthresh on loss, and cwnd on a retransmission timeout.
+     *
+     * On a fast retransmit, cwnd is set to ssthresh plus the segments that
+     * left the network afterwards.
+     *
+     * @param[in,out] tcb       TCB holding the connection information.
+     * @param[in]     timeout   True on a retransmission timeout, false on a
+     *                          fast retransmit.
+     */
+    void (*loss)(gnrc_tcp_tcb_t *tcb, bool timeout);
+
+    /**
+     * @brief Calculates the RTO for the next retransmission after a timeout.
+     *
+     * @param[in] tcb   TCB holding the connection information.
+     *
+     * @returns   RTO in microseconds.
+     */
+    int32_t (*backoff)(const gnrc_tcp_tcb_t *tcb);
+} gnrc_tcp_cc_t;
+
+/**
+ * @brief NewReno congestion control (RFC 5681, RFC 6582).
+ */
+extern const gnrc_tcp_cc_t gnrc_tcp_cc_newreno;
+
+/**
+ * @brief Delay based congestion control for lossy links.
+ *
+ * Loosely following CoCoA (draft-ietf-core-cocoa), the RTO backs off by a
+ * variable factor: three times for a short RTO, one and a half times for a
+ * long RTO and twice otherwise. The congestion window only grows while the
+ * smoothed RTT stays close to the smallest RTT measured, and a loss without
+ * an increased RTT is taken as a link loss, that shrinks the window by a
+ * quarter only.
+ */
+extern const gnrc_tcp_cc_t gnrc_tcp_cc_cocoa;
+
+/**
+ * @brief Returns the sender maximum segment size of a connection.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Maximum size of the payload of a segment sent.
+ */
+static inline uint32_t gnrc_tcp_cc_smss(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->mss > 0 && tcb->mss < GNRC_TCP_MSS) ? tcb->mss : GNRC_TCP_MSS;
+}
+
+/**
+ * @brief Returns the number of bytes in flight.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Number of bytes sent but not yet acknowledged.
+ */
+static inline uint32_t gnrc_tcp_cc_flight(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->snd_nxt - tcb->snd_una;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_GNRC_TCP_CC_H */
+/** @} */
@@ -68,7 +68,8 @@ extern "C" {
 #endif
 
 /**
- * @brief Number of preallocated receive buffers
+ * @brief Number of receive buffers in the pool shared by all connections
+ *        without a receive buffer of their own
  */
 #ifndef GNRC_TCP_RCV_BUFFERS
 #define GNRC_TCP_RCV_BUFFERS (1U)
@@ -81,6 +82,39 @@ extern "C" {
 #define GNRC_TCP_RCV_BUF_SIZE (GNRC_TCP_DEFAULT_WINDOW)
 #endif
 
+/**
+ * @brief Number of unacknowledged segments a connection keeps for
+ *        retransmission, limits the number of segments in flight
+ */
+#ifndef GNRC_TCP_RTX_QUEUE_SIZE
+#define GNRC_TCP_RTX_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Offer and accept selective acknowledgments (see RFC 2018)
+ *
+ * With SACK in use, segments following a gap are kept until the gap is
+ * filled and the sender retransmits only the segments that are missing.
+ */
+#ifndef GNRC_TCP_SACK
+#define GNRC_TCP_SACK (1)
+#endif
+
+/**
+ * @brief Number of out-of-order segments a connection keeps, if SACK is in use
+ */
+#ifndef GNRC_TCP_OOO_QUEUE_SIZE
+#define GNRC_TCP_OOO_QUEUE_SIZE (4U)
+#endif
+
+/**
+ * @brief Offer and accept the timestamps option for RTT measurement and
+ *        protection against wrapped sequence numbers (see RFC 7323)
+ */
+#ifndef GNRC_TCP_TIMESTAMPS
+#define GNRC_TCP_TIMESTAMPS (1)
+#endif
+
 /**
  * @brief Lower bound for RTO = 1 sec (see RFC 6298)
  */
@@ -123,6 +157,20 @@ extern "C" {
 #define GNRC_TCP_RTO_K (4U)
 #endif
 
+/**
+ * @brief Number of duplicate ACKs that trigger a fast retransmit (see RFC 5681)
+ */
+#ifndef GNRC_TCP_DUP_ACK_THRESHOLD
+#define GNRC_TCP_DUP_ACK_THRESHOLD (3U)
+#endif
+
+/**
+ * @brief Congestion control of a connection, unless set by gnrc_tcp_tcb_set_cc()
+ */
+#ifndef GNRC_TCP_CC_DEFAULT
+#define GNRC_TCP_CC_DEFAULT (&gnrc_tcp_cc_newreno)
+#endif
+
 /**
  * @brief Lower bound for the duration between probes
  */
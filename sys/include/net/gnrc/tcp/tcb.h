@@ -45,6 +45,11 @@ extern "C" {
  */
 #define GNRC_TCP_TCB_MBOX_SIZE (8U)
 
+/**
+ * @brief Forward declaration of the congestion control type.
+ */
+struct gnrc_tcp_cc;
+
 /**
  * @brief Transmission control block of GNRC TCP.
  */
@@ -58,7 +63,7 @@ typedef struct _transmission_control_block {
     uint16_t local_port;   /**< Local connections port number */
     uint16_t peer_port;    /**< Peer connections port number */
     uint8_t state;         /**< Connections state */
-    uint8_t status;        /**< A connections status flags */
+    uint16_t status;       /**< A connections status flags */
     uint32_t snd_una;      /**< Send unacknowledged */
     uint32_t snd_nxt;      /**< Send next */
     uint16_t snd_wnd;      /**< Send window */
@@ -74,12 +79,32 @@ typedef struct _transmission_control_block {
     int32_t srtt;          /**< Smoothed round trip time */
     int32_t rto;           /**< Retransmission timeout duration */
     uint8_t retries;       /**< Number of retransmissions */
+    int32_t rtt_min;       /**< Smallest round trip time measured */
+    uint32_t cwnd;         /**< Congestion window */
+    uint32_t ssthresh;     /**< Slow start threshold */
+    uint32_t cwnd_acked;   /**< Bytes acknowledged since the last increase of cwnd */
+    uint32_t recover;      /**< Send next, when loss recovery started */
+    uint8_t dup_acks;      /**< Number of consecutive duplicate ACKs */
+    const struct gnrc_tcp_cc *cc;   /**< Congestion control */
+    uint32_t retransmits;  /**< Number of retransmitted segments */
+    uint32_t fast_retransmits;      /**< Number of fast retransmits */
+    uint32_t timeouts;     /**< Number of retransmission timeouts */
+    uint32_t rtx_bytes;    /**< Number of retransmitted payload bytes */
+    uint32_t ts_recent;    /**< Timestamp to echo to the peer */
     xtimer_t tim_tout;     /**< Timer struct for timeouts */
     msg_t msg_tout;        /**< Message, sent on timeouts */
-    gnrc_pktsnip_t *pkt_retransmit;   /**< Pointer to packet in "retransmit queue" */
+    uint32_t rtt_seq;      /**< Sequence number acknowledging the timed segment */
+    gnrc_pktsnip_t *rtx_queue[GNRC_TCP_RTX_QUEUE_SIZE + 1];  /**< Unacknowledged segments */
+    uint8_t rtx_head;      /**< Index of the oldest segment in rtx_queue */
+    uint8_t rtx_len;       /**< Number of segments in rtx_queue */
+    uint32_t rtx_sacked;   /**< Bitmap of the rtx_queue slots SACKed by the peer */
+    uint32_t rtx_resent;   /**< Bitmap of the rtx_queue slots resent in this recovery */
+    gnrc_pktsnip_t *ooo_queue[GNRC_TCP_OOO_QUEUE_SIZE];  /**< Out-of-order segments */
+    uint8_t ooo_last;      /**< Index of the latest segment in ooo_queue */
     msg_t mbox_raw[GNRC_TCP_TCB_MBOX_SIZE];   /**< Msg queue for mbox */
     mbox_t mbox;             /**< TCB mbox for synchronization */
     uint8_t *rcv_buf_raw;    /**< Pointer to the receive buffer */
+    uint16_t rcv_buf_size;   /**< Size of a user supplied receive buffer */
     ringbuffer_t rcv_buf;    /**< Receive buffer data structure */
     mutex_t fsm_lock;        /**< Mutex for FSM access synchronization */
     mutex_t function_lock;   /**< Mutex for function call synchronization */
@@ -1097,6 +1097,39 @@ extern ssize_t coap_well_known_core_default_handler(coap_pkt_t *pkt, \
  */
 int coap_match_path(const coap_resource_t *resource, uint8_t *uri);
 
+/**
+ * @brief   Finds the first occurrence of an option in a parsed packet
+ *
+ * @note This function is not intended for application use.
+ * @internal
+ *
+ * @param[in] pkt       packet to search
+ * @param[in] opt_num   option number to look for
+ *
+ * @return  pointer to the option header in the packet buffer
+ * @return  NULL if option was not found
+ */
+uint8_t *coap_find_option(const coap_pkt_t *pkt, unsigned opt_num);
+
+/**
+ * @brief   Iterates over the values of a repeatable option
+ *
+ * @note This function is not intended for application use.
+ * @internal
+ *
+ * @param[in]     pkt       packet to read from
+ * @param[in,out] optpos    position of the current option header, initially
+ *                          the result of coap_find_option(); set to the next
+ *                          option header or NULL if there are no more values
+ * @param[out]    opt_len   length of the option value
+ * @param[in]     first     true for the first call of an iteration
+ *
+ * @return  pointer to the option value
+ * @return  NULL if there are no more values
+ */
+uint8_t *coap_iterate_option(const coap_pkt_t *pkt, uint8_t **optpos,
+                             int *opt_len, int first);
+
 #if defined(MODULE_GCOAP) || defined(DOXYGEN)
 /**
  * @name    Functions -- gcoap specific
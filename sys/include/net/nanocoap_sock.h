@@ -36,9 +36,15 @@
  *
  * For each resource, you must implement a ::coap_handler_t handler function.
  * nanocoap provides functions to help implement the handler. If the handler
- * is called via nanocoap_server(), the response buffer provided to the handler
- * reuses the buffer for the request. So, your handler must read the request
- * thoroughly before writing the response.
+ * is called via nanocoap_server() with @ref net_gnrc_sock, the request is
+ * parsed in place in the packet buffer of the network stack (see
+ * sock_udp_recv_buf()) and the response buffer provided to the handler is the
+ * buffer given to nanocoap_server(). The request stays valid while the handler
+ * writes the response. Other stacks may hand out a request in several chunks
+ * (lwIP) or do not implement sock_udp_recv_buf() (emb6), so with them the
+ * request is copied to that buffer instead and the response overwrites it. A
+ * handler that is used with these stacks must read the request thoroughly
+ * before writing the response.
  *
  * To read the request, use the functions in the _Header_ and _Options Read_
  * sections of the [nanocoap](group__net__nanocoap.html) documentation. If the
@@ -144,7 +150,8 @@ extern "C" {
  * receiving of UDP packets fails.
  *
  * @param[in]   local   local UDP endpoint to bind to
- * @param[in]   buf     input buffer to use
+ * @param[in]   buf     buffer to write responses to, with emb6 requests are
+ *                      received to it as well
  * @param[in]   bufsize size of @p buf
  *
  * @returns     -1 on error
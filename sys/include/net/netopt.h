@@ -662,6 +662,16 @@ typedef enum {
      */
     NETOPT_RX_SYMBOL_TIMEOUT,
 
+    /**
+     * @brief   (@ref netstats_rx_batch_t) get the statistics of a device
+     *          that reads all pending frames on one receive interrupt
+     *
+     * The statistics are copied to the given struct. The average number of
+     * frames per interrupt is netstats_rx_batch_t::frames /
+     * netstats_rx_batch_t::wakeups.
+     */
+    NETOPT_RX_BATCH_STATS,
+
     /* add more options if needed */
 
     /**
@@ -53,6 +53,16 @@ typedef struct {
     uint32_t rx_bytes;          /**< received bytes */
 } netstats_t;
 
+/**
+ * @brief       Receive statistics of a device that reads several frames per
+ *              interrupt (see @ref NETOPT_RX_BATCH_STATS)
+ */
+typedef struct {
+    uint32_t wakeups;           /**< handled receive interrupts */
+    uint32_t frames;            /**< frames read on these interrupts */
+    uint32_t max_batch;         /**< most frames read on one interrupt */
+} netstats_rx_batch_t;
+
 #ifdef __cplusplus
 }
 #endif
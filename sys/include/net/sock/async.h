@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async  Sock extension for asynchronous access
+ * @ingroup     net_sock
+ *
+ * @brief       Callbacks for events on a sock instead of blocking calls
+ *
+ * With module `sock_async` the network stack calls a callback of a sock when
+ * data can be received on it or when data sent with it was handed over to the
+ * stack. The callback runs in the context of the network stack, so it must
+ * not block. Use @ref net_sock_async_event to handle the events in a thread of
+ * your choice instead.
+ *
+ * On @ref SOCK_ASYNC_MSG_RECV, call e.g. sock_udp_recv() with a timeout of
+ * `0` until it returns `-EAGAIN`.
+ *
+ * @note    Currently only implemented by @ref net_gnrc_sock for
+ *          @ref net_sock_ip and @ref net_sock_udp.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous sock API
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef NET_SOCK_ASYNC_H
+#define NET_SOCK_ASYNC_H
+
+#include "net/sock/async/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+/**
+ * @brief   Sets the event callback of a raw IPv4/IPv6 sock
+ *
+ * @pre     `sock != NULL`
+ *
+ * @param[in] sock  a raw IPv4/IPv6 sock created with sock_ip_create()
+ * @param[in] cb    callback, NULL to not be notified anymore
+ */
+void sock_ip_set_cb(struct sock_ip *sock, sock_ip_cb_t cb);
+
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+/**
+ * @brief   Gets the asynchronous context of a raw IPv4/IPv6 sock
+ *
+ * @pre     `sock != NULL`
+ *
+ * @param[in] sock  a raw IPv4/IPv6 sock
+ *
+ * @return  the asynchronous context of @p sock
+ */
+sock_async_ctx_t *sock_ip_get_async_ctx(struct sock_ip *sock);
+#endif
+#endif
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Sets the event callback of a UDP sock
+ *
+ * @pre     `sock != NULL`
+ *
+ * @param[in] sock  a UDP sock created with sock_udp_create()
+ * @param[in] cb    callback, NULL to not be notified anymore
+ */
+void sock_udp_set_cb(struct sock_udp *sock, sock_udp_cb_t cb);
+
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+/**
+ * @brief   Gets the asynchronous context of a UDP sock
+ *
+ * @pre     `sock != NULL`
+ *
+ * @param[in] sock  a UDP sock
+ *
+ * @return  the asynchronous context of @p sock
+ */
+sock_async_ctx_t *sock_udp_get_async_ctx(struct sock_udp *sock);
+#endif
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_H */
+/** @} */
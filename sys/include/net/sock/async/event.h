@@ -0,0 +1,111 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_sock_async_event    Asynchronous sock with event API
+ * @ingroup     net_sock_async
+ *
+ * @brief       Handles the events of socks in an @ref sys_event queue
+ *
+ * Every sock carries an @ref event_t that is posted to an event queue when
+ * something happens on the sock. The handler given to sock_udp_event_init()
+ * (or sock_ip_event_init()) is then called by the thread serving the queue,
+ * with the flags of all events since it was called the last time. Thus a
+ * single thread can serve any number of socks without blocking in any of
+ * them.
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * #include "net/sock/udp.h"
+ * #include "net/sock/async/event.h"
+ *
+ * static event_queue_t _queue;
+ * static sock_udp_t _sock;
+ * static uint8_t _buf[128];
+ *
+ * static void _handler(sock_udp_t *sock, sock_async_flags_t flags)
+ * {
+ *     if (flags & SOCK_ASYNC_MSG_RECV) {
+ *         sock_udp_ep_t remote;
+ *         ssize_t res;
+ *
+ *         while ((res = sock_udp_recv(sock, _buf, sizeof(_buf), 0,
+ *                                     &remote)) >= 0) {
+ *             ...
+ *         }
+ *     }
+ * }
+ *
+ * int main(void)
+ * {
+ *     sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+ *
+ *     local.port = 12345;
+ *     event_queue_init(&_queue);
+ *     sock_udp_create(&_sock, &local, NULL, 0);
+ *     sock_udp_event_init(&_sock, &_queue, _handler);
+ *     event_loop(&_queue);
+ *     return 0;
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * @note    An event may still be queued when the sock is closed. Close a sock
+ *          from the thread serving its queue, or cancel the event with
+ *          `event_cancel(queue, &sock_udp_get_async_ctx(sock)->event.super)`
+ *          before the sock memory is reused.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous sock using @ref sys_event API definitions
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef NET_SOCK_ASYNC_EVENT_H
+#define NET_SOCK_ASYNC_EVENT_H
+
+#include <event.h>   /* not net/sock/async/event.h */
+#include "net/sock/async.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(MODULE_SOCK_IP) || defined(DOXYGEN)
+/**
+ * @brief   Handles the events of a raw IPv4/IPv6 sock in an event queue
+ *
+ * @pre     `(sock != NULL) && (queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock      a raw IPv4/IPv6 sock created with sock_ip_create()
+ * @param[in] queue     queue the events of @p sock are posted to
+ * @param[in] handler   called by the thread serving @p queue
+ */
+void sock_ip_event_init(struct sock_ip *sock, event_queue_t *queue,
+                        sock_ip_cb_t handler);
+#endif
+
+#if defined(MODULE_SOCK_UDP) || defined(DOXYGEN)
+/**
+ * @brief   Handles the events of a UDP sock in an event queue
+ *
+ * @pre     `(sock != NULL) && (queue != NULL) && (handler != NULL)`
+ *
+ * @param[in] sock      a UDP sock created with sock_udp_create()
+ * @param[in] queue     queue the events of @p sock are posted to
+ * @param[in] handler   called by the thread serving @p queue
+ */
+void sock_udp_event_init(struct sock_udp *sock, event_queue_t *queue,
+                         sock_udp_cb_t handler);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_EVENT_H */
+/** @} */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_async
+ * @{
+ *
+ * @file
+ * @brief       Type definitions for asynchronous sock
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef NET_SOCK_ASYNC_TYPES_H
+#define NET_SOCK_ASYNC_TYPES_H
+
+#ifdef SOCK_HAS_ASYNC_CTX
+#include <event.h>   /* not net/sock/async/event.h */
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Flags for sock events
+ *
+ * The flags of several events can be combined in a single callback.
+ */
+typedef enum {
+    SOCK_ASYNC_MSG_RECV = 0x01,     /**< data can be received */
+    SOCK_ASYNC_MSG_SENT = 0x02,     /**< data was handed over to the stack */
+} sock_async_flags_t;
+
+struct sock_ip;     /* forward declaration, see net/sock/ip.h */
+struct sock_udp;    /* forward declaration, see net/sock/udp.h */
+
+/**
+ * @brief   Event callback for @ref sock_ip_t
+ *
+ * @param[in] sock  the sock the event happened on
+ * @param[in] flags the event flags
+ */
+typedef void (*sock_ip_cb_t)(struct sock_ip *sock, sock_async_flags_t flags);
+
+/**
+ * @brief   Event callback for @ref sock_udp_t
+ *
+ * @param[in] sock  the sock the event happened on
+ * @param[in] flags the event flags
+ */
+typedef void (*sock_udp_cb_t)(struct sock_udp *sock, sock_async_flags_t flags);
+
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+/**
+ * @brief   Event of a sock, posted to an @ref event_queue_t
+ */
+typedef struct {
+    event_t super;                  /**< event structure that gets extended */
+    void *sock;                     /**< sock the event happened on */
+    union {
+        sock_ip_cb_t ip;            /**< callback for @ref sock_ip_t */
+        sock_udp_cb_t udp;          /**< callback for @ref sock_udp_t */
+    } cb;                           /**< callback called by the event handler */
+    sock_async_flags_t flags;       /**< flags accumulated since the event
+                                     *   was handled the last time */
+} sock_event_t;
+
+/**
+ * @brief   Asynchronous context of a sock, stored in the sock
+ *
+ * @note    Only available with module `sock_async_event`.
+ */
+typedef struct {
+    sock_event_t event;             /**< event of the sock */
+    event_queue_t *queue;           /**< queue the event is posted to */
+} sock_async_ctx_t;
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NET_SOCK_ASYNC_TYPES_H */
+/** @} */
@@ -402,6 +402,62 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *ep);
 ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
                       uint32_t timeout, sock_udp_ep_t *remote);
 
+/**
+ * @brief   Provides stack-internal buffer space containing a UDP message from
+ *          a remote end point
+ *
+ * Unlike sock_udp_recv() the data is not copied, @p data points into the
+ * packet buffer of the network stack. The buffer is held until the function
+ * is called again with the same @p buf_ctx, which releases it and returns 0.
+ * So always call the function until it returns a value <= 0:
+ *
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ {.c}
+ * void *data, *ctx = NULL;
+ * ssize_t res;
+ *
+ * while ((res = sock_udp_recv_buf(&sock, &data, &ctx, SOCK_NO_TIMEOUT,
+ *                                 &remote)) > 0) {
+ *     // use res bytes at data
+ * }
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ *
+ * A stack may hand out a message in several chunks, every call returns the
+ * next one. Treat the data as read-only.
+ *
+ * @pre `(sock != NULL) && (data != NULL) && (buf_ctx != NULL)`
+ *
+ * @param[in] sock      A UDP sock object.
+ * @param[out] data     Pointer to the stack-internal buffer space containing
+ *                      the received data. NULL when 0 is returned.
+ * @param[in,out] buf_ctx   Stack-internal buffer context. Must be NULL on the
+ *                      first call for a message and is NULL again when 0 is
+ *                      returned.
+ * @param[in] timeout   Timeout for receive in microseconds.
+ *                      If 0 and no data is available, the function returns
+ *                      immediately.
+ *                      May be @ref SOCK_NO_TIMEOUT for no timeout (wait until
+ *                      data is available).
+ * @param[out] remote   Remote end point of the received data.
+ *                      May be `NULL`, if it is not required by the application.
+ *
+ * @note    @ref net_gnrc_sock always hands out a message in a single chunk,
+ *          lwIP hands out one chunk per pbuf. Not implemented by emb6.
+ *
+ * @return  The number of bytes at @p data on success.
+ * @return  0, if no more data is available for the message and the buffer
+ *          was released (or the message was empty).
+ * @return  -EADDRNOTAVAIL, if local of @p sock is not given.
+ * @return  -EAGAIN, if @p timeout is `0` and no data is available.
+ * @return  -EINVAL, if @p remote is invalid or @p sock is not properly
+ *          initialized (or closed while sock_udp_recv_buf() blocks).
+ * @return  -ENOMEM, if no memory was available to receive @p data.
+ * @return  -EPROTO, if source address of received packet did not equal
+ *          the remote of @p sock.
+ * @return  -ETIMEDOUT, if @p timeout expired.
+ */
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote);
+
 /**
  * @brief   Sends a UDP message to remote end point
  *
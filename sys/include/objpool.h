@@ -0,0 +1,146 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_objpool Lock-free object pool
+ * @ingroup     sys_memory_management
+ * @brief       Fixed-size blocks allocated from and freed to a static array
+ *              without locking
+ *
+ * Like @ref sys_memarray, an object pool hands out blocks of a fixed size
+ * from a user provided array. The free blocks form a stack that is modified
+ * with a single atomic compare-and-swap, so objpool_alloc() and objpool_free()
+ * can be called concurrently from any number of threads and from interrupt
+ * context without disabling interrupts or taking a mutex.
+ *
+ * The head of the stack holds the index of the first free block together
+ * with a tag that is incremented on every change, so a thread preempted in
+ * the middle of an allocation can not corrupt the stack if the same block
+ * was allocated and freed again meanwhile (ABA problem). Thus a pool holds at
+ * most 65535 blocks. CPUs without native compare-and-swap fall back to the
+ * emulation in `atomic_c11.c`, which disables interrupts for the swap only.
+ *
+ * Every pool counts the blocks in use, the maximum number of blocks that were
+ * in use at the same time and the number of failed allocations, to help
+ * dimensioning the pool.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Object pool interface definition
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef OBJPOOL_H
+#define OBJPOOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Maximum number of blocks of a pool
+ */
+#define OBJPOOL_NUMOF_MAX   (UINT16_MAX)
+
+/**
+ * @brief   Object pool
+ *
+ * @note    All members are private, use the functions below
+ */
+typedef struct {
+    uint8_t *data;          /**< array of the blocks */
+    size_t size;            /**< size of a single block */
+    uint16_t num;           /**< number of blocks */
+    uint32_t head;          /**< tag (upper half) and index + 1 (lower half)
+                             *   of the first free block, 0 if empty */
+    unsigned used;          /**< number of allocated blocks */
+    unsigned max_used;      /**< high-water mark of @p used */
+    unsigned failed;        /**< number of failed allocations */
+} objpool_t;
+
+/**
+ * @brief   Initializes a pool
+ *
+ * @pre     `size >= sizeof(uint16_t)`
+ * @pre     `0 < num <= OBJPOOL_NUMOF_MAX`
+ *
+ * @param[out] pool     pool to initialize
+ * @param[in] data      array of @p num blocks
+ * @param[in] size      size of a single block
+ * @param[in] num       number of blocks in @p data
+ */
+void objpool_init(objpool_t *pool, void *data, size_t size, size_t num);
+
+/**
+ * @brief   Allocates a block
+ *
+ * @param[in,out] pool  pool to allocate from
+ *
+ * @return  pointer to the block
+ * @return  NULL if all blocks are in use
+ */
+void *objpool_alloc(objpool_t *pool);
+
+/**
+ * @brief   Returns a block to its pool
+ *
+ * @pre     @p ptr was allocated from @p pool
+ *
+ * @param[in,out] pool  pool the block was allocated from
+ * @param[in] ptr       block to free
+ */
+void objpool_free(objpool_t *pool, void *ptr);
+
+/**
+ * @brief   Returns the number of blocks in use
+ *
+ * @param[in] pool  a pool
+ *
+ * @return  number of blocks in use
+ */
+static inline unsigned objpool_used(const objpool_t *pool)
+{
+    return __atomic_load_n(&pool->used, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief   Returns the maximum number of blocks that were in use at once
+ *
+ * @param[in] pool  a pool
+ *
+ * @return  high-water mark of the blocks in use
+ */
+static inline unsigned objpool_max_used(const objpool_t *pool)
+{
+    return __atomic_load_n(&pool->max_used, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief   Returns the number of allocations that failed as the pool was
+ *          exhausted
+ *
+ * @param[in] pool  a pool
+ *
+ * @return  number of failed allocations
+ */
+static inline unsigned objpool_failed(const objpool_t *pool)
+{
+    return __atomic_load_n(&pool->failed, __ATOMIC_RELAXED);
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* OBJPOOL_H */
+/** @} */
@@ -0,0 +1,114 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_round_robin Round robin scheduling
+ * @ingroup     sys
+ * @brief       Time slicing among threads of the same priority
+ *
+ * The scheduler never preempts a thread in favor of a thread of the same
+ * priority, so a thread that does not block or yield starves its peers. With
+ * this module, a thread that runs while other threads of its priority are
+ * ready is preempted after its quantum expired: it is moved to the end of its
+ * runqueue, just as if it had called thread_yield(). Threads of other
+ * priorities are not affected. A thread preempted by a thread of higher
+ * priority resumes the rest of its quantum afterwards, a thread that blocked
+ * starts with a full quantum once it is ready again.
+ *
+ * The quantum is timed with @ref sys_xtimer "xtimer", which is only armed
+ * while the running thread has peers of the same priority. Every thread gets
+ * a quantum of @ref SCHED_ROUND_ROBIN_QUANTUM, which can be changed per thread
+ * with sched_round_robin_set_quantum().
+ *
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling interface definition
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef SCHED_ROUND_ROBIN_H
+#define SCHED_ROUND_ROBIN_H
+
+#include <stdint.h>
+
+#include "kernel_types.h"
+#include "thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Default quantum of a thread in microseconds
+ */
+#ifndef SCHED_ROUND_ROBIN_QUANTUM
+#define SCHED_ROUND_ROBIN_QUANTUM       (10000U)
+#endif
+
+/**
+ * @brief   Quantum of threads that must never be preempted by their peers
+ */
+#define SCHED_ROUND_ROBIN_NO_PREEMPT    (UINT32_MAX)
+
+/**
+ * @brief   Initializes round robin scheduling
+ *
+ * Called by auto_init after xtimer was initialized. No thread is preempted
+ * before.
+ */
+void sched_round_robin_init(void);
+
+/**
+ * @brief   Sets the quantum of a thread
+ *
+ * The new quantum takes effect the next time the thread is scheduled.
+ * Threads start with @ref SCHED_ROUND_ROBIN_QUANTUM when they are created.
+ *
+ * @param[in] pid       The thread
+ * @param[in] quantum   The time in microseconds the thread may run before one
+ *                      of its peers is scheduled, 0 for
+ *                      @ref SCHED_ROUND_ROBIN_QUANTUM or
+ *                      @ref SCHED_ROUND_ROBIN_NO_PREEMPT
+ */
+void sched_round_robin_set_quantum(kernel_pid_t pid, uint32_t quantum);
+
+/**
+ * @brief   Gets the quantum of a thread
+ *
+ * @param[in] pid   The thread
+ *
+ * @return  The quantum of the thread in microseconds
+ */
+uint32_t sched_round_robin_get_quantum(kernel_pid_t pid);
+
+/**
+ * @brief   Called by the scheduler when @p thread is scheduled
+ *
+ * @internal
+ *
+ * @param[in] thread    The thread that runs next
+ */
+void sched_round_robin_switch(thread_t *thread);
+
+/**
+ * @brief   Called by the scheduler when @p thread was put on its runqueue
+ *
+ * @internal
+ *
+ * @param[in] thread    The thread that became ready
+ */
+void sched_round_robin_ready(thread_t *thread);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_ROUND_ROBIN_H */
+/** @} */
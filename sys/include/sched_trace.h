@@ -0,0 +1,236 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    sys_sched_trace Scheduler trace
+ * @ingroup     sys
+ * @brief       Records context switches, interrupts and messages in a ring
+ *
+ * Every context switch, interrupt entry and exit (if the CPU implementation
+ * reports them) and every message sent or received is recorded together with
+ * an @ref sys_xtimer "xtimer" timestamp in a ring of @ref SCHED_TRACE_SIZE
+ * entries. Once the ring is full, the oldest entries are overwritten, so the
+ * ring always holds the most recent history of the system.
+ *
+ * Recording an event takes a timestamp and copies 12 bytes with interrupts
+ * disabled, so tracing is cheap enough to stay enabled while measuring. The
+ * ring can be written out as a binary stream with sched_trace_dump(). On
+ * `native` the shell command `schedtrace dump <file>` writes that stream to a
+ * file on the host, which `dist/tools/sched_trace/sched_trace2chrome.py`
+ * converts into a Chrome trace (`chrome://tracing`, Perfetto), giving the
+ * time each thread was running, the interrupts and the messages between
+ * threads.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Scheduler trace interface definition
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef SCHED_TRACE_H
+#define SCHED_TRACE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "kernel_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief   Number of entries in the trace ring
+ *
+ * @note    Must be a power of two
+ */
+#ifndef SCHED_TRACE_SIZE
+#define SCHED_TRACE_SIZE        (256U)
+#endif
+
+#if (SCHED_TRACE_SIZE & (SCHED_TRACE_SIZE - 1)) != 0
+#error "SCHED_TRACE_SIZE must be a power of two"
+#endif
+
+/**
+ * @brief   Magic number at the beginning of a dump ("RTRC" little endian)
+ */
+#define SCHED_TRACE_MAGIC       (0x43525452UL)
+
+/**
+ * @brief   Version of the dump format
+ */
+#define SCHED_TRACE_VERSION     (1U)
+
+/**
+ * @brief   Length of thread names in a dump, including the terminating zero
+ */
+#define SCHED_TRACE_NAME_LEN    (14U)
+
+/**
+ * @brief   Traced events
+ */
+enum {
+    SCHED_TRACE_SWITCH      = 0,    /**< context switch from a to b */
+    SCHED_TRACE_IRQ_ENTER   = 1,    /**< interrupt value entered */
+    SCHED_TRACE_IRQ_EXIT    = 2,    /**< interrupt value left */
+    SCHED_TRACE_MSG_SEND    = 3,    /**< a sent message of type value to b */
+    SCHED_TRACE_MSG_RECV    = 4,    /**< a received message of type value
+                                     *   from b */
+};
+
+/**
+ * @brief   A trace entry
+ *
+ * For @ref SCHED_TRACE_SWITCH events, @p info holds the status the previous
+ * thread was left in (e.g. STATUS_RECEIVE_BLOCKED), so the reason of the
+ * switch can be told. @ref KERNEL_PID_ISR in @p a denotes a message sent from
+ * interrupt context, @ref KERNEL_PID_UNDEF denotes no thread.
+ */
+typedef struct {
+    uint32_t time;      /**< xtimer ticks of the event */
+    uint8_t event;      /**< event type */
+    uint8_t info;       /**< event specific information */
+    kernel_pid_t a;     /**< thread the event originates from */
+    kernel_pid_t b;     /**< thread the event is directed to */
+    uint16_t value;     /**< message type or interrupt number */
+} sched_trace_entry_t;
+
+/**
+ * @brief   Header of a dump
+ *
+ * The header is followed by @p names_numof thread names of
+ * (sizeof(kernel_pid_t) + @ref SCHED_TRACE_NAME_LEN) bytes each (pid first)
+ * and @p numof entries of @p entry_size bytes each, oldest first. All fields
+ * are in host byte order.
+ */
+typedef struct {
+    uint32_t magic;         /**< @ref SCHED_TRACE_MAGIC */
+    uint16_t version;       /**< @ref SCHED_TRACE_VERSION */
+    uint16_t entry_size;    /**< sizeof(sched_trace_entry_t) */
+    uint32_t hz;            /**< frequency of the timestamps */
+    uint16_t names_numof;   /**< number of thread names following */
+    uint16_t numof;         /**< number of entries following the names */
+} sched_trace_hdr_t;
+
+/**
+ * @brief   Output function used for dumps
+ *
+ * @param[in] buf   data to write
+ * @param[in] len   length of @p buf
+ * @param[in] arg   argument given to sched_trace_dump()
+ */
+typedef void (*sched_trace_write_t)(const void *buf, size_t len, void *arg);
+
+/**
+ * @brief   Initializes the trace ring and starts recording
+ *
+ * @note    Called by auto_init after xtimer was initialized
+ */
+void sched_trace_init(void);
+
+/**
+ * @brief   Starts or stops recording
+ *
+ * @param[in] enable    true to record events
+ */
+void sched_trace_enable(bool enable);
+
+/**
+ * @brief   Drops all recorded entries
+ */
+void sched_trace_clear(void);
+
+/**
+ * @brief   Records an event
+ *
+ * @param[in] event     event type
+ * @param[in] info      event specific information
+ * @param[in] a         thread the event originates from
+ * @param[in] b         thread the event is directed to
+ * @param[in] value     message type or interrupt number
+ */
+void sched_trace_record(uint8_t event, uint8_t info, kernel_pid_t a,
+                        kernel_pid_t b, uint16_t value);
+
+/**
+ * @brief   Records an interrupt entry
+ *
+ * To be called by the CPU implementation before an interrupt handler runs.
+ *
+ * @param[in] irq       interrupt number
+ */
+static inline void sched_trace_irq_enter(unsigned irq)
+{
+    sched_trace_record(SCHED_TRACE_IRQ_ENTER, 0, KERNEL_PID_UNDEF,
+                       KERNEL_PID_UNDEF, irq);
+}
+
+/**
+ * @brief   Records an interrupt exit
+ *
+ * To be called by the CPU implementation after an interrupt handler ran.
+ *
+ * @param[in] irq       interrupt number
+ */
+static inline void sched_trace_irq_exit(unsigned irq)
+{
+    sched_trace_record(SCHED_TRACE_IRQ_EXIT, 0, KERNEL_PID_UNDEF,
+                       KERNEL_PID_UNDEF, irq);
+}
+
+/**
+ * @brief   Copies recorded entries, oldest first
+ *
+ * @param[out] buf      buffer for the entries
+ * @param[in] max       size of @p buf in entries
+ *
+ * @return  number of entries copied
+ */
+unsigned sched_trace_get(sched_trace_entry_t *buf, unsigned max);
+
+/**
+ * @brief   Writes the ring as binary stream
+ *
+ * Recording is suspended while dumping and the ring is cleared afterwards.
+ *
+ * @param[in] write     output function
+ * @param[in] arg       argument for @p write
+ *
+ * @return  number of entries written
+ */
+unsigned sched_trace_dump(sched_trace_write_t write, void *arg);
+
+/**
+ * @brief   Prints the recorded entries in human readable form, oldest first
+ */
+void sched_trace_print(void);
+
+#if defined(CPU_NATIVE) || defined(DOXYGEN)
+/**
+ * @brief   Writes the ring as binary stream into a file on the host
+ *
+ * @note    Only available on `native`
+ *
+ * @param[in] path      path of the file
+ *
+ * @return  number of entries written
+ * @return  -errno on error
+ */
+int sched_trace_dump_file(const char *path);
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SCHED_TRACE_H */
+/** @} */
@@ -154,6 +154,45 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c);
  */
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n);
 
+/**
+ * @brief       Get the largest contiguous free region of the ringbuffer
+ *
+ * Bytes can be written directly into the region, e.g. by DMA, and are made
+ * available for reading with @ref tsrb_commit().
+ *
+ * @note        Only the single producer of the ringbuffer may call this
+ *              function.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the free region
+ * @return      nr of bytes that fit in @p region, 0 if @p rb is full
+ */
+unsigned tsrb_reserve(tsrb_t *rb, uint8_t **region);
+
+/**
+ * @brief       Make bytes written to a region obtained by @ref tsrb_reserve()
+ *              available for reading
+ * @param[in]   rb  Ringbuffer to operate on
+ * @param[in]   n   nr of bytes written, at most the size of the region
+ */
+void tsrb_commit(tsrb_t *rb, size_t n);
+
+/**
+ * @brief       Get the largest contiguous region of bytes available for
+ *              reading, without removing them
+ *
+ * The bytes can be read or parsed in place and are removed with
+ * @ref tsrb_drop() afterwards.
+ *
+ * @note        Only the single consumer of the ringbuffer may call this
+ *              function.
+ *
+ * @param[in]   rb      Ringbuffer to operate on
+ * @param[out]  region  start of the region
+ * @return      nr of bytes in @p region, 0 if @p rb is empty
+ */
+unsigned tsrb_peek_region(const tsrb_t *rb, uint8_t **region);
+
 #ifdef __cplusplus
 }
 #endif
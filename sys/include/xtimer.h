@@ -20,6 +20,13 @@
  * number of active timers.  The reason for this is that multiplexing is
  * realized by next-first singly linked lists.
  *
+ * With the (pseudo) module `xtimer_heap` the timer lists are replaced by
+ * pairing heaps. Insertion is O(1) and removal is O(log n) amortized, which
+ * bounds the time spent with interrupts disabled when many timers are
+ * active. This comes at the cost of two additional pointers per @ref xtimer_t.
+ * Timers that could not be fired before the end of a low-level timer period
+ * fire right at the start of the next one.
+ *
  * @{
  * @file
  * @brief   xtimer interface definitions
@@ -69,6 +76,12 @@ typedef void (*xtimer_callback_t)(void*);
  */
 typedef struct xtimer {
     struct xtimer *next;         /**< reference to next timer in timer lists */
+#if defined(MODULE_XTIMER_HEAP) || defined(DOXYGEN)
+    struct xtimer *child;        /**< first child in timer heap
+                                      (only with module `xtimer_heap`) */
+    struct xtimer *prev;         /**< parent or previous sibling in timer heap
+                                      (only with module `xtimer_heap`) */
+#endif
     uint32_t target;             /**< lower 32bit absolute target time */
     uint32_t long_target;        /**< upper 32bit absolute target time */
     xtimer_callback_t callback;  /**< callback function to call when timer
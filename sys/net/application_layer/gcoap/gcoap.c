@@ -13,7 +13,8 @@
  * @file
  * @brief       GNRC's implementation of CoAP protocol
  *
- * Runs a thread (_pid) to manage request/response messaging.
+ * Serves an event queue of the shared event thread (or of its own thread
+ * _pid with module gcoap_thread) to manage request/response messaging.
  *
  * @author      Ken Bannister <kb2ma@runbox.com>
  */
@@ -24,7 +25,11 @@
 #include <string.h>
 
 #include "assert.h"
+#ifndef MODULE_GCOAP_THREAD
+#include "event/thread.h"
+#endif
 #include "net/gcoap.h"
+#include "net/sock/async/event.h"
 #include "net/sock/util.h"
 #include "mutex.h"
 #include "random.h"
@@ -39,7 +44,12 @@
 #define GCOAP_RESOURCE_NO_PATH -2
 
 /* Internal functions */
+static int _sock_init(void);
+#ifdef MODULE_GCOAP_THREAD
 static void *_event_loop(void *arg);
+#endif
+static void _on_sock_evt(sock_udp_t *sock, sock_async_flags_t flags);
+static void _on_resp_timeout(void *arg);
 static void _listen(sock_udp_t *sock);
 static ssize_t _well_known_core_handler(coap_pkt_t* pdu, uint8_t *buf, size_t len, void *ctx);
 static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
@@ -54,6 +64,12 @@ static int _find_obs_memo(gcoap_observe_memo_t **memo, sock_udp_ep_t *remote,
                                                        coap_pkt_t *pdu);
 static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
                                    const coap_resource_t *resource);
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+static void _index_add_listener(gcoap_listener_t *listener);
+static int _index_find_resource(coap_pkt_t *pdu,
+                                const coap_resource_t **resource_ptr,
+                                gcoap_listener_t **listener_ptr);
+#endif
 
 /* Internal variables */
 const coap_resource_t _default_resources[] = {
@@ -90,20 +106,58 @@ static gcoap_state_t _coap_state = {
     .listeners   = &_default_listener,
 };
 
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+#define _INDEX_NONE         (UINT8_MAX)
+
+#if GCOAP_RESOURCE_INDEX_SIZE >= _INDEX_NONE
+#error "GCOAP_RESOURCE_INDEX_SIZE must be less than 255"
+#endif
+
+#if (GCOAP_RESOURCE_INDEX_BUCKETS & (GCOAP_RESOURCE_INDEX_BUCKETS - 1))
+#error "GCOAP_RESOURCE_INDEX_BUCKETS must be a power of 2"
+#endif
+
+/* Entry of the resource index */
+typedef struct {
+    const coap_resource_t *resource;    /* Indexed resource */
+    gcoap_listener_t *listener;         /* Listener of the resource */
+    uint32_t hash;                      /* Hash of the path; unused for
+                                           COAP_MATCH_SUBTREE resources */
+    uint32_t rank;                      /* Position of the resource in the
+                                           list of listeners; the lowest rank
+                                           wins */
+    uint8_t next;                       /* Next entry in the same chain */
+} _index_entry_t;
+
+/* Index over all registered resources. Exact paths are chained per hash
+ * bucket, COAP_MATCH_SUBTREE resources in a single chain. */
+typedef struct {
+    _index_entry_t entries[GCOAP_RESOURCE_INDEX_SIZE];
+    uint8_t buckets[GCOAP_RESOURCE_INDEX_BUCKETS];
+    uint8_t subtrees;
+    uint8_t len;                        /* Number of used entries */
+    uint16_t listeners;                 /* Number of indexed listeners */
+    bool overflow;                      /* Index incomplete, use linear search */
+} _index_t;
+
+static _index_t _index;
+#endif
+
+#ifdef MODULE_GCOAP_THREAD
 static kernel_pid_t _pid = KERNEL_PID_UNDEF;
 static char _msg_stack[GCOAP_STACK_SIZE];
-static msg_t _msg_queue[GCOAP_MSG_QUEUE_SIZE];
+static event_queue_t _thread_queue;
+#endif
+/* queue gcoap's events are handled from, NULL until gcoap_init() */
+static event_queue_t *_queue;
 static sock_udp_t _sock;
+/* buffer for incoming messages and responses; only used by the thread
+ * serving _queue, kept off its stack as that may be the shared event thread */
+static uint8_t _listen_buf[GCOAP_PDU_BUF_SIZE];
 
-
-/* Event/Message loop for gcoap _pid thread. */
-static void *_event_loop(void *arg)
+/* Creates the sock and signals its messages to _queue. */
+static int _sock_init(void)
 {
-    msg_t msg_rcvd;
-    (void)arg;
-
-    msg_init_queue(_msg_queue, GCOAP_MSG_QUEUE_SIZE);
-
     sock_udp_ep_t local;
     memset(&local, 0, sizeof(sock_udp_ep_t));
     local.family = AF_INET6;
@@ -113,84 +167,79 @@ static void *_event_loop(void *arg)
     int res = sock_udp_create(&_sock, &local, NULL, 0);
     if (res < 0) {
         DEBUG("gcoap: cannot create sock: %d\n", res);
-        return 0;
+        return res;
     }
+    sock_udp_event_init(&_sock, _queue, _on_sock_evt);
+    return 0;
+}
 
-    while(1) {
-        res = msg_try_receive(&msg_rcvd);
-
-        if (res > 0) {
-            switch (msg_rcvd.type) {
-            case GCOAP_MSG_TYPE_TIMEOUT: {
-                gcoap_request_memo_t *memo = (gcoap_request_memo_t *)msg_rcvd.content.ptr;
-
-                /* no retries remaining */
-                if ((memo->send_limit == GCOAP_SEND_LIMIT_NON)
-                        || (memo->send_limit == 0)) {
-                    _expire_request(memo);
-                }
-                /* reduce retries remaining, double timeout and resend */
-                else {
-                    memo->send_limit--;
-                    unsigned i        = COAP_MAX_RETRANSMIT - memo->send_limit;
-                    uint32_t timeout  = ((uint32_t)COAP_ACK_TIMEOUT << i) * US_PER_SEC;
-                    uint32_t variance = ((uint32_t)COAP_ACK_VARIANCE << i) * US_PER_SEC;
-                    timeout = random_uint32_range(timeout, timeout + variance);
-
-                    ssize_t bytes = sock_udp_send(&_sock, memo->msg.data.pdu_buf,
-                                                  memo->msg.data.pdu_len,
-                                                  &memo->remote_ep);
-                    if (bytes > 0) {
-                        xtimer_set_msg(&memo->response_timer, timeout,
-                                       &memo->timeout_msg, _pid);
-                    }
-                    else {
-                        DEBUG("gcoap: sock resend failed: %d\n", (int)bytes);
-                        _expire_request(memo);
-                    }
-                }
-                break;
-            }
-            default:
-                break;
-            }
-        }
+#ifdef MODULE_GCOAP_THREAD
+/* Event loop for gcoap _pid thread. */
+static void *_event_loop(void *arg)
+{
+    (void)arg;
 
-        _listen(&_sock);
+    event_queue_claim(_queue);
+    if (_sock_init() < 0) {
+        return 0;
     }
+    event_loop(_queue);
 
     return 0;
 }
+#endif
 
-/* Listen for an incoming CoAP message. */
-static void _listen(sock_udp_t *sock)
+/* Handles sock events on the thread serving _queue. */
+static void _on_sock_evt(sock_udp_t *sock, sock_async_flags_t flags)
 {
-    coap_pkt_t pdu;
-    uint8_t buf[GCOAP_PDU_BUF_SIZE];
-    sock_udp_ep_t remote;
-    gcoap_request_memo_t *memo = NULL;
-    uint8_t open_reqs = gcoap_op_state();
-
-    /* We expect a -EINTR response here when unlimited waiting (SOCK_NO_TIMEOUT)
-     * is interrupted when sending a message in gcoap_req_send(). While a
-     * request is outstanding, sock_udp_recv() is called here with limited
-     * waiting so the request's timeout can be handled in a timely manner in
-     * _event_loop(). */
-    ssize_t res = sock_udp_recv(sock, buf, sizeof(buf),
-                                open_reqs > 0 ? GCOAP_RECV_TIMEOUT : SOCK_NO_TIMEOUT,
-                                &remote);
-    if (res <= 0) {
-#if ENABLE_DEBUG
-        if (res < 0 && res != -ETIMEDOUT) {
-            DEBUG("gcoap: udp recv failure: %d\n", res);
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        _listen(sock);
+    }
+}
+
+/* Handles response timeout for a request; resend confirmable if needed. */
+static void _on_resp_timeout(void *arg)
+{
+    gcoap_request_memo_t *memo = (gcoap_request_memo_t *)arg;
+
+    /* no retries remaining */
+    if ((memo->send_limit == GCOAP_SEND_LIMIT_NON)
+            || (memo->send_limit == 0)) {
+        _expire_request(memo);
+    }
+    /* reduce retries remaining, double timeout and resend */
+    else {
+        memo->send_limit--;
+        unsigned i        = COAP_MAX_RETRANSMIT - memo->send_limit;
+        uint32_t timeout  = ((uint32_t)COAP_ACK_TIMEOUT << i) * US_PER_SEC;
+        uint32_t variance = ((uint32_t)COAP_ACK_VARIANCE << i) * US_PER_SEC;
+        timeout = random_uint32_range(timeout, timeout + variance);
+
+        ssize_t bytes = sock_udp_send(&_sock, memo->msg.data.pdu_buf,
+                                      memo->msg.data.pdu_len,
+                                      &memo->remote_ep);
+        if (bytes > 0) {
+            event_timeout_set(&memo->resp_evt_tmout, timeout);
+        }
+        else {
+            DEBUG("gcoap: sock resend failed: %d\n", (int)bytes);
+            _expire_request(memo);
         }
-#endif
-        return;
     }
+}
 
-    res = coap_parse(&pdu, buf, res);
+/* Processes a single incoming CoAP message. The message is parsed where it
+ * was received; a request is copied to buf unless it is there already, as
+ * the response is written over it. */
+static void _process(sock_udp_t *sock, uint8_t *msg, size_t msg_len,
+                     uint8_t *buf, size_t len, sock_udp_ep_t *remote)
+{
+    coap_pkt_t pdu;
+    gcoap_request_memo_t *memo = NULL;
+
+    int res = coap_parse(&pdu, msg, msg_len);
     if (res < 0) {
-        DEBUG("gcoap: parse failure: %d\n", (int)res);
+        DEBUG("gcoap: parse failure: %d\n", res);
         /* If a response, can't clear memo, but it will timeout later. */
         return;
     }
@@ -206,9 +255,17 @@ static void _listen(sock_udp_t *sock)
     case COAP_CLASS_REQ:
         if (coap_get_type(&pdu) == COAP_TYPE_NON
                 || coap_get_type(&pdu) == COAP_TYPE_CON) {
-            size_t pdu_len = _handle_req(&pdu, buf, sizeof(buf), &remote);
+            if (msg_len > len) {
+                DEBUG("gcoap: request too large: %u\n", (unsigned)msg_len);
+                return;
+            }
+            if (msg != buf) {
+                memcpy(buf, msg, msg_len);
+                coap_parse(&pdu, buf, msg_len);
+            }
+            size_t pdu_len = _handle_req(&pdu, buf, len, remote);
             if (pdu_len > 0) {
-                ssize_t bytes = sock_udp_send(sock, buf, pdu_len, &remote);
+                ssize_t bytes = sock_udp_send(sock, buf, pdu_len, remote);
                 if (bytes <= 0) {
                     DEBUG("gcoap: send response failed: %d\n", (int)bytes);
                 }
@@ -223,15 +280,17 @@ static void _listen(sock_udp_t *sock)
     case COAP_CLASS_SUCCESS:
     case COAP_CLASS_CLIENT_FAILURE:
     case COAP_CLASS_SERVER_FAILURE:
-        _find_req_memo(&memo, &pdu, &remote);
+        _find_req_memo(&memo, &pdu, remote);
         if (memo) {
             switch (coap_get_type(&pdu)) {
             case COAP_TYPE_NON:
             case COAP_TYPE_ACK:
-                xtimer_remove(&memo->response_timer);
+                event_timeout_clear(&memo->resp_evt_tmout);
+                /* the timeout may have fired already */
+                event_cancel(_queue, &memo->resp_tmout_cb.super);
                 memo->state = GCOAP_MEMO_RESP;
                 if (memo->resp_handler) {
-                    memo->resp_handler(memo->state, &pdu, &remote);
+                    memo->resp_handler(memo->state, &pdu, remote);
                 }
 
                 if (memo->send_limit >= 0) {        /* if confirmable */
@@ -256,6 +315,42 @@ static void _listen(sock_udp_t *sock)
     }
 }
 
+/* Receives all pending CoAP messages from the sock without blocking. */
+static void _listen(sock_udp_t *sock)
+{
+    sock_udp_ep_t remote;
+    ssize_t res;
+
+    /* drain the sock: a failed receive (e.g. -EPROTO) consumed a packet as
+     * well, so only stop when there are no more packets queued */
+#ifdef MODULE_GNRC_SOCK_UDP
+    void *data, *ctx = NULL;
+
+    /* GNRC hands out a message in a single chunk, so it is parsed in place */
+    while ((res = sock_udp_recv_buf(sock, &data, &ctx, 0, &remote)) != -EAGAIN) {
+        if (res > 0) {
+            _process(sock, data, res, _listen_buf, sizeof(_listen_buf),
+                     &remote);
+            /* release the message */
+            while (sock_udp_recv_buf(sock, &data, &ctx, 0, NULL) > 0) {}
+        }
+#else
+    /* other stacks may hand out a message in several chunks, whether another
+     * one follows is only known after the first one was released, so the
+     * message is copied to _listen_buf */
+    while ((res = sock_udp_recv(sock, _listen_buf, sizeof(_listen_buf), 0,
+                                &remote)) != -EAGAIN) {
+        if (res > 0) {
+            _process(sock, _listen_buf, res, _listen_buf, sizeof(_listen_buf),
+                     &remote);
+        }
+#endif
+        else if (res < 0) {
+            DEBUG("gcoap: udp recv failure: %d\n", (int)res);
+        }
+    }
+}
+
 /*
  * Main request handler: generates response PDU in the provided buffer.
  *
@@ -381,6 +476,12 @@ static size_t _handle_req(coap_pkt_t *pdu, uint8_t *buf, size_t len,
 static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
                                             gcoap_listener_t **listener_ptr)
 {
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    if (!_index.overflow) {
+        return _index_find_resource(pdu, resource_ptr, listener_ptr);
+    }
+#endif
+
     int ret = GCOAP_RESOURCE_NO_PATH;
     unsigned method_flag = coap_method2flag(coap_get_code_detail(pdu));
 
@@ -424,6 +525,195 @@ static int _find_resource(coap_pkt_t *pdu, const coap_resource_t **resource_ptr,
     return ret;
 }
 
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+/* 32 bit FNV-1a, can be continued over several buffers */
+static uint32_t _fnv1a(uint32_t hash, const uint8_t *buf, size_t len)
+{
+    while (len--) {
+        hash ^= *buf++;
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+#define _FNV1A_INIT         (2166136261UL)
+
+/*
+ * Hashes the request path as coap_get_uri_path() would write it, directly
+ * from the Uri-Path options.
+ *
+ * return 0 on success, -ENOSPC if the path exceeds NANOCOAP_URI_MAX
+ */
+static int _index_uri_hash(const coap_pkt_t *pdu, uint32_t *hash)
+{
+    uint8_t *opt_pos = coap_find_option(pdu, COAP_OPT_URI_PATH);
+    uint8_t *segment = NULL;
+    unsigned left = NANOCOAP_URI_MAX - 1;
+
+    *hash = _fnv1a(_FNV1A_INIT, (uint8_t *)"/", 1);
+    if (!opt_pos) {
+        return 0;
+    }
+    *hash = _FNV1A_INIT;
+    do {
+        int seg_len;
+        segment = coap_iterate_option(pdu, &opt_pos, &seg_len,
+                                      (segment == NULL));
+        if (segment) {
+            if (left < (unsigned)(seg_len + 1)) {
+                return -ENOSPC;
+            }
+            *hash = _fnv1a(*hash, (uint8_t *)"/", 1);
+            *hash = _fnv1a(*hash, segment, seg_len);
+            left -= (seg_len + 1);
+        }
+    } while (opt_pos);
+    return 0;
+}
+
+/*
+ * Compares a resource path with the request path given by the Uri-Path
+ * options, with the same semantics as coap_match_path().
+ *
+ * return true if path matches
+ */
+static bool _index_uri_match(const coap_pkt_t *pdu, const char *path,
+                             bool subtree)
+{
+    uint8_t *opt_pos = coap_find_option(pdu, COAP_OPT_URI_PATH);
+    uint8_t *segment = NULL;
+
+    if (!opt_pos) {
+        /* request path is "/" */
+        return (subtree && (path[0] == '\0')) ||
+               ((path[0] == '/') && (path[1] == '\0'));
+    }
+    do {
+        int seg_len;
+        segment = coap_iterate_option(pdu, &opt_pos, &seg_len,
+                                      (segment == NULL));
+        if (segment) {
+            if (*path == '\0') {
+                return subtree;
+            }
+            if (*path++ != '/') {
+                return false;
+            }
+            for (int i = 0; i < seg_len; i++) {
+                if (*path == '\0') {
+                    return subtree;
+                }
+                if (*path++ != (char)segment[i]) {
+                    return false;
+                }
+            }
+        }
+    } while (opt_pos);
+    return (*path == '\0');
+}
+
+static void _index_add_listener(gcoap_listener_t *listener)
+{
+    if (_index.listeners == 0) {
+        /* first use: initialize empty chains and index the default listener,
+         * which always is the first in the list */
+        memset(_index.buckets, _INDEX_NONE, sizeof(_index.buckets));
+        _index.subtrees = _INDEX_NONE;
+        _index.listeners = 1;
+        _index_add_listener(&_default_listener);
+        if (listener == &_default_listener) {
+            return;
+        }
+    }
+    for (size_t i = 0; i < listener->resources_len; i++) {
+        const coap_resource_t *resource = &listener->resources[i];
+        _index_entry_t *entry;
+        uint8_t *chain;
+
+        if (_index.len >= GCOAP_RESOURCE_INDEX_SIZE) {
+            DEBUG("gcoap: resource index full, using linear search\n");
+            _index.overflow = true;
+            return;
+        }
+        entry = &_index.entries[_index.len];
+        entry->resource = resource;
+        entry->listener = listener;
+        entry->rank = ((uint32_t)(_index.listeners - 1) << 16) | i;
+        if (resource->methods & COAP_MATCH_SUBTREE) {
+            entry->hash = 0;
+            chain = &_index.subtrees;
+        }
+        else {
+            entry->hash = _fnv1a(_FNV1A_INIT, (uint8_t *)resource->path,
+                                 strlen(resource->path));
+            chain = &_index.buckets[entry->hash &
+                                    (GCOAP_RESOURCE_INDEX_BUCKETS - 1)];
+        }
+        /* the entry is complete before it is published in the chain */
+        entry->next = *chain;
+        *chain = _index.len++;
+    }
+    _index.listeners++;
+}
+
+/*
+ * Index based replacement for the linear search in _find_resource(), same
+ * parameters and return values.
+ *
+ * Of all resources matching the path, the one of the first listener and with
+ * the lowest position in its listener wins. The linear search stops a
+ * listener at the first resource with a path that sorts after the request
+ * path, so both return the same resource only if the resources of each
+ * listener are ordered by path, as gcoap requires. A resource that matches
+ * the path but not the method is skipped by both.
+ */
+static int _index_find_resource(coap_pkt_t *pdu,
+                                const coap_resource_t **resource_ptr,
+                                gcoap_listener_t **listener_ptr)
+{
+    int ret = GCOAP_RESOURCE_NO_PATH;
+    unsigned method_flag = coap_method2flag(coap_get_code_detail(pdu));
+    const _index_entry_t *match = NULL;
+    uint32_t hash;
+
+    if (_index.listeners == 0) {
+        _index_add_listener(&_default_listener);
+    }
+    if (_index_uri_hash(pdu, &hash) < 0) {
+        return GCOAP_RESOURCE_NO_PATH;
+    }
+
+    uint8_t chains[] = {
+        _index.buckets[hash & (GCOAP_RESOURCE_INDEX_BUCKETS - 1)],
+        _index.subtrees,
+    };
+    for (unsigned c = 0; c < (sizeof(chains) / sizeof(chains[0])); c++) {
+        for (uint8_t i = chains[c]; i != _INDEX_NONE;
+             i = _index.entries[i].next) {
+            const _index_entry_t *entry = &_index.entries[i];
+            bool subtree = (c != 0);
+
+            if ((!subtree && (entry->hash != hash)) ||
+                (match && (match->rank < entry->rank)) ||
+                !_index_uri_match(pdu, entry->resource->path, subtree)) {
+                continue;
+            }
+            if (!(entry->resource->methods & method_flag)) {
+                ret = GCOAP_RESOURCE_WRONG_METHOD;
+                continue;
+            }
+            match = entry;
+        }
+    }
+    if (match) {
+        *resource_ptr = match->resource;
+        *listener_ptr = match->listener;
+        return GCOAP_RESOURCE_FOUND;
+    }
+    return ret;
+}
+#endif /* MODULE_GCOAP_RESOURCE_INDEX */
+
 /*
  * Finds the memo for an outstanding request within the _coap_state.open_reqs
  * array. Matches on remote endpoint and token.
@@ -606,11 +896,23 @@ static void _find_obs_memo_resource(gcoap_observe_memo_t **memo,
 
 kernel_pid_t gcoap_init(void)
 {
-    if (_pid != KERNEL_PID_UNDEF) {
+    if (_queue != NULL) {
         return -EEXIST;
     }
+#ifdef MODULE_GCOAP_THREAD
+    _queue = &_thread_queue;
+    /* the queue is claimed by the gcoap thread */
+    event_queue_init_detached(_queue);
     _pid = thread_create(_msg_stack, sizeof(_msg_stack), THREAD_PRIORITY_MAIN - 1,
                             THREAD_CREATE_STACKTEST, _event_loop, NULL, "coap");
+#else
+    _queue = GCOAP_EVENT_PRIO;
+    int res = _sock_init();
+    if (res < 0) {
+        _queue = NULL;
+        return res;
+    }
+#endif
 
     mutex_init(&_coap_state.lock);
     /* Blank lists so we know if an entry is available. */
@@ -620,8 +922,17 @@ kernel_pid_t gcoap_init(void)
     memset(&_coap_state.resend_bufs[0], 0, sizeof(_coap_state.resend_bufs));
     /* randomize initial value */
     atomic_init(&_coap_state.next_message_id, (unsigned)random_uint32());
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    if (_index.listeners == 0) {
+        _index_add_listener(&_default_listener);
+    }
+#endif
 
+#ifdef MODULE_GCOAP_THREAD
     return _pid;
+#else
+    return KERNEL_PID_UNDEF;
+#endif
 }
 
 void gcoap_register_listener(gcoap_listener_t *listener)
@@ -634,6 +945,9 @@ void gcoap_register_listener(gcoap_listener_t *listener)
 
     listener->next = NULL;
     _last->next = listener;
+#ifdef MODULE_GCOAP_RESOURCE_INDEX
+    _index_add_listener(listener);
+#endif
 }
 
 int gcoap_req_init(coap_pkt_t *pdu, uint8_t *buf, size_t len,
@@ -778,35 +1092,23 @@ size_t gcoap_req_send(const uint8_t *buf, size_t len,
         }
     }
 
-    /* Memos complete; send msg and start timer */
+    /* Memos complete; start timer and send msg. The timer is started first
+     * as the response may be handled on the gcoap thread before
+     * sock_udp_send() returns. */
+    if ((memo != NULL) && (timeout > 0)) {
+        event_callback_init(&memo->resp_tmout_cb, _on_resp_timeout, memo);
+        event_timeout_init(&memo->resp_evt_tmout, _queue,
+                           &memo->resp_tmout_cb.super);
+        event_timeout_set(&memo->resp_evt_tmout, timeout);
+    }
     ssize_t res = sock_udp_send(&_sock, buf, len, remote);
 
-    /* timeout may be zero for non-confirmable */
-    if ((memo != NULL) && (res > 0) && (timeout > 0)) {
-        /* We assume gcoap_req_send() is called on some thread other than
-         * gcoap's. First, put a message in the mbox for the sock udp object,
-         * which will interrupt listening on the gcoap thread. (When there are
-         * no outstanding requests, gcoap blocks indefinitely in _listen() at
-         * sock_udp_recv().) While the message sent here is outstanding, the
-         * sock_udp_recv() call will be set to a short timeout so the request
-         * timer below, also on the gcoap thread, is processed in a timely
-         * manner. */
-        msg_t mbox_msg;
-        mbox_msg.type          = GCOAP_MSG_TYPE_INTR;
-        mbox_msg.content.value = 0;
-        if (mbox_try_put(&_sock.reg.mbox, &mbox_msg)) {
-            /* start response wait timer on the gcoap thread */
-            memo->timeout_msg.type        = GCOAP_MSG_TYPE_TIMEOUT;
-            memo->timeout_msg.content.ptr = (char *)memo;
-            xtimer_set_msg(&memo->response_timer, timeout, &memo->timeout_msg, _pid);
-        }
-        else {
-            res = 0;
-            DEBUG("gcoap: can't wake up mbox; no timeout for msg\n");
-        }
-    }
     if (res <= 0) {
         if (memo != NULL) {
+            if (timeout > 0) {
+                event_timeout_clear(&memo->resp_evt_tmout);
+                event_cancel(_queue, &memo->resp_tmout_cb.super);
+            }
             if (msg_type == COAP_TYPE_CON) {
                 *memo->msg.data.pdu_buf = 0;    /* clear resend buffer */
             }
@@ -941,6 +1243,14 @@ int gcoap_get_resource_list(void *buf, size_t maxlen, uint8_t cf)
     return (int)pos;
 }
 
+#ifdef TEST_SUITES
+int gcoap_find_resource(coap_pkt_t *pdu, const coap_resource_t **resource,
+                        gcoap_listener_t **listener)
+{
+    return _find_resource(pdu, resource, listener);
+}
+#endif
+
 int gcoap_add_qstring(coap_pkt_t *pdu, const char *key, const char *val)
 {
     char qs[NANOCOAP_QS_MAX];
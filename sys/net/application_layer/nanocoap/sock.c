@@ -133,22 +133,40 @@ int nanocoap_server(sock_udp_ep_t *local, uint8_t *buf, size_t bufsize)
     }
 
     while (1) {
-        res = sock_udp_recv(&sock, buf, bufsize, -1, &remote);
+#ifdef MODULE_GNRC_SOCK_UDP
+        /* GNRC hands out a datagram in a single chunk, so the request can be
+         * parsed in place */
+        void *data, *ctx = NULL;
+
+        res = sock_udp_recv_buf(&sock, &data, &ctx, SOCK_NO_TIMEOUT, &remote);
+#else
+        /* other stacks may hand out a datagram in several chunks (lwIP) or do
+         * not implement sock_udp_recv_buf() (emb6), so the request is copied
+         * to buf and the response overwrites it */
+        uint8_t *data = buf;
+
+        res = sock_udp_recv(&sock, buf, bufsize, SOCK_NO_TIMEOUT, &remote);
+#endif
         if (res < 0) {
             DEBUG("error receiving UDP packet %d\n", (int)res);
         }
         else if (res > 0) {
             coap_pkt_t pkt;
-            if (coap_parse(&pkt, (uint8_t *)buf, res) < 0) {
+            /* parse the request in place, the response is written to buf */
+            if (coap_parse(&pkt, data, res) < 0) {
                 DEBUG("error parsing packet\n");
-                continue;
-            }
-            if ((res = coap_handle_req(&pkt, buf, bufsize)) > 0) {
-                res = sock_udp_send(&sock, buf, res, &remote);
+                res = 0;
             }
-            else {
+            else if ((res = coap_handle_req(&pkt, buf, bufsize)) <= 0) {
                 DEBUG("error handling request %d\n", (int)res);
             }
+#ifdef MODULE_GNRC_SOCK_UDP
+            /* release the request before sending the response */
+            while (sock_udp_recv_buf(&sock, &data, &ctx, 0, NULL) > 0) {}
+#endif
+            if (res > 0) {
+                res = sock_udp_send(&sock, buf, res, &remote);
+            }
         }
     }
 
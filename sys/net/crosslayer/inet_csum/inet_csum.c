@@ -14,12 +14,71 @@
 
 #include <inttypes.h>
 #include <stdio.h>
+
+#include "byteorder.h"
 #include "od.h"
 #include "net/inet_csum.h"
 
 #define ENABLE_DEBUG    (0)
 #include "debug.h"
 
+/* word types that may alias the byte buffers they are loaded from */
+typedef uint16_t __attribute__((__may_alias__)) _u16_t;
+typedef uint32_t __attribute__((__may_alias__)) _u32_t;
+
+static inline uint32_t _fold(uint64_t sum)
+{
+    while (sum >> 16) {
+        sum = (sum & 0xffff) + (sum >> 16);
+    }
+    return (uint32_t)sum;
+}
+
+/**
+ * @brief   Sums up @p len bytes of a 2-byte aligned buffer that starts at an
+ *          even position of the checksum domain
+ *
+ * The buffer is summed up word by word in host byte order with the carries
+ * accumulated in the upper half of a 64-bit accumulator and only folded once
+ * at the end. Since the one's complement sum is byte order independent
+ * (RFC 1071, section 2(B)) only the folded result needs to be converted.
+ *
+ * @return  The (folded) sum in network byte order, a trailing odd byte is
+ *          added as top half of a 16-bit word.
+ */
+static uint32_t _sum_even(const uint8_t *buf, size_t len)
+{
+    uint64_t acc = 0;
+    uint32_t res;
+
+    if (((uintptr_t)buf & 2) && (len >= 2)) {
+        acc += *((const _u16_t *)buf);
+        buf += 2;
+        len -= 2;
+    }
+
+    const _u32_t *src_w = (const _u32_t *)buf;
+    size_t words = len >> 2;
+
+    for (; words >= 4; words -= 4, src_w += 4) {
+        acc += (uint64_t)src_w[0] + src_w[1] + src_w[2] + src_w[3];
+    }
+    for (; words > 0; words--) {
+        acc += *src_w++;
+    }
+    buf = (const uint8_t *)src_w;
+
+    if (len & 2) {
+        acc += *((const _u16_t *)buf);
+        buf += 2;
+    }
+    res = ntohs((uint16_t)_fold(acc));
+    if (len & 1) {
+        res += (uint32_t)(*buf << 8);
+    }
+    return res;
+}
+
 uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t accum_len)
 {
     uint32_t csum = sum;
@@ -41,21 +100,22 @@ uint16_t inet_csum_slice(uint16_t sum, const uint8_t *buf, uint16_t len, size_t
         csum += *buf;         /* add first byte as bottom half of 16-byte word */
         buf++;
         len--;
-        accum_len++;
     }
 
-    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
-        csum += (uint16_t)(*buf << 8) + *(buf + 1); /* group bytes by 16-byte words */
-                                                    /* and add them */
+    if (len > 0) {
+        if ((uintptr_t)buf & 1) {
+            /* add first byte as top half of 16-byte word, the remainder then
+             * starts at an odd position of the checksum domain, so its
+             * byte swapped sum is added */
+            csum += (uint32_t)(*buf << 8);
+            csum += byteorder_swaps((uint16_t)_fold(_sum_even(buf + 1, len - 1)));
+        }
+        else {
+            csum += _sum_even(buf, len);
+        }
     }
 
-    if ((accum_len + len) & 1)          /* if accumulated length is odd */
-        csum += (uint16_t)(*buf << 8);  /* add last byte as top half of 16-byte word */
-
-    while (csum >> 16) {
-        uint16_t carry = csum >> 16;
-        csum = (csum & 0xffff) + carry;
-    }
+    csum = _fold(csum);
 
     DEBUG("inet_sum: new sum = 0x%04" PRIx32 "\n", csum);
 
@@ -109,6 +109,7 @@ static const char *_netopt_strmap[] = {
     [NETOPT_SYNCWORD]              = "NETOPT_SYNCWORD",
     [NETOPT_RANDOM]                = "NETOPT_RANDOM",
     [NETOPT_RX_SYMBOL_TIMEOUT]     = "NETOPT_RX_SYMBOL_TIMEOUT",
+    [NETOPT_RX_BATCH_STATS]        = "NETOPT_RX_BATCH_STATS",
     [NETOPT_NUMOF]                 = "NETOPT_NUMOF",
 };
 
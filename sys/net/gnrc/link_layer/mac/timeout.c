@@ -19,6 +19,9 @@
  * @}
  */
 
+#include <string.h>
+
+#include "irq.h"
 #include "net/gnrc.h"
 #include "net/gnrc/mac/timeout.h"
 
@@ -37,7 +40,8 @@ void gnrc_mac_init_timeouts(gnrc_mac_timeout_t *mac_timeout,
     mac_timeout->timeout_num = num;
 
     for (int i = 0; i < mac_timeout->timeout_num; i++) {
-        mac_timeout->timeouts[i].msg_event.event.next = NULL;
+        memset(&mac_timeout->timeouts[i].msg_event.event, 0,
+               sizeof(mac_timeout->timeouts[i].msg_event.event));
         mac_timeout->timeouts[i].type = GNRC_MAC_TIMEOUT_DISABLED;
     }
 
@@ -116,13 +120,20 @@ bool gnrc_mac_timeout_is_expired(gnrc_mac_timeout_t *mac_timeout, gnrc_mac_timeo
 
     int index = gnrc_mac_find_timeout(mac_timeout, type);
     if (index >= 0) {
-        evtimer_event_t *list;
-        list = (evtimer_event_t *)&mac_timeout->evtimer.events;
-        while (list->next) {
-            if (list->next == &mac_timeout->timeouts[index].msg_event.event) {
-                return false;
+        evtimer_t *evtimer = &mac_timeout->evtimer;
+        evtimer_event_t *ptr;
+        /* the timer must not change while iterating over its events */
+        unsigned state = irq_disable();
+
+        for (ptr = evtimer_next(evtimer, NULL); ptr != NULL;
+             ptr = evtimer_next(evtimer, ptr)) {
+            if (ptr == &mac_timeout->timeouts[index].msg_event.event) {
+                break;
             }
-            list = list->next;
+        }
+        irq_restore(state);
+        if (ptr != NULL) {
+            return false;
         }
 
         /* if we reach here, timeout is expired */
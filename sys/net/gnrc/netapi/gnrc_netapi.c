@@ -79,6 +79,52 @@ static inline int _snd_rcv_mbox(mbox_t *mbox, uint16_t type, gnrc_pktsnip_t *pkt
 }
 #endif
 
+/**
+ * @brief   Passes one reference of @p pkt to the subscriber @p sendto
+ *
+ * The reference is released if the packet can not be delivered.
+ */
+static void _dispatch_entry(gnrc_netreg_entry_t *sendto, uint16_t cmd,
+                            gnrc_pktsnip_t *pkt)
+{
+#if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
+    int release = 0;
+    switch (sendto->type) {
+        case GNRC_NETREG_TYPE_DEFAULT:
+            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+                /* unable to dispatch packet */
+                release = 1;
+            }
+            break;
+#ifdef MODULE_GNRC_NETAPI_MBOX
+        case GNRC_NETREG_TYPE_MBOX:
+            if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
+                /* unable to dispatch packet */
+                release = 1;
+            }
+            break;
+#endif
+#ifdef MODULE_GNRC_NETAPI_CALLBACKS
+        case GNRC_NETREG_TYPE_CB:
+            sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
+            break;
+#endif
+        default:
+            /* unknown dispatch type */
+            release = 1;
+            break;
+    }
+    if (release) {
+        gnrc_pktbuf_release(pkt);
+    }
+#else
+    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
+        /* unable to dispatch packet */
+        gnrc_pktbuf_release(pkt);
+    }
+#endif
+}
+
 int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
                          uint16_t cmd, gnrc_pktsnip_t *pkt)
 {
@@ -90,45 +136,66 @@ int gnrc_netapi_dispatch(gnrc_nettype_t type, uint32_t demux_ctx,
         gnrc_pktbuf_hold(pkt, numof - 1);
 
         while (sendto) {
+            _dispatch_entry(sendto, cmd, pkt);
+            sendto = gnrc_netreg_getnext(sendto);
+        }
+    }
+
+    return numof;
+}
+
+int gnrc_netapi_dispatch_receive_batch(gnrc_nettype_t type, uint32_t demux_ctx,
+                                       gnrc_pktsnip_t *const *pkts,
+                                       unsigned pkts_numof)
+{
+    int numof = gnrc_netreg_num(type, demux_ctx);
+
+    if ((numof == 0) || (pkts_numof == 0)) {
+        return numof;
+    }
+
+    gnrc_pktsnip_t *batch = gnrc_pktbuf_add(NULL, pkts,
+                                            pkts_numof * sizeof(*pkts),
+                                            GNRC_NETTYPE_UNDEF);
+    if (batch == NULL) {
+        DEBUG("gnrc_netapi: unable to allocate batch of %u packets, "
+              "dispatching them one by one\n", pkts_numof);
+        for (unsigned i = 0; i < pkts_numof; i++) {
+            gnrc_netapi_dispatch(type, demux_ctx, GNRC_NETAPI_MSG_TYPE_RCV,
+                                 pkts[i]);
+        }
+        return numof;
+    }
+
+    gnrc_netreg_entry_t *sendto = gnrc_netreg_lookup(type, demux_ctx);
+
+    /* every subscriber gets one reference to the batch and to each packet */
+    gnrc_pktbuf_hold(batch, numof - 1);
+    for (unsigned i = 0; i < pkts_numof; i++) {
+        gnrc_pktbuf_hold(pkts[i], numof - 1);
+    }
+
+    while (sendto) {
 #if defined(MODULE_GNRC_NETAPI_MBOX) || defined(MODULE_GNRC_NETAPI_CALLBACKS)
-            int release = 0;
-            switch (sendto->type) {
-                case GNRC_NETREG_TYPE_DEFAULT:
-                    if (_gnrc_netapi_send_recv(sendto->target.pid, pkt,
-                                               cmd) < 1) {
-                        /* unable to dispatch packet */
-                        release = 1;
-                    }
-                    break;
-#ifdef MODULE_GNRC_NETAPI_MBOX
-                case GNRC_NETREG_TYPE_MBOX:
-                    if (_snd_rcv_mbox(sendto->target.mbox, cmd, pkt) < 1) {
-                        /* unable to dispatch packet */
-                        release = 1;
-                    }
-                    break;
-#endif
-#ifdef MODULE_GNRC_NETAPI_CALLBACKS
-                case GNRC_NETREG_TYPE_CB:
-                    sendto->target.cbd->cb(cmd, pkt, sendto->target.cbd->ctx);
-                    break;
-#endif
-                default:
-                    /* unknown dispatch type */
-                    release = 1;
-                    break;
+        if (sendto->type != GNRC_NETREG_TYPE_DEFAULT) {
+            /* mailboxes and callbacks only know single packets */
+            for (unsigned i = 0; i < pkts_numof; i++) {
+                _dispatch_entry(sendto, GNRC_NETAPI_MSG_TYPE_RCV, pkts[i]);
             }
-            if (release) {
-                gnrc_pktbuf_release(pkt);
-            }
-#else
-            if (_gnrc_netapi_send_recv(sendto->target.pid, pkt, cmd) < 1) {
-                /* unable to dispatch packet */
-                gnrc_pktbuf_release(pkt);
-            }
-#endif
+            gnrc_pktbuf_release(batch);
             sendto = gnrc_netreg_getnext(sendto);
+            continue;
+        }
+#endif
+        if (_gnrc_netapi_send_recv(sendto->target.pid, batch,
+                                   GNRC_NETAPI_MSG_TYPE_RCV_BATCH) < 1) {
+            /* unable to dispatch batch */
+            for (unsigned i = 0; i < pkts_numof; i++) {
+                gnrc_pktbuf_release(pkts[i]);
+            }
+            gnrc_pktbuf_release(batch);
         }
+        sendto = gnrc_netreg_getnext(sendto);
     }
 
     return numof;
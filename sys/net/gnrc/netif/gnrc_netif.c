@@ -44,6 +44,9 @@ static void _update_l2addr_from_dev(gnrc_netif_t *netif);
 static void _configure_netdev(netdev_t *dev);
 static void *_gnrc_netif_thread(void *args);
 static void _event_cb(netdev_t *dev, netdev_event_t event);
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+static void _pass_on_batch(gnrc_netif_t *netif);
+#endif
 
 gnrc_netif_t *gnrc_netif_create(char *stack, int stacksize, char priority,
                                 const char *name, netdev_t *netdev,
@@ -1323,6 +1326,9 @@ static void *_gnrc_netif_thread(void *args)
             case NETDEV_MSG_TYPE_EVENT:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_EVENT received\n");
                 dev->driver->isr(dev);
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+                _pass_on_batch(netif);
+#endif
                 break;
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("gnrc_netif: GNRC_NETDEV_MSG_TYPE_SND received\n");
@@ -1394,6 +1400,39 @@ static void _pass_on_packet(gnrc_pktsnip_t *pkt)
     }
 }
 
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+static void _pass_on_batch(gnrc_netif_t *netif)
+{
+    unsigned numof = netif->rx_batch_numof;
+
+    netif->rx_batch_numof = 0;
+    if (numof == 1) {
+        _pass_on_packet(netif->rx_batch[0]);
+    }
+    else if ((numof > 1) &&
+             !gnrc_netapi_dispatch_receive_batch(netif->rx_batch[0]->type,
+                                                 GNRC_NETREG_DEMUX_CTX_ALL,
+                                                 netif->rx_batch, numof)) {
+        DEBUG("gnrc_netif: unable to forward batch of type %i\n",
+              netif->rx_batch[0]->type);
+        for (unsigned i = 0; i < numof; i++) {
+            gnrc_pktbuf_release(netif->rx_batch[i]);
+        }
+    }
+}
+
+static void _add_to_batch(gnrc_netif_t *netif, gnrc_pktsnip_t *pkt)
+{
+    /* a batch only holds packets of one type */
+    if ((netif->rx_batch_numof == GNRC_NETIF_RX_BATCH_SIZE) ||
+        ((netif->rx_batch_numof > 0) &&
+         (netif->rx_batch[0]->type != pkt->type))) {
+        _pass_on_batch(netif);
+    }
+    netif->rx_batch[netif->rx_batch_numof++] = pkt;
+}
+#endif
+
 static void _event_cb(netdev_t *dev, netdev_event_t event)
 {
     gnrc_netif_t *netif = (gnrc_netif_t *) dev->context;
@@ -1413,7 +1452,12 @@ static void _event_cb(netdev_t *dev, netdev_event_t event)
             case NETDEV_EVENT_RX_COMPLETE:
                 pkt = netif->ops->recv(netif);
                 if (pkt) {
+#ifdef MODULE_GNRC_NETIF_RX_BATCH
+                    /* passed up after the driver's ISR handled all events */
+                    _add_to_batch(netif, pkt);
+#else
                     _pass_on_packet(pkt);
+#endif
                 }
                 break;
 #ifdef MODULE_NETSTATS_L2
@@ -13,9 +13,11 @@
  */
 
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include "assert.h"
+#include "irq.h"
 #include "log.h"
 #include "utlist.h"
 #include "net/gnrc/netreg.h"
@@ -31,10 +33,45 @@
 /* The registry as lookup table by gnrc_nettype_t */
 static gnrc_netreg_entry_t *netreg[GNRC_NETTYPE_NUMOF];
 
+/**
+ * @brief   Cached lookup result for a (type, demux_ctx) pair
+ *
+ * gnrc_netapi_dispatch() needs both the number of subscribers and the first
+ * subscriber, and a burst of packets is usually dispatched to the same
+ * (type, demux_ctx), so the result is kept until the registry for that type
+ * changes.
+ */
+typedef struct {
+    gnrc_netreg_entry_t *first; /**< first entry matching demux_ctx */
+    uint32_t demux_ctx;         /**< demux_ctx the result is valid for */
+    uint16_t numof;             /**< number of entries matching demux_ctx */
+    bool valid;                 /**< the cache entry is valid */
+} _netreg_cache_entry_t;
+
+/**
+ * @brief   Lookup cache of a gnrc_nettype_t
+ */
+typedef struct {
+    _netreg_cache_entry_t entries[GNRC_NETREG_CACHE_SIZE];  /**< cached results */
+    uint8_t victim;             /**< entry to be replaced on the next miss */
+    uint8_t gen;                /**< incremented on every (un)registration */
+} _netreg_cache_t;
+
+static _netreg_cache_t _cache[GNRC_NETTYPE_NUMOF];
+
+static inline void _cache_invalidate(gnrc_nettype_t type)
+{
+    for (unsigned i = 0; i < GNRC_NETREG_CACHE_SIZE; i++) {
+        _cache[type].entries[i].valid = false;
+    }
+    _cache[type].gen++;
+}
+
 void gnrc_netreg_init(void)
 {
     /* set all pointers in registry to NULL */
     memset(netreg, 0, GNRC_NETTYPE_NUMOF * sizeof(gnrc_netreg_entry_t *));
+    memset(_cache, 0, sizeof(_cache));
 }
 
 int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
@@ -59,7 +96,10 @@ int gnrc_netreg_register(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return -EINVAL;
     }
 
+    unsigned state = irq_disable();
     LL_PREPEND(netreg[type], entry);
+    _cache_invalidate(type);
+    irq_restore(state);
 
     return 0;
 }
@@ -70,7 +110,10 @@ void gnrc_netreg_unregister(gnrc_nettype_t type, gnrc_netreg_entry_t *entry)
         return;
     }
 
+    unsigned state = irq_disable();
     LL_DELETE(netreg[type], entry);
+    _cache_invalidate(type);
+    irq_restore(state);
 }
 
 /**
@@ -99,18 +142,80 @@ static gnrc_netreg_entry_t *_netreg_lookup(gnrc_netreg_entry_t *from,
     return res;
 }
 
+/**
+ * @brief   Gets the cached lookup result for (type, demux_ctx) and updates
+ *          the cache on a miss
+ *
+ * @pre     type is valid
+ *
+ * @param[in] type      Type of the protocol.
+ * @param[in] demux_ctx The demultiplexing context.
+ * @param[out] numof    Number of entries matching (type, demux_ctx).
+ *
+ * @return  The first entry matching (type, demux_ctx), NULL if there is none
+ */
+static gnrc_netreg_entry_t *_cache_lookup(gnrc_nettype_t type,
+                                          uint32_t demux_ctx,
+                                          int *numof)
+{
+    _netreg_cache_t *cache = &_cache[type];
+    gnrc_netreg_entry_t *first = NULL, *entry;
+    uint16_t num = 0;
+    uint8_t gen;
+    /* the cache is shared by all threads using the registry */
+    unsigned state = irq_disable();
+
+    for (unsigned i = 0; i < GNRC_NETREG_CACHE_SIZE; i++) {
+        if (cache->entries[i].valid &&
+            (cache->entries[i].demux_ctx == demux_ctx)) {
+            first = cache->entries[i].first;
+            *numof = cache->entries[i].numof;
+            irq_restore(state);
+            return first;
+        }
+    }
+    gen = cache->gen;
+    irq_restore(state);
+
+    /* walk the registry with interrupts enabled, as without the cache */
+    entry = first = _netreg_lookup(NULL, type, demux_ctx);
+    while (entry != NULL) {
+        num++;
+        entry = _netreg_lookup(entry, type, demux_ctx);
+    }
+
+    state = irq_disable();
+    /* only cache the result if the registry did not change during the walk */
+    if (cache->gen == gen) {
+        _netreg_cache_entry_t *res = &cache->entries[cache->victim];
+
+        cache->victim = (cache->victim + 1) % GNRC_NETREG_CACHE_SIZE;
+        res->first = first;
+        res->demux_ctx = demux_ctx;
+        res->numof = num;
+        res->valid = true;
+    }
+    irq_restore(state);
+    *numof = num;
+    return first;
+}
+
 gnrc_netreg_entry_t *gnrc_netreg_lookup(gnrc_nettype_t type, uint32_t demux_ctx)
 {
-    return _netreg_lookup(NULL, type, demux_ctx);
+    int num;
+
+    if (_INVALID_TYPE(type)) {
+        return NULL;
+    }
+    return _cache_lookup(type, demux_ctx, &num);
 }
 
 int gnrc_netreg_num(gnrc_nettype_t type, uint32_t demux_ctx)
 {
     int num = 0;
-    gnrc_netreg_entry_t *entry = NULL;
 
-    while((entry = _netreg_lookup(entry, type, demux_ctx)) != NULL) {
-        num++;
+    if (!_INVALID_TYPE(type)) {
+        _cache_lookup(type, demux_ctx, &num);
     }
     return num;
 }
@@ -162,9 +162,64 @@ static void _dispatch_next_header(gnrc_pktsnip_t *pkt, unsigned nh,
     }
 }
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+            gnrc_pktsnip_t *batch = msg->content.ptr;
+
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV_BATCH received\n");
+            for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+                _receive(gnrc_netapi_batch_get(batch, i));
+            }
+            gnrc_pktbuf_release(batch);
+            break;
+        }
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr, true);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("ipv6: reply to unsupported get/set\n");
+            reply->content.value = -ENOTSUP;
+            msg_reply(msg, reply);
+            break;
+
+        case GNRC_IPV6_NIB_SND_UC_NS:
+        case GNRC_IPV6_NIB_SND_MC_NS:
+        case GNRC_IPV6_NIB_SND_NA:
+        case GNRC_IPV6_NIB_SEARCH_RTR:
+        case GNRC_IPV6_NIB_REPLY_RS:
+        case GNRC_IPV6_NIB_SND_MC_RA:
+        case GNRC_IPV6_NIB_REACH_TIMEOUT:
+        case GNRC_IPV6_NIB_DELAY_TIMEOUT:
+        case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
+        case GNRC_IPV6_NIB_ABR_TIMEOUT:
+        case GNRC_IPV6_NIB_PFX_TIMEOUT:
+        case GNRC_IPV6_NIB_RTR_TIMEOUT:
+        case GNRC_IPV6_NIB_RECALC_REACH_TIME:
+        case GNRC_IPV6_NIB_REREG_ADDRESS:
+        case GNRC_IPV6_NIB_DAD:
+        case GNRC_IPV6_NIB_VALID_ADDR:
+            DEBUG("ipv6: NIB timer event received\n");
+            gnrc_ipv6_nib_handle_timer_event(msg->content.ptr, msg->type);
+            break;
+        default:
+            break;
+    }
+}
+
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
+    msg_t msgs[GNRC_IPV6_MSG_BULK_SIZE], reply, msg_q[GNRC_IPV6_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
 
@@ -180,47 +235,10 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("ipv6: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("ipv6: GNRC_NETAPI_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr, true);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("ipv6: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-
-            case GNRC_IPV6_NIB_SND_UC_NS:
-            case GNRC_IPV6_NIB_SND_MC_NS:
-            case GNRC_IPV6_NIB_SND_NA:
-            case GNRC_IPV6_NIB_SEARCH_RTR:
-            case GNRC_IPV6_NIB_REPLY_RS:
-            case GNRC_IPV6_NIB_SND_MC_RA:
-            case GNRC_IPV6_NIB_REACH_TIMEOUT:
-            case GNRC_IPV6_NIB_DELAY_TIMEOUT:
-            case GNRC_IPV6_NIB_ADDR_REG_TIMEOUT:
-            case GNRC_IPV6_NIB_ABR_TIMEOUT:
-            case GNRC_IPV6_NIB_PFX_TIMEOUT:
-            case GNRC_IPV6_NIB_RTR_TIMEOUT:
-            case GNRC_IPV6_NIB_RECALC_REACH_TIME:
-            case GNRC_IPV6_NIB_REREG_ADDRESS:
-            case GNRC_IPV6_NIB_DAD:
-            case GNRC_IPV6_NIB_VALID_ADDR:
-                DEBUG("ipv6: NIB timer event received\n");
-                gnrc_ipv6_nib_handle_timer_event(msg.content.ptr, msg.type);
-                break;
-            default:
-                break;
+        unsigned num = msg_receive_bulk(msgs, GNRC_IPV6_MSG_BULK_SIZE);
+
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
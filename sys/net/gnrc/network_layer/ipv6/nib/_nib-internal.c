@@ -17,6 +17,7 @@
 #include <stdbool.h>
 #include <string.h>
 
+#include "irq.h"
 #include "net/gnrc/icmpv6/error.h"
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/ipv6/nib/conf.h"
@@ -43,6 +44,45 @@ static _nib_dr_entry_t _def_routers[GNRC_IPV6_NIB_DEFAULT_ROUTER_NUMOF];
 static _nib_abr_entry_t _abrs[GNRC_IPV6_NIB_ABR_NUMOF];
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
 
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+/**
+ * @brief   Node of the path-compressed prefix trie over _dsts
+ */
+typedef struct _offl_trie_node {
+    struct _offl_trie_node *child[2];   /**< sub-tries, selected by the bit
+                                         *   following the node's prefix */
+    _nib_offl_entry_t *entries;         /**< entries with exactly this prefix,
+                                         *   in the order they appear in _dsts */
+    ipv6_addr_t pfx;                    /**< prefix of the node */
+    uint8_t pfx_len;                    /**< length of the prefix in bits */
+    bool used;                          /**< node is in use */
+} _offl_trie_node_t;
+
+/* a trie with N prefixes has at most N - 1 nodes without entries */
+#define _OFFL_TRIE_NUMOF    (2 * GNRC_IPV6_NIB_OFFL_NUMOF)
+static _offl_trie_node_t _offl_trie[_OFFL_TRIE_NUMOF];
+static _offl_trie_node_t *_offl_trie_root = NULL;
+/* next entry with the same prefix for each entry in _dsts */
+static _nib_offl_entry_t *_offl_trie_next[GNRC_IPV6_NIB_OFFL_NUMOF];
+
+static void _offl_trie_add(_nib_offl_entry_t *dst);
+static void _offl_trie_remove(_nib_offl_entry_t *dst);
+static _nib_offl_entry_t *_offl_trie_match(const ipv6_addr_t *addr);
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
+
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+#define _ONL_HASH_NUMOF     (GNRC_IPV6_NIB_NUMOF)
+/* allocated entries of _nodes by IPv6 address, each bucket in the order of
+ * _nodes */
+static _nib_onl_entry_t *_onl_hash[_ONL_HASH_NUMOF];
+/* next entry in the same bucket for each entry in _nodes */
+static _nib_onl_entry_t *_onl_hash_next[GNRC_IPV6_NIB_NUMOF];
+
+static void _nib_onl_index(_nib_onl_entry_t *node);
+static _nib_onl_entry_t *_onl_hash_match(const ipv6_addr_t *addr,
+                                         unsigned iface);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+
 static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 
 mutex_t _nib_mutex = MUTEX_INIT;
@@ -63,6 +103,15 @@ void _nib_init(void)
 #if GNRC_IPV6_NIB_CONF_MULTIHOP_P6C
     memset(_abrs, 0, sizeof(_abrs));
 #endif  /* GNRC_IPV6_NIB_CONF_MULTIHOP_P6C */
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+    _offl_trie_root = NULL;
+    memset(_offl_trie, 0, sizeof(_offl_trie));
+    memset(_offl_trie_next, 0, sizeof(_offl_trie_next));
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    memset(_onl_hash, 0, sizeof(_onl_hash));
+    memset(_onl_hash_next, 0, sizeof(_onl_hash_next));
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 #endif  /* TEST_SUITES */
     evtimer_init_msg(&_nib_evtimer);
     /* TODO: load ABR information from persistent memory */
@@ -75,13 +124,82 @@ static inline bool _addr_equals(const ipv6_addr_t *addr,
            (ipv6_addr_equal(addr, &node->ipv6));
 }
 
-_nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+static inline _nib_onl_entry_t **_onl_hash_bucket(const ipv6_addr_t *addr)
+{
+    uint32_t hash = addr->u32[0].u32 ^ addr->u32[1].u32 ^
+                    addr->u32[2].u32 ^ addr->u32[3].u32;
+
+    hash ^= hash >> 16;
+    hash *= 0x45d9f3b;
+    hash ^= hash >> 16;
+    return &_onl_hash[hash % _ONL_HASH_NUMOF];
+}
+
+static inline _nib_onl_entry_t **_onl_hash_next_of(const _nib_onl_entry_t *node)
+{
+    return &_onl_hash_next[node - _nodes];
+}
+
+static void _nib_onl_index(_nib_onl_entry_t *node)
+{
+    _nib_onl_entry_t **ptr;
+
+    /* keep the order of _nodes so look-ups find the same entry as a linear
+     * search through _nodes would */
+    for (ptr = _onl_hash_bucket(&node->ipv6); (*ptr != NULL) && (*ptr < node);
+         ptr = _onl_hash_next_of(*ptr)) {}
+    if (*ptr != node) {
+        *_onl_hash_next_of(node) = *ptr;
+        *ptr = node;
+    }
+}
+
+void _nib_onl_unindex(_nib_onl_entry_t *node)
+{
+    for (_nib_onl_entry_t **ptr = _onl_hash_bucket(&node->ipv6); *ptr != NULL;
+         ptr = _onl_hash_next_of(*ptr)) {
+        if (*ptr == node) {
+            *ptr = *_onl_hash_next_of(node);
+            *_onl_hash_next_of(node) = NULL;
+            return;
+        }
+    }
+}
+
+/* same as the exact match in _nib_onl_alloc() for addr != NULL and
+ * iface != 0 */
+static _nib_onl_entry_t *_onl_hash_match(const ipv6_addr_t *addr,
+                                         unsigned iface)
+{
+    _nib_onl_entry_t *res = NULL;
+
+    for (_nib_onl_entry_t *node = *_onl_hash_bucket(addr); node != NULL;
+         node = *_onl_hash_next_of(node)) {
+        if ((_nib_onl_get_if(node) == iface) &&
+            ipv6_addr_equal(addr, &node->ipv6)) {
+            res = node;
+            break;
+        }
+    }
+    /* entries with unspecified address match any address */
+    for (_nib_onl_entry_t *node = *_onl_hash_bucket(&ipv6_addr_unspecified);
+         (node != NULL) && ((res == NULL) || (node < res));
+         node = *_onl_hash_next_of(node)) {
+        if ((_nib_onl_get_if(node) == iface) &&
+            ipv6_addr_is_unspecified(&node->ipv6)) {
+            res = node;
+            break;
+        }
+    }
+    return res;
+}
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+
+static _nib_onl_entry_t *_onl_search(const ipv6_addr_t *addr, unsigned iface)
 {
     _nib_onl_entry_t *node = NULL;
 
-    DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
-          (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
-                                                     sizeof(addr_str)), iface);
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *tmp = &_nodes[i];
 
@@ -96,6 +214,33 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
             node = tmp;
         }
     }
+    return node;
+}
+
+_nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface)
+{
+    _nib_onl_entry_t *node = NULL;
+
+    DEBUG("nib: Allocating on-link node entry (addr = %s, iface = %u)\n",
+          (addr == NULL) ? "NULL" : ipv6_addr_to_str(addr_str, addr,
+                                                     sizeof(addr_str)), iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    /* a NULL address or an undefined interface also match entries with other
+     * addresses or free entries respectively, so search linearly for those */
+    if ((addr != NULL) && (iface != 0)) {
+        node = _onl_hash_match(addr, iface);
+        for (unsigned i = 0; (node == NULL) && (i < GNRC_IPV6_NIB_NUMOF); i++) {
+            if (_nodes[i].mode == _EMPTY) {
+                DEBUG("  using %p\n", (void *)&_nodes[i]);
+                node = &_nodes[i];
+            }
+        }
+    }
+    else
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+    {
+        node = _onl_search(addr, iface);
+    }
     if (node != NULL) {
         _override_node(addr, iface, node);
     }
@@ -209,8 +354,13 @@ _nib_onl_entry_t *_nib_onl_get(const ipv6_addr_t *addr, unsigned iface)
     assert(addr != NULL);
     DEBUG("nib: Getting on-link node entry (addr = %s, iface = %u)\n",
           ipv6_addr_to_str(addr_str, addr, sizeof(addr_str)), iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    for (_nib_onl_entry_t *node = *_onl_hash_bucket(addr); node != NULL;
+         node = *_onl_hash_next_of(node)) {
+#else   /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     for (unsigned i = 0; i < GNRC_IPV6_NIB_NUMOF; i++) {
         _nib_onl_entry_t *node = &_nodes[i];
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 
         if ((node->mode != _EMPTY) &&
             /* either requested or current interface undefined or
@@ -481,7 +631,13 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
             /* exact match (or next hop address was previously unset) */
             DEBUG("  %p is an exact match\n", (void *)tmp);
             if (next_hop != NULL) {
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+                _nib_onl_unindex(tmp_node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
                 memcpy(&tmp_node->ipv6, next_hop, sizeof(tmp_node->ipv6));
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+                _nib_onl_index(tmp_node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
             }
             tmp->next_hop->mode |= _DST;
             return tmp;
@@ -502,6 +658,9 @@ _nib_offl_entry_t *_nib_offl_alloc(const ipv6_addr_t *next_hop, unsigned iface,
         dst->next_hop->mode |= _DST;
         ipv6_addr_init_prefix(&dst->pfx, pfx, pfx_len);
         dst->pfx_len = pfx_len;
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+        _offl_trie_add(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
     }
     return dst;
 }
@@ -533,6 +692,9 @@ void _nib_offl_clear(_nib_offl_entry_t *dst)
             dst->next_hop->mode &= ~(_DST);
             _nib_onl_clear(dst->next_hop);
         }
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+        _offl_trie_remove(dst);
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
         memset(dst, 0, sizeof(_nib_offl_entry_t));
     }
 }
@@ -556,13 +718,166 @@ bool _nib_offl_is_entry(const _nib_offl_entry_t *entry)
     return (entry >= _dsts) && _in_dsts(entry);
 }
 
-static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+static inline unsigned _addr_bit(const ipv6_addr_t *addr, unsigned pos)
 {
+    return (addr->u8[pos / 8] >> (7 - (pos % 8))) & 0x1;
+}
+
+static bool _pfx_covers(const ipv6_addr_t *pfx, unsigned pfx_len,
+                        const ipv6_addr_t *addr)
+{
+    unsigned bytes = pfx_len / 8;
+    unsigned bits = pfx_len % 8;
+
+    if (memcmp(pfx, addr, bytes) != 0) {
+        return false;
+    }
+    return (bits == 0) ||
+           (((pfx->u8[bytes] ^ addr->u8[bytes]) & (0xff << (8 - bits))) == 0);
+}
+
+static _offl_trie_node_t *_offl_trie_node_alloc(const ipv6_addr_t *pfx,
+                                                unsigned pfx_len)
+{
+    for (unsigned i = 0; i < _OFFL_TRIE_NUMOF; i++) {
+        _offl_trie_node_t *node = &_offl_trie[i];
+
+        if (!node->used) {
+            memset(node, 0, sizeof(_offl_trie_node_t));
+            ipv6_addr_init_prefix(&node->pfx, pfx, pfx_len);
+            node->pfx_len = pfx_len;
+            node->used = true;
+            return node;
+        }
+    }
+    /* can't happen, see _offl_trie */
+    assert(false);
+    return NULL;
+}
+
+static inline _nib_offl_entry_t **_offl_trie_next_of(const _nib_offl_entry_t *dst)
+{
+    return &_offl_trie_next[dst - _dsts];
+}
+
+static void _offl_trie_add(_nib_offl_entry_t *dst)
+{
+    _offl_trie_node_t **link = &_offl_trie_root;
+    _offl_trie_node_t *node;
+    _nib_offl_entry_t **ptr;
+
+    while ((node = *link) != NULL) {
+        unsigned common = ipv6_addr_match_prefix(&node->pfx, &dst->pfx);
+
+        if (common > dst->pfx_len) {
+            common = dst->pfx_len;
+        }
+        if (common < node->pfx_len) {
+            /* prefixes diverge within node's prefix: put a new node with the
+             * common prefix in front of it */
+            _offl_trie_node_t *split = _offl_trie_node_alloc(&dst->pfx, common);
+
+            split->child[_addr_bit(&node->pfx, common)] = node;
+            *link = split;
+            if (common == dst->pfx_len) {
+                node = split;
+            }
+            else {
+                link = &split->child[_addr_bit(&dst->pfx, common)];
+                node = NULL;
+            }
+            break;
+        }
+        if (node->pfx_len == dst->pfx_len) {
+            break;
+        }
+        link = &node->child[_addr_bit(&dst->pfx, node->pfx_len)];
+    }
+    if (node == NULL) {
+        node = _offl_trie_node_alloc(&dst->pfx, dst->pfx_len);
+        *link = node;
+    }
+    /* keep entries in the order of _dsts so look-ups find the same entry as a
+     * linear search through _dsts would */
+    for (ptr = &node->entries; (*ptr != NULL) && (*ptr < dst);
+         ptr = _offl_trie_next_of(*ptr)) {}
+    *_offl_trie_next_of(dst) = *ptr;
+    *ptr = dst;
+}
+
+static void _offl_trie_remove(_nib_offl_entry_t *dst)
+{
+    _offl_trie_node_t **link = &_offl_trie_root, **parent_link = NULL;
+    _offl_trie_node_t *node;
+    _nib_offl_entry_t **ptr;
+
+    while (((node = *link) != NULL) && (node->pfx_len < dst->pfx_len)) {
+        parent_link = link;
+        link = &node->child[_addr_bit(&dst->pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != dst->pfx_len)) {
+        return;
+    }
+    for (ptr = &node->entries; (*ptr != NULL) && (*ptr != dst);
+         ptr = _offl_trie_next_of(*ptr)) {}
+    if (*ptr == NULL) {
+        return;
+    }
+    *ptr = *_offl_trie_next_of(dst);
+    *_offl_trie_next_of(dst) = NULL;
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node is still required */
+        return;
+    }
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    node->used = false;
+    if ((*link == NULL) && (parent_link != NULL)) {
+        _offl_trie_node_t *parent = *parent_link;
+
+        /* a parent without entries was only there to branch */
+        if (parent->entries == NULL) {
+            *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                      : parent->child[1];
+            parent->used = false;
+        }
+    }
+}
+
+static _nib_offl_entry_t *_offl_trie_match(const ipv6_addr_t *addr)
+{
+    const _offl_trie_node_t *node = _offl_trie_root;
     _nib_offl_entry_t *res = NULL;
-    uint8_t best_match = 0;
 
+    /* walk down the trie, remembering the longest matching prefix */
+    while ((node != NULL) && _pfx_covers(&node->pfx, node->pfx_len, addr)) {
+        for (_nib_offl_entry_t *dst = node->entries; dst != NULL;
+             dst = *_offl_trie_next_of(dst)) {
+            if (dst->mode != _EMPTY) {
+                res = dst;
+                break;
+            }
+        }
+        if (node->pfx_len >= IPV6_ADDR_BIT_LEN) {
+            break;
+        }
+        node = node->child[_addr_bit(addr, node->pfx_len)];
+    }
+    return res;
+}
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
+
+static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
+{
     DEBUG("nib: get match for destination %s from NIB\n",
           ipv6_addr_to_str(addr_str, dst, sizeof(addr_str)));
+#if GNRC_IPV6_NIB_CONF_OFFL_TRIE
+    return _offl_trie_match(dst);
+#else   /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
+    _nib_offl_entry_t *res = NULL;
+    uint8_t best_match = 0;
+
     for (_nib_offl_entry_t *entry = _dsts; _in_dsts(entry); entry++) {
         if (entry->mode != _EMPTY) {
             uint8_t match = ipv6_addr_match_prefix(&entry->pfx, dst);
@@ -583,6 +898,7 @@ static _nib_offl_entry_t *_nib_offl_get_match(const ipv6_addr_t *dst)
         }
     }
     return res;
+#endif  /* GNRC_IPV6_NIB_CONF_OFFL_TRIE */
 }
 
 void _nib_ft_get(const _nib_offl_entry_t *dst, gnrc_ipv6_nib_ft_t *fte)
@@ -809,10 +1125,16 @@ static void _override_node(const ipv6_addr_t *addr, unsigned iface,
                            _nib_onl_entry_t *node)
 {
     _nib_onl_clear(node);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    _nib_onl_unindex(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
     if (addr != NULL) {
         memcpy(&node->ipv6, addr, sizeof(node->ipv6));
     }
     _nib_onl_set_if(node, iface);
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+    _nib_onl_index(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
 }
 
 static inline bool _node_unreachable(_nib_onl_entry_t *node)
@@ -829,19 +1151,24 @@ static inline bool _node_unreachable(_nib_onl_entry_t *node)
 
 uint32_t _evtimer_lookup(const void *ctx, uint16_t type)
 {
-    evtimer_msg_event_t *event = (evtimer_msg_event_t *)_nib_evtimer.events;
-    uint32_t offset = 0;
+    evtimer_t *evtimer = (evtimer_t *)&_nib_evtimer;
+    uint32_t offset = UINT32_MAX;
 
     DEBUG("nib: lookup ctx = %p, type = %04x\n", (void *)ctx, type);
-    while (event != NULL) {
-        offset += event->event.offset;
+    /* events firing or being removed in between would break the iteration */
+    unsigned state = irq_disable();
+    for (evtimer_event_t *ptr = evtimer_next(evtimer, NULL); ptr != NULL;
+         ptr = evtimer_next(evtimer, ptr)) {
+        evtimer_msg_event_t *event = (evtimer_msg_event_t *)ptr;
+
         if ((event->msg.type == type) &&
             ((ctx == NULL) || (event->msg.content.ptr == ctx))) {
-            return offset;
+            offset = evtimer_get_offset(evtimer, ptr);
+            break;
         }
-        event = (evtimer_msg_event_t *)event->event.next;
     }
-    return UINT32_MAX;
+    irq_restore(state);
+    return offset;
 }
 
 /** @} */
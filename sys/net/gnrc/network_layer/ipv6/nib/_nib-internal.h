@@ -304,6 +304,17 @@ static inline void _nib_onl_set_if(_nib_onl_entry_t *node, unsigned iface)
  */
 _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 
+#if GNRC_IPV6_NIB_CONF_ONL_HASH || defined(DOXYGEN)
+/**
+ * @brief   Removes an on-link entry from the address index
+ *
+ * @note    Only available with @ref GNRC_IPV6_NIB_CONF_ONL_HASH
+ *
+ * @param[in] node  An entry.
+ */
+void _nib_onl_unindex(_nib_onl_entry_t *node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
+
 /**
  * @brief   Clears out a NIB entry (on-link version)
  *
@@ -315,6 +326,9 @@ _nib_onl_entry_t *_nib_onl_alloc(const ipv6_addr_t *addr, unsigned iface);
 static inline bool _nib_onl_clear(_nib_onl_entry_t *node)
 {
     if (node->mode == _EMPTY) {
+#if GNRC_IPV6_NIB_CONF_ONL_HASH
+        _nib_onl_unindex(node);
+#endif  /* GNRC_IPV6_NIB_CONF_ONL_HASH */
         memset(node, 0, sizeof(_nib_onl_entry_t));
         return true;
     }
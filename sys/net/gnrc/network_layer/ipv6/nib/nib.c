@@ -85,13 +85,9 @@ static void _handle_rdnss_timeout(sock_udp_ep_t *dns_server);
 
 void gnrc_ipv6_nib_init(void)
 {
-    evtimer_event_t *tmp;
-
     mutex_lock(&_nib_mutex);
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    while (_nib_evtimer.events != NULL) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), _nib_evtimer.events);
     }
     _nib_init();
     mutex_unlock(&_nib_mutex);
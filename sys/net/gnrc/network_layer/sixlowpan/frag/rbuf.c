@@ -21,6 +21,7 @@
 #include "net/gnrc.h"
 #include "net/gnrc/sixlowpan.h"
 #include "net/gnrc/sixlowpan/frag.h"
+#include "net/gnrc/sixlowpan/internal.h"
 #include "net/sixlowpan.h"
 #include "thread.h"
 #include "xtimer.h"
@@ -42,9 +43,43 @@
 #define RBUF_INT_SIZE (DIV_CEIL(IPV6_MIN_MTU, GNRC_SIXLOWPAN_FRAG_SIZE) * RBUF_SIZE)
 #endif
 
+#if RBUF_SIZE > UINT8_MAX
+#error "GNRC_SIXLOWPAN_FRAG_RBUF_SIZE must not exceed 255"
+#endif
+
+#if RBUF_INT_SIZE > UINT16_MAX
+#error "RBUF_INT_SIZE must not exceed 65535"
+#endif
+
+/**
+ * @brief   Index information of a reassembly buffer entry
+ *
+ * Entries are referenced by their position in rbuf + 1, so 0 terminates a
+ * chain and a zero-initialized index is a valid empty index.
+ */
+typedef struct {
+    uint8_t next;       /**< next entry in same bucket or in free list */
+    uint8_t older;      /**< next older entry in arrival order */
+    uint8_t newer;      /**< next newer entry in arrival order */
+    uint8_t bucket;     /**< bucket the entry is stored in */
+} _rbuf_idx_t;
+
 static gnrc_sixlowpan_rbuf_int_t rbuf_int[RBUF_INT_SIZE];
+/* released intervals, linked by gnrc_sixlowpan_rbuf_int_t::next */
+static gnrc_sixlowpan_rbuf_int_t *_rbuf_int_free;
+/* intervals rbuf_int[_rbuf_int_unused..RBUF_INT_SIZE) were never handed out */
+static uint16_t _rbuf_int_unused;
 
 static gnrc_sixlowpan_rbuf_t rbuf[RBUF_SIZE];
+static _rbuf_idx_t _rbuf_idx[RBUF_SIZE];
+/* hash buckets over (src, dst, size, tag) */
+static uint8_t _rbuf_buckets[RBUF_SIZE];
+/* entries in arrival order: oldest entry is the next one to time out */
+static uint8_t _rbuf_oldest, _rbuf_newest;
+/* free entries, linked by _rbuf_idx_t::next */
+static uint8_t _rbuf_free;
+/* entries rbuf[_rbuf_unused..RBUF_SIZE) were never handed out */
+static uint8_t _rbuf_unused;
 
 static char l2addr_str[3 * IEEE802154_LONG_ADDRESS_LEN];
 
@@ -59,6 +94,12 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_rbuf_int_t *i,
                                                uint16_t start, uint16_t end);
 /* gets a free entry from interval buffer */
 static gnrc_sixlowpan_rbuf_int_t *_rbuf_int_get_free(void);
+/* returns all intervals of entry to the interval buffer */
+static void _rbuf_int_release(gnrc_sixlowpan_rbuf_base_t *entry);
+/* removes all expired entries */
+static void _rbuf_gc(void);
+/* (re-)arms the garbage collection timer for the oldest entry */
+static void _set_rbuf_timeout(void);
 /* update interval buffer of entry */
 static bool _rbuf_update_ints(gnrc_sixlowpan_rbuf_base_t *entry,
                               uint16_t offset, size_t frag_size);
@@ -126,7 +167,11 @@ static int _rbuf_add(gnrc_netif_hdr_t *netif_hdr, gnrc_pktsnip_t *pkt,
                 SIXLOWPAN_FRAG_1_DISP)) && (offset == 0)) ||
            ((((frag->disp_size.u8[0] & SIXLOWPAN_FRAG_DISP_MASK) ==
                 SIXLOWPAN_FRAG_N_DISP)) && (offset == (frag->offset * 8U))));
-    rbuf_gc();
+    uint8_t oldest = _rbuf_oldest;
+    _rbuf_gc();
+    if (_rbuf_oldest != oldest) {
+        _set_rbuf_timeout();
+    }
     entry = _rbuf_get(gnrc_netif_hdr_get_src_addr(netif_hdr), netif_hdr->src_l2addr_len,
                       gnrc_netif_hdr_get_dst_addr(netif_hdr), netif_hdr->dst_l2addr_len,
                       byteorder_ntohs(frag->disp_size) & SIXLOWPAN_FRAG_SIZE_MASK,
@@ -212,17 +257,135 @@ static inline bool _rbuf_int_overlap_partially(gnrc_sixlowpan_rbuf_int_t *i,
 
 static gnrc_sixlowpan_rbuf_int_t *_rbuf_int_get_free(void)
 {
-    for (unsigned int i = 0; i < RBUF_INT_SIZE; i++) {
-        if (rbuf_int[i].end == 0) { /* start must be smaller than end anyways*/
-            return rbuf_int + i;
-        }
+    gnrc_sixlowpan_rbuf_int_t *res = _rbuf_int_free;
+
+    if (res != NULL) {
+        _rbuf_int_free = res->next;
+        res->next = NULL;
+    }
+    else if (_rbuf_int_unused < RBUF_INT_SIZE) {
+        res = &rbuf_int[_rbuf_int_unused++];
+    }
+    return res;
+}
+
+static void _rbuf_int_release(gnrc_sixlowpan_rbuf_base_t *entry)
+{
+    gnrc_sixlowpan_rbuf_int_t *last = entry->ints;
+
+    if (last == NULL) {
+        return;
+    }
+    while (last->next != NULL) {
+        last = last->next;
+    }
+    last->next = _rbuf_int_free;
+    _rbuf_int_free = entry->ints;
+    entry->ints = NULL;
+}
+
+static inline uint8_t _rbuf_pos(const gnrc_sixlowpan_rbuf_t *entry)
+{
+    return (uint8_t)(entry - rbuf) + 1;
+}
+
+static inline gnrc_sixlowpan_rbuf_t *_rbuf_entry(uint8_t pos)
+{
+    return &rbuf[pos - 1];
+}
+
+static uint8_t _rbuf_hash(const uint8_t *src, size_t src_len,
+                          const uint8_t *dst, size_t dst_len,
+                          size_t size, uint16_t tag)
+{
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+
+    for (unsigned i = 0; i < src_len; i++) {
+        hash = (hash ^ src[i]) * 16777619U;
+    }
+    for (unsigned i = 0; i < dst_len; i++) {
+        hash = (hash ^ dst[i]) * 16777619U;
+    }
+    hash = (hash ^ tag) * 16777619U;
+    hash = (hash ^ size) * 16777619U;
+    return (uint8_t)(hash % RBUF_SIZE);
+}
+
+static gnrc_sixlowpan_rbuf_t *_rbuf_entry_alloc(void)
+{
+    uint8_t pos = _rbuf_free;
+
+    if (pos != 0) {
+        _rbuf_free = _rbuf_idx[pos - 1].next;
+    }
+    else if (_rbuf_unused < RBUF_SIZE) {
+        pos = ++_rbuf_unused;
+    }
+    else {
+        return NULL;
+    }
+    return _rbuf_entry(pos);
+}
+
+static void _rbuf_entry_free(gnrc_sixlowpan_rbuf_t *entry)
+{
+    uint8_t pos = _rbuf_pos(entry);
+
+    _rbuf_idx[pos - 1].next = _rbuf_free;
+    _rbuf_free = pos;
+}
+
+/* appends entry as newest entry to arrival order */
+static void _rbuf_append(uint8_t pos)
+{
+    _rbuf_idx_t *idx = &_rbuf_idx[pos - 1];
+
+    idx->older = _rbuf_newest;
+    idx->newer = 0;
+    if (_rbuf_newest != 0) {
+        _rbuf_idx[_rbuf_newest - 1].newer = pos;
+    }
+    else {
+        _rbuf_oldest = pos;
     }
+    _rbuf_newest = pos;
+}
+
+/* removes entry from arrival order */
+static void _rbuf_unlink(uint8_t pos)
+{
+    _rbuf_idx_t *idx = &_rbuf_idx[pos - 1];
 
-    return NULL;
+    if (idx->older != 0) {
+        _rbuf_idx[idx->older - 1].newer = idx->newer;
+    }
+    else {
+        _rbuf_oldest = idx->newer;
+    }
+    if (idx->newer != 0) {
+        _rbuf_idx[idx->newer - 1].older = idx->older;
+    }
+    else {
+        _rbuf_newest = idx->older;
+    }
 }
 
 void rbuf_rm(gnrc_sixlowpan_rbuf_t *entry)
 {
+    if (!rbuf_entry_empty(entry)) {
+        uint8_t pos = _rbuf_pos(entry);
+        uint8_t *ptr = &_rbuf_buckets[_rbuf_idx[pos - 1].bucket];
+
+        while (*ptr != pos) {
+            assert(*ptr != 0);
+            ptr = &_rbuf_idx[*ptr - 1].next;
+        }
+        *ptr = _rbuf_idx[pos - 1].next;
+        _rbuf_unlink(pos);
+        _rbuf_entry_free(entry);
+    }
+    _rbuf_int_release(&entry->super);
     gnrc_sixlowpan_frag_rbuf_base_rm(&entry->super);
     entry->pkt = NULL;
 }
@@ -258,33 +421,53 @@ static bool _rbuf_update_ints(gnrc_sixlowpan_rbuf_base_t *entry,
 }
 
 void rbuf_gc(void)
+{
+    /* the timer fired, so it needs to be armed for the new oldest entry */
+    _rbuf_gc();
+    _set_rbuf_timeout();
+}
+
+static void _rbuf_gc(void)
 {
     uint32_t now_usec = xtimer_now_usec();
-    unsigned int i;
 
-    for (i = 0; i < RBUF_SIZE; i++) {
-        /* since pkt occupies pktbuf, aggressivly collect garbage */
-        if ((rbuf[i].pkt != NULL) &&
-              ((now_usec - rbuf[i].super.arrival) > RBUF_TIMEOUT)) {
-            DEBUG("6lo rfrag: entry (%s, ",
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
-                                         l2addr_str));
-            DEBUG("%s, %u, %u) timed out\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
-                                         l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
+    /* entries are kept in arrival order, so only the expired entries at the
+     * front need to be visited */
+    while (_rbuf_oldest != 0) {
+        gnrc_sixlowpan_rbuf_t *entry = _rbuf_entry(_rbuf_oldest);
 
-            gnrc_pktbuf_release(rbuf[i].pkt);
-            rbuf_rm(&(rbuf[i]));
+        if ((now_usec - entry->super.arrival) <= RBUF_TIMEOUT) {
+            break;
         }
+        DEBUG("6lo rfrag: entry (%s, ",
+              gnrc_netif_addr_to_str(entry->super.src,
+                                     entry->super.src_len,
+                                     l2addr_str));
+        DEBUG("%s, %u, %u) timed out\n",
+              gnrc_netif_addr_to_str(entry->super.dst,
+                                     entry->super.dst_len,
+                                     l2addr_str),
+              (unsigned)entry->super.datagram_size, entry->super.tag);
+
+        /* since pkt occupies pktbuf, aggressivly collect garbage */
+        gnrc_pktbuf_release(entry->pkt);
+        rbuf_rm(entry);
     }
 }
 
-static inline void _set_rbuf_timeout(void)
+static void _set_rbuf_timeout(void)
 {
-    xtimer_set_msg(&_gc_timer, RBUF_TIMEOUT, &_gc_timer_msg, sched_active_pid);
+    if (_rbuf_oldest == 0) {
+        xtimer_remove(&_gc_timer);
+        return;
+    }
+
+    uint32_t age = xtimer_now_usec() - _rbuf_entry(_rbuf_oldest)->super.arrival;
+    /* fire just after the oldest entry expired, so rbuf_gc() collects it */
+    uint32_t timeout = (age < RBUF_TIMEOUT) ? (RBUF_TIMEOUT - age + 1) : 1;
+
+    xtimer_set_msg(&_gc_timer, timeout, &_gc_timer_msg,
+                   gnrc_sixlowpan_get_pid());
 }
 
 static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
@@ -292,56 +475,54 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                         size_t size, uint16_t tag,
                                         unsigned page)
 {
-    gnrc_sixlowpan_rbuf_t *res = NULL, *oldest = NULL;
+    gnrc_sixlowpan_rbuf_t *res;
     uint32_t now_usec = xtimer_now_usec();
+    uint8_t oldest = _rbuf_oldest;
+    uint8_t bucket = _rbuf_hash(src, src_len, dst, dst_len, size, tag);
 
-    for (unsigned int i = 0; i < RBUF_SIZE; i++) {
+    for (uint8_t pos = _rbuf_buckets[bucket]; pos != 0;
+         pos = _rbuf_idx[pos - 1].next) {
+        res = _rbuf_entry(pos);
         /* check first if entry already available */
-        if ((rbuf[i].pkt != NULL) && (rbuf[i].super.datagram_size == size) &&
-            (rbuf[i].super.tag == tag) && (rbuf[i].super.src_len == src_len) &&
-            (rbuf[i].super.dst_len == dst_len) &&
-            (memcmp(rbuf[i].super.src, src, src_len) == 0) &&
-            (memcmp(rbuf[i].super.dst, dst, dst_len) == 0)) {
-            DEBUG("6lo rfrag: entry %p (%s, ", (void *)(&rbuf[i]),
-                  gnrc_netif_addr_to_str(rbuf[i].super.src,
-                                         rbuf[i].super.src_len,
+        if ((res->super.datagram_size == size) &&
+            (res->super.tag == tag) && (res->super.src_len == src_len) &&
+            (res->super.dst_len == dst_len) &&
+            (memcmp(res->super.src, src, src_len) == 0) &&
+            (memcmp(res->super.dst, dst, dst_len) == 0)) {
+            DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
+                  gnrc_netif_addr_to_str(res->super.src,
+                                         res->super.src_len,
                                          l2addr_str));
             DEBUG("%s, %u, %u) found\n",
-                  gnrc_netif_addr_to_str(rbuf[i].super.dst,
-                                         rbuf[i].super.dst_len,
+                  gnrc_netif_addr_to_str(res->super.dst,
+                                         res->super.dst_len,
                                          l2addr_str),
-                  (unsigned)rbuf[i].super.datagram_size, rbuf[i].super.tag);
-            rbuf[i].super.arrival = now_usec;
-            _set_rbuf_timeout();
-            return &(rbuf[i]);
-        }
-
-        /* if there is a free spot: remember it */
-        if ((res == NULL) && rbuf_entry_empty(&rbuf[i])) {
-            res = &(rbuf[i]);
-        }
-
-        /* remember oldest slot */
-        /* note that xtimer_now will overflow in ~1.2 hours */
-        if ((oldest == NULL) ||
-            (oldest->super.arrival - rbuf[i].super.arrival < UINT32_MAX / 2)) {
-            oldest = &(rbuf[i]);
+                  (unsigned)res->super.datagram_size, res->super.tag);
+            res->super.arrival = now_usec;
+            _rbuf_unlink(pos);
+            _rbuf_append(pos);
+            if (_rbuf_oldest != oldest) {
+                _set_rbuf_timeout();
+            }
+            return res;
         }
     }
 
+    res = _rbuf_entry_alloc();
     /* entry not in buffer and no empty spot found */
     if (res == NULL) {
-        assert(oldest != NULL);
-        /* if oldest is not empty, res must not be NULL (because otherwise
-         * oldest could have been picked as res) */
-        assert(!rbuf_entry_empty(oldest));
+        gnrc_sixlowpan_rbuf_t *tmp;
+
+        assert(_rbuf_oldest != 0);
+        tmp = _rbuf_entry(_rbuf_oldest);
         if (GNRC_SIXLOWPAN_FRAG_RBUF_AGGRESSIVE_OVERRIDE ||
-            ((now_usec - oldest->super.arrival) >
+            ((now_usec - tmp->super.arrival) >
             GNRC_SIXLOWPAN_FRAG_RBUF_TIMEOUT_US)) {
             DEBUG("6lo rfrag: reassembly buffer full, remove oldest entry\n");
-            gnrc_pktbuf_release(oldest->pkt);
-            rbuf_rm(oldest);
-            res = oldest;
+            gnrc_pktbuf_release(tmp->pkt);
+            rbuf_rm(tmp);
+            res = _rbuf_entry_alloc();
+            assert(res == tmp);
         }
         else {
             return NULL;
@@ -364,6 +545,10 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->pkt = gnrc_pktbuf_add(NULL, NULL, size, reass_type);
     if (res->pkt == NULL) {
         DEBUG("6lo rfrag: can not allocate reassembly buffer space.\n");
+        _rbuf_entry_free(res);
+        if (_rbuf_oldest != oldest) {
+            _set_rbuf_timeout();
+        }
         return NULL;
     }
 
@@ -378,6 +563,13 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
     res->super.tag = tag;
     res->super.current_size = 0;
 
+    uint8_t pos = _rbuf_pos(res);
+
+    _rbuf_idx[pos - 1].bucket = bucket;
+    _rbuf_idx[pos - 1].next = _rbuf_buckets[bucket];
+    _rbuf_buckets[bucket] = pos;
+    _rbuf_append(pos);
+
     DEBUG("6lo rfrag: entry %p (%s, ", (void *)res,
           gnrc_netif_addr_to_str(res->super.src, res->super.src_len,
                                  l2addr_str));
@@ -386,7 +578,9 @@ static gnrc_sixlowpan_rbuf_t *_rbuf_get(const void *src, size_t src_len,
                                  l2addr_str), res->super.datagram_size,
           res->super.tag);
 
-    _set_rbuf_timeout();
+    if (_rbuf_oldest != oldest) {
+        _set_rbuf_timeout();
+    }
 
     return res;
 }
@@ -396,6 +590,8 @@ void rbuf_reset(void)
 {
     xtimer_remove(&_gc_timer);
     memset(rbuf_int, 0, sizeof(rbuf_int));
+    _rbuf_int_free = NULL;
+    _rbuf_int_unused = 0;
     for (unsigned int i = 0; i < RBUF_SIZE; i++) {
         if ((rbuf[i].pkt != NULL) &&
             (rbuf[i].pkt->users > 0)) {
@@ -403,6 +599,12 @@ void rbuf_reset(void)
         }
     }
     memset(rbuf, 0, sizeof(rbuf));
+    memset(_rbuf_idx, 0, sizeof(_rbuf_idx));
+    memset(_rbuf_buckets, 0, sizeof(_rbuf_buckets));
+    _rbuf_oldest = 0;
+    _rbuf_newest = 0;
+    _rbuf_free = 0;
+    _rbuf_unused = 0;
 }
 
 const gnrc_sixlowpan_rbuf_t *rbuf_array(void)
@@ -305,9 +305,45 @@ static void _send(gnrc_pktsnip_t *pkt)
     gnrc_sixlowpan_multiplex_by_size(pkt, datagram_size, netif, 0);
 }
 
+static void _handle_msg(msg_t *msg, msg_t *reply)
+{
+    switch (msg->type) {
+        case GNRC_NETAPI_MSG_TYPE_RCV:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
+            _receive(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_SND:
+            DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
+            _send(msg->content.ptr);
+            break;
+
+        case GNRC_NETAPI_MSG_TYPE_GET:
+        case GNRC_NETAPI_MSG_TYPE_SET:
+            DEBUG("6lo: reply to unsupported get/set\n");
+            reply->content.value = -ENOTSUP;
+            msg_reply(msg, reply);
+            break;
+#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
+        case GNRC_SIXLOWPAN_MSG_FRAG_SND:
+            DEBUG("6lo: send fragmented event received\n");
+            gnrc_sixlowpan_frag_send(NULL, msg->content.ptr, 0);
+            break;
+        case GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF:
+            DEBUG("6lo: garbage collect reassembly buffer event received\n");
+            gnrc_sixlowpan_frag_rbuf_gc();
+            break;
+#endif
+
+        default:
+            DEBUG("6lo: operation not supported\n");
+            break;
+    }
+}
+
 static void *_event_loop(void *args)
 {
-    msg_t msg, reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
+    msg_t msgs[GNRC_SIXLOWPAN_MSG_BULK_SIZE], reply, msg_q[GNRC_SIXLOWPAN_MSG_QUEUE_SIZE];
     gnrc_netreg_entry_t me_reg = GNRC_NETREG_ENTRY_INIT_PID(GNRC_NETREG_DEMUX_CTX_ALL,
                                                             sched_active_pid);
 
@@ -323,39 +359,10 @@ static void *_event_loop(void *args)
     /* start event loop */
     while (1) {
         DEBUG("6lo: waiting for incoming message.\n");
-        msg_receive(&msg);
-
-        switch (msg.type) {
-            case GNRC_NETAPI_MSG_TYPE_RCV:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_RCV received\n");
-                _receive(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_SND:
-                DEBUG("6lo: GNRC_NETDEV_MSG_TYPE_SND received\n");
-                _send(msg.content.ptr);
-                break;
-
-            case GNRC_NETAPI_MSG_TYPE_GET:
-            case GNRC_NETAPI_MSG_TYPE_SET:
-                DEBUG("6lo: reply to unsupported get/set\n");
-                reply.content.value = -ENOTSUP;
-                msg_reply(&msg, &reply);
-                break;
-#ifdef MODULE_GNRC_SIXLOWPAN_FRAG
-            case GNRC_SIXLOWPAN_MSG_FRAG_SND:
-                DEBUG("6lo: send fragmented event received\n");
-                gnrc_sixlowpan_frag_send(NULL, msg.content.ptr, 0);
-                break;
-            case GNRC_SIXLOWPAN_MSG_FRAG_GC_RBUF:
-                DEBUG("6lo: garbage collect reassembly buffer event received\n");
-                gnrc_sixlowpan_frag_rbuf_gc();
-                break;
-#endif
+        unsigned num = msg_receive_bulk(msgs, GNRC_SIXLOWPAN_MSG_BULK_SIZE);
 
-            default:
-                DEBUG("6lo: operation not supported\n");
-                break;
+        for (unsigned i = 0; i < num; i++) {
+            _handle_msg(&msgs[i], &reply);
         }
     }
 
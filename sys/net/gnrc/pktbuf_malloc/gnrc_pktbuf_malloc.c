@@ -254,6 +254,15 @@ void gnrc_pktbuf_stats(void)
 {
     LOG_INFO("pktbuf: no stat output for gnrc_pktbuf_malloc, use tools like valgrind\n");
 }
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return 0;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+}
 #endif
 
 #ifdef TEST_SUITES
@@ -0,0 +1,556 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup net_gnrc_pktbuf
+ * @{
+ *
+ * @file
+ * @brief   Packet buffer implementation with segregated size classes
+ *
+ * The arena is managed as a binary buddy system: every chunk spans
+ * 2^order blocks of @ref GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE bytes and there is
+ * one free list per order. A bitmap of the non-empty free lists allows to
+ * find the best fitting size class without walking any list. Marking a
+ * header off a snip shares the underlying chunk (reference counted) instead
+ * of splitting it, so no data is moved around.
+ *
+ * @author  Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <string.h>
+#include <stdio.h>
+#include <sys/types.h>
+
+#include "bitarithm.h"
+#include "mutex.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+#define _BLOCK_SIZE     (GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE)
+#define _BLOCK_NUMOF    (GNRC_PKTBUF_SIZE / _BLOCK_SIZE)
+#define _ARENA_SIZE     (_BLOCK_NUMOF * _BLOCK_SIZE)
+#define _ORDER_NUMOF    (16U)
+
+/* block meta data: lower bits hold the order of a chunk head */
+#define _META_ORDER_MASK    (0x0f)
+#define _META_FREE          (0x10)
+#define _META_USED          (0x20)
+
+typedef struct _free_chunk {
+    struct _free_chunk *next;
+    struct _free_chunk *prev;
+} _free_chunk_t;
+
+#if (_BLOCK_SIZE < 8) || (_BLOCK_SIZE & (_BLOCK_SIZE - 1))
+#error "GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE must be a power of two and >= 8"
+#endif
+
+#if (_BLOCK_NUMOF == 0) || (_BLOCK_NUMOF > (1UL << (_ORDER_NUMOF - 1)))
+#error "GNRC_PKTBUF_SIZE does not fit GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE"
+#endif
+
+static mutex_t _mutex = MUTEX_INIT;
+static uint8_t _pktbuf[_ARENA_SIZE] __attribute__((aligned(sizeof(void *))));
+static uint8_t _meta[_BLOCK_NUMOF];
+static uint8_t _refs[_BLOCK_NUMOF];
+static _free_chunk_t *_free_lists[_ORDER_NUMOF];
+static unsigned _free_map;  /* bit n is set when _free_lists[n] is not empty */
+static unsigned _used_blocks;
+
+#ifdef DEVELHELP
+/* maximum number of blocks allocated */
+static unsigned _max_used_blocks;
+/* number of allocations that could not be served */
+static unsigned _alloc_fails;
+#endif
+
+/* internal gnrc_pktbuf functions */
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type);
+static void *_pktbuf_alloc(size_t size);
+static void _pktbuf_free(void *data);
+
+static inline bool _pktbuf_contains(void *ptr)
+{
+    return (unsigned)((uint8_t *)ptr - _pktbuf) < _ARENA_SIZE;
+}
+
+static inline unsigned _block_idx(void *ptr)
+{
+    return ((uint8_t *)ptr - _pktbuf) / _BLOCK_SIZE;
+}
+
+static inline void *_block_ptr(unsigned idx)
+{
+    return &_pktbuf[idx * _BLOCK_SIZE];
+}
+
+static inline unsigned _order(unsigned idx)
+{
+    return _meta[idx] & _META_ORDER_MASK;
+}
+
+/* size class (order) required to hold size bytes */
+static inline unsigned _size_order(size_t size)
+{
+    size_t blocks = (size + _BLOCK_SIZE - 1) / _BLOCK_SIZE;
+
+    if (blocks <= 1) {
+        return 0;
+    }
+    if (blocks > _BLOCK_NUMOF) {
+        return _ORDER_NUMOF;
+    }
+    return bitarithm_msb(blocks - 1) + 1;
+}
+
+static inline void _set_pktsnip(gnrc_pktsnip_t *pkt, gnrc_pktsnip_t *next,
+                                void *data, size_t size, gnrc_nettype_t type)
+{
+    pkt->next = next;
+    pkt->data = data;
+    pkt->size = size;
+    pkt->type = type;
+    pkt->users = 1;
+#ifdef MODULE_GNRC_NETERR
+    pkt->err_sub = KERNEL_PID_UNDEF;
+#endif
+}
+
+static void _list_push(unsigned idx, unsigned order)
+{
+    _free_chunk_t *chunk = _block_ptr(idx);
+
+    _meta[idx] = _META_FREE | order;
+    chunk->prev = NULL;
+    chunk->next = _free_lists[order];
+    if (chunk->next != NULL) {
+        chunk->next->prev = chunk;
+    }
+    _free_lists[order] = chunk;
+    _free_map |= (1U << order);
+}
+
+static void _list_remove(unsigned idx, unsigned order)
+{
+    _free_chunk_t *chunk = _block_ptr(idx);
+
+    if (chunk->prev != NULL) {
+        chunk->prev->next = chunk->next;
+    }
+    else {
+        _free_lists[order] = chunk->next;
+    }
+    if (chunk->next != NULL) {
+        chunk->next->prev = chunk->prev;
+    }
+    if (_free_lists[order] == NULL) {
+        _free_map &= ~(1U << order);
+    }
+    _meta[idx] = 0;
+}
+
+/* returns the index of the head block of the chunk containing idx */
+static unsigned _chunk_head(unsigned idx)
+{
+    /* buddy chunks of order n are aligned to 2^n blocks, so the head is the
+     * first candidate upwards that is marked as used and is big enough */
+    for (unsigned order = 0; order < _ORDER_NUMOF; order++) {
+        unsigned head = idx & ~((1U << order) - 1);
+
+        if ((_meta[head] & _META_USED) && (_order(head) >= order)) {
+            return head;
+        }
+    }
+    assert(false);
+    return idx;
+}
+
+static inline size_t _chunk_space(void *data)
+{
+    unsigned head = _chunk_head(_block_idx(data));
+
+    return ((uint8_t *)_block_ptr(head) + (_BLOCK_SIZE << _order(head))) -
+           (uint8_t *)data;
+}
+
+void gnrc_pktbuf_init(void)
+{
+    unsigned idx = 0;
+
+    mutex_lock(&_mutex);
+    memset(_meta, 0, sizeof(_meta));
+    memset(_free_lists, 0, sizeof(_free_lists));
+    _free_map = 0;
+    _used_blocks = 0;
+    /* cover the arena with the largest aligned chunks that fit */
+    while (idx < _BLOCK_NUMOF) {
+        unsigned order = _ORDER_NUMOF - 1;
+
+        while (((idx & ((1U << order) - 1)) != 0) ||
+               ((idx + (1U << order)) > _BLOCK_NUMOF)) {
+            order--;
+        }
+        _list_push(idx, order);
+        idx += (1U << order);
+    }
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_add(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt;
+
+    if (size > GNRC_PKTBUF_SIZE) {
+        DEBUG("pktbuf: size (%u) > GNRC_PKTBUF_SIZE (%u)\n",
+              (unsigned)size, GNRC_PKTBUF_SIZE);
+        return NULL;
+    }
+    mutex_lock(&_mutex);
+    pkt = _create_snip(next, data, size, type);
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_mark(gnrc_pktsnip_t *pkt, size_t size, gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *marked_snip;
+
+    mutex_lock(&_mutex);
+    if ((size == 0) || (pkt == NULL) || (size > pkt->size) || (pkt->data == NULL)) {
+        DEBUG("pktbuf: size == 0 (was %u) or pkt == NULL (was %p) or "
+              "size > pkt->size (was %u) or pkt->data == NULL (was %p)\n",
+              (unsigned)size, (void *)pkt, (pkt ? (unsigned)pkt->size : 0),
+              (pkt ? pkt->data : NULL));
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    /* create new snip descriptor for marked data */
+    marked_snip = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    if (marked_snip == NULL) {
+        DEBUG("pktbuf: could not reallocate marked section.\n");
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    _set_pktsnip(marked_snip, pkt->next, pkt->data, size, type);
+    if (pkt->size != size) {
+        /* both snips now reference the same chunk */
+        unsigned head = _chunk_head(_block_idx(pkt->data));
+
+        assert(_refs[head] < UINT8_MAX);
+        _refs[head]++;
+        pkt->data = ((uint8_t *)pkt->data) + size;
+    }
+    else {
+        pkt->data = NULL;
+    }
+    pkt->size -= size;
+    pkt->next = marked_snip;
+    mutex_unlock(&_mutex);
+    return marked_snip;
+}
+
+int gnrc_pktbuf_realloc_data(gnrc_pktsnip_t *pkt, size_t size)
+{
+    mutex_lock(&_mutex);
+    assert(pkt != NULL);
+    assert(((pkt->size == 0) && (pkt->data == NULL)) ||
+           ((pkt->size > 0) && (pkt->data != NULL) && _pktbuf_contains(pkt->data)));
+    /* new size and old size are equal */
+    if (size == pkt->size) {
+        /* nothing to do */
+        mutex_unlock(&_mutex);
+        return 0;
+    }
+    /* new size is 0 and data pointer isn't already NULL */
+    if ((size == 0) && (pkt->data != NULL)) {
+        /* set data pointer to NULL */
+        _pktbuf_free(pkt->data);
+        pkt->data = NULL;
+    }
+    /* if new size is bigger than old size and the chunk is either shared or
+     * too small */
+    else if ((size > pkt->size) &&
+             ((pkt->data == NULL) ||
+              (_refs[_chunk_head(_block_idx(pkt->data))] > 1) ||
+              (_chunk_space(pkt->data) < size))) {
+        void *new_data = _pktbuf_alloc(size);
+        if (new_data == NULL) {
+            DEBUG("pktbuf: error allocating new data section\n");
+            mutex_unlock(&_mutex);
+            return ENOMEM;
+        }
+        if (pkt->data != NULL) {            /* if old data exist */
+            memcpy(new_data, pkt->data, pkt->size);
+            _pktbuf_free(pkt->data);
+        }
+        pkt->data = new_data;
+    }
+    else if (size < pkt->size) {
+        unsigned head = _block_idx(pkt->data);
+
+        /* give surplus buddies back if the chunk is used by pkt only */
+        if ((_block_ptr(head) == pkt->data) && (_meta[head] & _META_USED) &&
+            (_refs[head] == 1)) {
+            unsigned order = _order(head);
+            unsigned new_order = _size_order(size);
+
+            while (order > new_order) {
+                order--;
+                _list_push(head + (1U << order), order);
+                _used_blocks -= (1U << order);
+            }
+            _meta[head] = _META_USED | order;
+        }
+    }
+    pkt->size = size;
+    mutex_unlock(&_mutex);
+    return 0;
+}
+
+void gnrc_pktbuf_hold(gnrc_pktsnip_t *pkt, unsigned int num)
+{
+    mutex_lock(&_mutex);
+    while (pkt) {
+        pkt->users += num;
+        pkt = pkt->next;
+    }
+    mutex_unlock(&_mutex);
+}
+
+static void _release_error_locked(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    while (pkt) {
+        gnrc_pktsnip_t *tmp;
+        assert(_pktbuf_contains(pkt));
+        assert(pkt->users > 0);
+        tmp = pkt->next;
+        if (pkt->users == 1) {
+            pkt->users = 0; /* not necessary but to be on the safe side */
+            _pktbuf_free(pkt->data);
+            _pktbuf_free(pkt);
+        }
+        else {
+            pkt->users--;
+        }
+        DEBUG("pktbuf: report status code %" PRIu32 "\n", err);
+        gnrc_neterr_report(pkt, err);
+        pkt = tmp;
+    }
+}
+
+void gnrc_pktbuf_release_error(gnrc_pktsnip_t *pkt, uint32_t err)
+{
+    mutex_lock(&_mutex);
+    _release_error_locked(pkt, err);
+    mutex_unlock(&_mutex);
+}
+
+gnrc_pktsnip_t *gnrc_pktbuf_start_write(gnrc_pktsnip_t *pkt)
+{
+    mutex_lock(&_mutex);
+    if (pkt == NULL) {
+        mutex_unlock(&_mutex);
+        return NULL;
+    }
+    if (pkt->users > 1) {
+        gnrc_pktsnip_t *new;
+        new = _create_snip(pkt->next, pkt->data, pkt->size, pkt->type);
+        if (new != NULL) {
+            pkt->users--;
+        }
+        mutex_unlock(&_mutex);
+        return new;
+    }
+    mutex_unlock(&_mutex);
+    return pkt;
+}
+
+#ifdef DEVELHELP
+void gnrc_pktbuf_stats(void)
+{
+    unsigned free_blocks = 0, largest = 0, chunks = 0;
+
+    mutex_lock(&_mutex);
+    printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
+           (void *)&_pktbuf[0], (void *)&_pktbuf[_ARENA_SIZE], _ARENA_SIZE);
+    printf("  block size: %u, blocks used: %u/%u, max. blocks used: %u\n",
+           _BLOCK_SIZE, _used_blocks, _BLOCK_NUMOF, _max_used_blocks);
+    printf("  allocation failures: %u\n", _alloc_fails);
+    for (unsigned order = 0; order < _ORDER_NUMOF; order++) {
+        unsigned num = 0;
+
+        for (_free_chunk_t *ptr = _free_lists[order]; ptr; ptr = ptr->next) {
+            num++;
+        }
+        if (num > 0) {
+            printf("  size class %5u B: %u free\n", _BLOCK_SIZE << order, num);
+            free_blocks += num << order;
+            largest = (1U << order);
+            chunks += num;
+        }
+    }
+    /* external fragmentation: share of free memory not usable for the
+     * largest possible allocation */
+    printf("  free: %u B in %u chunks, largest: %u B, fragmentation: %u%%\n",
+           free_blocks * _BLOCK_SIZE, chunks, largest * _BLOCK_SIZE,
+           (free_blocks) ? (100U - ((100U * largest) / free_blocks)) : 0);
+    mutex_unlock(&_mutex);
+}
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return _max_used_blocks * _BLOCK_SIZE;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+    mutex_lock(&_mutex);
+    _max_used_blocks = _used_blocks;
+    mutex_unlock(&_mutex);
+}
+#endif
+
+#ifdef TEST_SUITES
+bool gnrc_pktbuf_is_empty(void)
+{
+    return (_used_blocks == 0);
+}
+
+bool gnrc_pktbuf_is_sane(void)
+{
+    unsigned free_blocks = 0;
+
+    /* Invariants of this implementation:
+     *  - every chunk in the free list of order n is marked free with order n
+     *    and aligned to 2^n blocks
+     *  - _free_map has a bit set for exactly the non-empty free lists
+     *  - free and used blocks add up to the whole arena
+     */
+    for (unsigned order = 0; order < _ORDER_NUMOF; order++) {
+        if (((_free_lists[order] != NULL) != !!(_free_map & (1U << order)))) {
+            return false;
+        }
+        for (_free_chunk_t *ptr = _free_lists[order]; ptr; ptr = ptr->next) {
+            unsigned idx;
+
+            if (!_pktbuf_contains(ptr)) {
+                return false;
+            }
+            idx = _block_idx(ptr);
+            if ((_meta[idx] != (_META_FREE | order)) ||
+                (idx & ((1U << order) - 1))) {
+                return false;
+            }
+            free_blocks += (1U << order);
+        }
+    }
+    return (free_blocks + _used_blocks) == _BLOCK_NUMOF;
+}
+#endif
+
+static gnrc_pktsnip_t *_create_snip(gnrc_pktsnip_t *next, const void *data, size_t size,
+                                    gnrc_nettype_t type)
+{
+    gnrc_pktsnip_t *pkt = _pktbuf_alloc(sizeof(gnrc_pktsnip_t));
+    void *_data = NULL;
+
+    if (pkt == NULL) {
+        DEBUG("pktbuf: error allocating new packet snip\n");
+        return NULL;
+    }
+    if (size > 0) {
+        _data = _pktbuf_alloc(size);
+        if (_data == NULL) {
+            DEBUG("pktbuf: error allocating data for new packet snip\n");
+            _pktbuf_free(pkt);
+            return NULL;
+        }
+        if (data != NULL) {
+            memcpy(_data, data, size);
+        }
+    }
+    _set_pktsnip(pkt, next, _data, size, type);
+    return pkt;
+}
+
+static void *_pktbuf_alloc(size_t size)
+{
+    unsigned order = _size_order(size);
+    unsigned avail, cur, idx;
+
+    avail = (order < _ORDER_NUMOF) ? (_free_map & ~((1U << order) - 1)) : 0;
+    if (avail == 0) {
+        DEBUG("pktbuf: no space left in packet buffer\n");
+#ifdef DEVELHELP
+        _alloc_fails++;
+#endif
+        return NULL;
+    }
+    /* smallest non-empty size class that fits */
+    cur = bitarithm_lsb(avail);
+    idx = _block_idx(_free_lists[cur]);
+    _list_remove(idx, cur);
+    /* split off upper halves until the chunk has the requested size class */
+    while (cur > order) {
+        cur--;
+        _list_push(idx + (1U << cur), cur);
+    }
+    _meta[idx] = _META_USED | order;
+    _refs[idx] = 1;
+    _used_blocks += (1U << order);
+#ifdef DEVELHELP
+    if (_used_blocks > _max_used_blocks) {
+        _max_used_blocks = _used_blocks;
+    }
+#endif
+    return _block_ptr(idx);
+}
+
+static void _pktbuf_free(void *data)
+{
+    unsigned idx, order;
+
+    if (!_pktbuf_contains(data)) {
+        return;
+    }
+    idx = _chunk_head(_block_idx(data));
+    assert(_refs[idx] > 0);
+    if (--_refs[idx] > 0) {
+        /* chunk is still referenced by another snip */
+        return;
+    }
+    order = _order(idx);
+    _used_blocks -= (1U << order);
+    /* merge with free buddies of the same size class */
+    while ((order + 1) < _ORDER_NUMOF) {
+        unsigned buddy = idx ^ (1U << order);
+
+        if (((buddy + (1U << order)) > _BLOCK_NUMOF) ||
+            (_meta[buddy] != (_META_FREE | order))) {
+            break;
+        }
+        _list_remove(buddy, order);
+        _meta[idx] = 0;
+        idx &= buddy;
+        order++;
+    }
+    _list_push(idx, order);
+}
+
+/** @} */
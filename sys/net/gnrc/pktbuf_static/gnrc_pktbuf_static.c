@@ -47,6 +47,10 @@ static _unused_t *_first_unused;
 #ifdef DEVELHELP
 /* maximum number of bytes allocated */
 static uint16_t max_byte_count = 0;
+/* number of bytes currently allocated */
+static size_t _used_bytes;
+/* maximum number of bytes allocated at the same time */
+static size_t _max_used_bytes;
 #endif
 
 /* internal gnrc_pktbuf functions */
@@ -85,6 +89,10 @@ void gnrc_pktbuf_init(void)
     _first_unused = (_unused_t *)_pktbuf;
     _first_unused->next = NULL;
     _first_unused->size = sizeof(_pktbuf);
+#ifdef DEVELHELP
+    _used_bytes = 0;
+    _max_used_bytes = 0;
+#endif
     mutex_unlock(&_mutex);
 }
 
@@ -292,6 +300,7 @@ void gnrc_pktbuf_stats(void)
     printf("packet buffer: first byte: %p, last byte: %p (size: %u)\n",
            (void *)&_pktbuf[0], (void *)&_pktbuf[GNRC_PKTBUF_SIZE], GNRC_PKTBUF_SIZE);
     printf("  position of last byte used: %" PRIu16 "\n", max_byte_count);
+    printf("  max. bytes allocated: %u\n", (unsigned)_max_used_bytes);
     if (ptr == NULL) {  /* packet buffer is completely full */
         _print_chunk(chunk, GNRC_PKTBUF_SIZE, count++);
     }
@@ -322,6 +331,18 @@ void gnrc_pktbuf_stats(void)
     DEBUG("pktbuf: needs od module\n");
 #endif
 }
+
+size_t gnrc_pktbuf_max_used(void)
+{
+    return _max_used_bytes;
+}
+
+void gnrc_pktbuf_max_used_reset(void)
+{
+    mutex_lock(&_mutex);
+    _max_used_bytes = _used_bytes;
+    mutex_unlock(&_mutex);
+}
 #endif
 
 #ifdef TEST_SUITES
@@ -431,6 +452,10 @@ static void *_pktbuf_alloc(size_t size)
     if (last_byte > max_byte_count) {
         max_byte_count = last_byte;
     }
+    _used_bytes += size;
+    if (_used_bytes > _max_used_bytes) {
+        _max_used_bytes = _used_bytes;
+    }
 #endif
     return (void *)ptr;
 }
@@ -463,6 +488,9 @@ static void _pktbuf_free(void *data, size_t size)
     }
     new->next = ptr;
     new->size = _align(size);
+#ifdef DEVELHELP
+    _used_bytes -= new->size;
+#endif
     /* calculate number of bytes between new _unused_t chunk and end of packet
      * buffer */
     bytes_at_end = ((&_pktbuf[0] + GNRC_PKTBUF_SIZE) - (((uint8_t *)new) + new->size));
@@ -44,10 +44,68 @@ static void _callback_put(void *arg)
 }
 #endif
 
+#ifdef SOCK_HAS_ASYNC
+static bool _netapi_put(gnrc_sock_reg_t *reg, uint16_t cmd, gnrc_pktsnip_t *pkt)
+{
+    msg_t msg = { .type = cmd, .content = { .ptr = pkt } };
+
+    if ((cmd != GNRC_NETAPI_MSG_TYPE_RCV) || !mbox_try_put(&reg->mbox, &msg)) {
+        gnrc_pktbuf_release(pkt);
+        return false;
+    }
+    return true;
+}
+
+/* the registry entry is the first member of both sock types, so ctx points to
+ * the sock itself */
+#ifdef MODULE_GNRC_SOCK_IP
+static void _netapi_ip_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+
+    if (_netapi_put(reg, cmd, pkt) && (reg->async_cb.ip != NULL)) {
+        reg->async_cb.ip(ctx, SOCK_ASYNC_MSG_RECV);
+    }
+}
+#endif
+
+#ifdef MODULE_GNRC_SOCK_UDP
+static void _netapi_udp_cb(uint16_t cmd, gnrc_pktsnip_t *pkt, void *ctx)
+{
+    gnrc_sock_reg_t *reg = ctx;
+
+    if (_netapi_put(reg, cmd, pkt) && (reg->async_cb.udp != NULL)) {
+        reg->async_cb.udp(ctx, SOCK_ASYNC_MSG_RECV);
+    }
+}
+#endif
+
+static gnrc_netreg_entry_cb_t _netapi_cb(gnrc_nettype_t type)
+{
+    (void)type;
+#ifdef MODULE_GNRC_SOCK_UDP
+    if (type == GNRC_NETTYPE_UDP) {
+        return _netapi_udp_cb;
+    }
+#endif
+#ifdef MODULE_GNRC_SOCK_IP
+    return _netapi_ip_cb;
+#else
+    return NULL;
+#endif
+}
+#endif
+
 void gnrc_sock_create(gnrc_sock_reg_t *reg, gnrc_nettype_t type, uint32_t demux_ctx)
 {
     mbox_init(&reg->mbox, reg->mbox_queue, SOCK_MBOX_SIZE);
+#ifdef SOCK_HAS_ASYNC
+    reg->netreg_cb.cb = _netapi_cb(type);
+    reg->netreg_cb.ctx = reg;
+    gnrc_netreg_entry_init_cb(&reg->entry, demux_ctx, &reg->netreg_cb);
+#else
     gnrc_netreg_entry_init_mbox(&reg->entry, demux_ctx, &reg->mbox);
+#endif
     gnrc_netreg_register(type, &reg->entry);
 }
 
@@ -31,6 +31,9 @@
 #include "net/gnrc/netreg.h"
 #include "net/sock/ip.h"
 #include "net/sock/udp.h"
+#ifdef SOCK_HAS_ASYNC
+#include "net/sock/async/types.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -51,6 +54,22 @@ typedef struct gnrc_sock_reg {
     gnrc_netreg_entry_t entry;          /**< @ref net_gnrc_netreg entry for mbox */
     mbox_t mbox;                        /**< @ref core_mbox target for the sock */
     msg_t mbox_queue[SOCK_MBOX_SIZE];   /**< queue for gnrc_sock_reg_t::mbox */
+#if defined(SOCK_HAS_ASYNC) || defined(DOXYGEN)
+    /**
+     * @brief   Callback descriptor of gnrc_sock_reg_t::entry
+     *
+     * With asynchronous socks the packets are put into gnrc_sock_reg_t::mbox
+     * by a callback that notifies the user afterwards
+     */
+    gnrc_netreg_entry_cbd_t netreg_cb;
+    union {
+        sock_ip_cb_t ip;                /**< callback of a @ref sock_ip_t */
+        sock_udp_cb_t udp;              /**< callback of a @ref sock_udp_t */
+    } async_cb;                         /**< event callback of the user */
+#if defined(SOCK_HAS_ASYNC_CTX) || defined(DOXYGEN)
+    sock_async_ctx_t async_ctx;         /**< asynchronous context */
+#endif
+#endif
 } gnrc_sock_reg_t;
 
 /**
@@ -23,6 +23,9 @@
 #include "net/protnum.h"
 #include "net/gnrc/ipv6.h"
 #include "net/sock/ip.h"
+#ifdef SOCK_HAS_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "random.h"
 
 #include "gnrc_sock_internal.h"
@@ -37,6 +40,9 @@ int sock_ip_create(sock_ip_t *sock, const sock_ip_ep_t *local,
         (local->netif != remote->netif)) {
         return -EINVAL;
     }
+#ifdef SOCK_HAS_ASYNC
+    sock->reg.async_cb.ip = NULL;
+#endif
     memset(&sock->local, 0, sizeof(sock_ip_ep_t));
     if (local != NULL) {
         if (gnrc_af_not_supported(local->family)) {
@@ -64,6 +70,9 @@ void sock_ip_close(sock_ip_t *sock)
 {
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_IPV6, &sock->reg.entry);
+#ifdef SOCK_HAS_ASYNC
+    sock->reg.async_cb.ip = NULL;
+#endif
 }
 
 int sock_ip_get_local(sock_ip_t *sock, sock_ip_ep_t *local)
@@ -195,7 +204,28 @@ ssize_t sock_ip_send(sock_ip_t *sock, const void *data, size_t len,
     if (res <= 0) {
         return res;
     }
+#ifdef SOCK_HAS_ASYNC
+    if ((sock != NULL) && (sock->reg.async_cb.ip != NULL)) {
+        sock->reg.async_cb.ip(sock, SOCK_ASYNC_MSG_SENT);
+    }
+#endif
     return res;
 }
 
+#ifdef SOCK_HAS_ASYNC
+void sock_ip_set_cb(sock_ip_t *sock, sock_ip_cb_t cb)
+{
+    assert(sock != NULL);
+    sock->reg.async_cb.ip = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_ip_get_async_ctx(sock_ip_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->reg.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
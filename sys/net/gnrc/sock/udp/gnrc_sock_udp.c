@@ -24,6 +24,9 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/udp.h"
 #include "net/sock/udp.h"
+#ifdef SOCK_HAS_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "net/udp.h"
 
 #include "gnrc_sock_internal.h"
@@ -95,6 +98,9 @@ int sock_udp_create(sock_udp_t *sock, const sock_udp_ep_t *local,
         (local->netif != remote->netif)) {
         return -EINVAL;
     }
+#ifdef SOCK_HAS_ASYNC
+    sock->reg.async_cb.udp = NULL;
+#endif
     memset(&sock->local, 0, sizeof(sock_udp_ep_t));
     if (local != NULL) {
         uint16_t port = local->port;
@@ -147,6 +153,9 @@ void sock_udp_close(sock_udp_t *sock)
 {
     assert(sock != NULL);
     gnrc_netreg_unregister(GNRC_NETTYPE_UDP, &sock->reg.entry);
+#ifdef SOCK_HAS_ASYNC
+    sock->reg.async_cb.udp = NULL;
+#endif
 #ifdef MODULE_GNRC_SOCK_CHECK_REUSE
     if (_udp_socks != NULL) {
         gnrc_sock_reg_t *head = (gnrc_sock_reg_t *)_udp_socks;
@@ -175,15 +184,14 @@ int sock_udp_get_remote(sock_udp_t *sock, sock_udp_ep_t *remote)
     return 0;
 }
 
-ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
-                      uint32_t timeout, sock_udp_ep_t *remote)
+static ssize_t _recv(sock_udp_t *sock, gnrc_pktsnip_t **pkt_out,
+                     uint32_t timeout, sock_udp_ep_t *remote)
 {
     gnrc_pktsnip_t *pkt, *udp;
     udp_hdr_t *hdr;
     sock_ip_ep_t tmp;
     int res;
 
-    assert((sock != NULL) && (data != NULL) && (max_len > 0));
     if (sock->local.family == AF_UNSPEC) {
         return -EADDRNOTAVAIL;
     }
@@ -192,10 +200,6 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
     if (res < 0) {
         return res;
     }
-    if (pkt->size > max_len) {
-        gnrc_pktbuf_release(pkt);
-        return -ENOBUFS;
-    }
     udp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_UDP);
     assert(udp);
     hdr = udp->data;
@@ -214,12 +218,58 @@ ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
         gnrc_pktbuf_release(pkt);
         return -EPROTO;
     }
+    *pkt_out = pkt;
+    return pkt->size;
+}
+
+ssize_t sock_udp_recv(sock_udp_t *sock, void *data, size_t max_len,
+                      uint32_t timeout, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
+
+    assert((sock != NULL) && (data != NULL) && (max_len > 0));
+    res = _recv(sock, &pkt, timeout, remote);
+    if (res < 0) {
+        return res;
+    }
+    if (pkt->size > max_len) {
+        gnrc_pktbuf_release(pkt);
+        return -ENOBUFS;
+    }
     memcpy(data, pkt->data, pkt->size);
-    res = (int)pkt->size;
     gnrc_pktbuf_release(pkt);
     return res;
 }
 
+ssize_t sock_udp_recv_buf(sock_udp_t *sock, void **data, void **buf_ctx,
+                          uint32_t timeout, sock_udp_ep_t *remote)
+{
+    gnrc_pktsnip_t *pkt;
+    ssize_t res;
+
+    assert((sock != NULL) && (data != NULL) && (buf_ctx != NULL));
+    if (*buf_ctx != NULL) {
+        /* the payload is a single snip, so the previous call handed out
+         * everything */
+        gnrc_pktbuf_release(*buf_ctx);
+        *buf_ctx = NULL;
+        *data = NULL;
+        return 0;
+    }
+    res = _recv(sock, &pkt, timeout, remote);
+    if (res <= 0) {
+        if (res == 0) {
+            gnrc_pktbuf_release(pkt);
+        }
+        *data = NULL;
+        return res;
+    }
+    *data = pkt->data;
+    *buf_ctx = pkt;
+    return res;
+}
+
 ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
                       const sock_udp_ep_t *remote)
 {
@@ -316,8 +366,29 @@ ssize_t sock_udp_send(sock_udp_t *sock, const void *data, size_t len,
     res = gnrc_sock_send(pkt, &local, rem, PROTNUM_UDP);
     if (res > 0) {
         res -= sizeof(udp_hdr_t);
+#ifdef SOCK_HAS_ASYNC
+        if ((sock != NULL) && (sock->reg.async_cb.udp != NULL)) {
+            sock->reg.async_cb.udp(sock, SOCK_ASYNC_MSG_SENT);
+        }
+#endif
     }
     return res;
 }
 
+#ifdef SOCK_HAS_ASYNC
+void sock_udp_set_cb(sock_udp_t *sock, sock_udp_cb_t cb)
+{
+    assert(sock != NULL);
+    sock->reg.async_cb.udp = cb;
+}
+
+#ifdef SOCK_HAS_ASYNC_CTX
+sock_async_ctx_t *sock_udp_get_async_ctx(sock_udp_t *sock)
+{
+    assert(sock != NULL);
+    return &sock->reg.async_ctx;
+}
+#endif
+#endif
+
 /** @} */
@@ -18,6 +18,8 @@
  */
 
 #include <errno.h>
+#include <inttypes.h>
+#include <stdio.h>
 #include <string.h>
 #include <utlist.h>
 
@@ -30,6 +32,7 @@
 #include "internal/option.h"
 #include "internal/eventloop.h"
 #include "internal/rcvbuf.h"
+#include "internal/cc.h"
 
 #ifdef MODULE_GNRC_IPV6
 #include "net/gnrc/ipv6.h"
@@ -279,11 +282,34 @@ void gnrc_tcp_tcb_init(gnrc_tcp_tcb_t *tcb)
     tcb->rtt_var = RTO_UNINITIALIZED;
     tcb->srtt = RTO_UNINITIALIZED;
     tcb->rto = RTO_UNINITIALIZED;
+    tcb->rtt_min = INT32_MAX;
+    tcb->cc = GNRC_TCP_CC_DEFAULT;
     mbox_init(&(tcb->mbox), tcb->mbox_raw, GNRC_TCP_TCB_MBOX_SIZE);
     mutex_init(&(tcb->fsm_lock));
     mutex_init(&(tcb->function_lock));
 }
 
+void gnrc_tcp_tcb_set_rcvbuf(gnrc_tcp_tcb_t *tcb, void *buf, size_t size)
+{
+    assert(tcb != NULL);
+    assert(buf != NULL);
+    assert(size > 0 && size <= UINT16_MAX);
+    assert(tcb->state == FSM_STATE_CLOSED);
+
+    tcb->rcv_buf_raw = buf;
+    tcb->rcv_buf_size = size;
+    tcb->status |= STATUS_USER_RCV_BUF;
+}
+
+void gnrc_tcp_tcb_set_cc(gnrc_tcp_tcb_t *tcb, const gnrc_tcp_cc_t *cc)
+{
+    assert(tcb != NULL);
+    assert(cc != NULL);
+    assert(tcb->state == FSM_STATE_CLOSED);
+
+    tcb->cc = cc;
+}
+
 int gnrc_tcp_open_active(gnrc_tcp_tcb_t *tcb, uint8_t address_family,
                          char *target_addr, uint16_t target_port,
                          uint16_t local_port)
@@ -348,6 +374,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
     cb_arg_t probe_timeout_arg = {MSG_TYPE_PROBE_TIMEOUT, &(tcb->mbox)};
     uint32_t probe_timeout_duration_us = 0;
     ssize_t ret = 0;
+    size_t sent = 0;
     bool probing_mode = false;
 
     /* Lock the TCB for this function call */
@@ -375,8 +402,8 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         _setup_timeout(&user_timeout, timeout_duration_us, _cb_mbox_put_msg, &user_timeout_arg);
     }
 
-    /* Loop until something was sent and acked */
-    while (ret == 0 || tcb->pkt_retransmit != NULL) {
+    /* Loop until all data was sent, previously sent segments may still be unacknowledged */
+    while (ret == 0 && sent < len) {
         /* Check if the connections state is closed. If so, a reset was received */
         if (tcb->state == FSM_STATE_CLOSED) {
             ret = -ECONNRESET;
@@ -395,9 +422,12 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
                            &probe_timeout_arg);
         }
 
-        /* Try to send data in case there nothing has been sent and we are not probing */
-        if (ret == 0 && !probing_mode) {
-            ret = _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (void *) data, len);
+        /* Try to send as much data as the send window allows, if we are not probing */
+        if (!probing_mode) {
+            sent += _fsm(tcb, FSM_EVENT_CALL_SEND, NULL, (uint8_t *) data + sent, len - sent);
+            if (sent == len) {
+                break;
+            }
         }
 
         /* Wait for responses */
@@ -411,7 +441,7 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
 
             case MSG_TYPE_USER_SPEC_TIMEOUT:
                 DEBUG("gnrc_tcp.c : gnrc_tcp_send() : USER_SPEC_TIMEOUT\n");
-                _fsm(tcb, FSM_EVENT_CLEAR_RETRANSMIT, NULL, NULL, 0);
+                /* Data sent so far stays in the retransmit queue */
                 ret = -ETIMEDOUT;
                 break;
 
@@ -449,6 +479,11 @@ ssize_t gnrc_tcp_send(gnrc_tcp_tcb_t *tcb, const void *data, const size_t len,
         }
     }
 
+    /* Report the number of sent bytes, unless the connection was lost */
+    if (ret == 0 || (ret == -ETIMEDOUT && sent > 0)) {
+        ret = sent;
+    }
+
     /* Cleanup */
     xtimer_remove(&probe_timeout);
     xtimer_remove(&connection_timeout);
@@ -660,3 +695,48 @@ gnrc_pktsnip_t *gnrc_tcp_hdr_build(gnrc_pktsnip_t *payload, uint16_t src, uint16
     hdr->off_ctl = byteorder_htons(TCP_HDR_OFFSET_MIN);
     return res;
 }
+
+void gnrc_tcp_stats(void)
+{
+    static const char *states[] = {
+        "CLOSED", "LISTEN", "SYN_SENT", "SYN_RCVD", "ESTABLISHED", "CLOSE_WAIT",
+        "LAST_ACK", "FIN_WAIT_1", "FIN_WAIT_2", "CLOSING", "TIME_WAIT"
+    };
+    gnrc_tcp_tcb_t *tcb;
+
+    mutex_lock(&_list_tcb_lock);
+    LL_FOREACH(_list_tcb_head, tcb) {
+        /* The FSM takes _list_tcb_lock while holding fsm_lock, so waiting for
+         * fsm_lock here could deadlock: a busy TCB is printed unlocked */
+        int locked = mutex_trylock(&(tcb->fsm_lock));
+#ifdef MODULE_GNRC_IPV6
+        char addr_str[IPV6_ADDR_MAX_STR_LEN];
+
+        printf("[%s]:%" PRIu16 " <-> ",
+               ipv6_addr_to_str(addr_str, (ipv6_addr_t *) tcb->local_addr, sizeof(addr_str)),
+               tcb->local_port);
+        printf("[%s]:%" PRIu16,
+               ipv6_addr_to_str(addr_str, (ipv6_addr_t *) tcb->peer_addr, sizeof(addr_str)),
+               tcb->peer_port);
+#else
+        printf("%" PRIu16 " <-> %" PRIu16, tcb->local_port, tcb->peer_port);
+#endif
+        printf(" %s, cc: %s%s%s%s\n", states[tcb->state], tcb->cc->name,
+               (tcb->status & STATUS_SACK) ? ", sack" : "",
+               (tcb->status & STATUS_TIMESTAMPS) ? ", timestamps" : "",
+               (locked) ? "" : ", busy (values may be inconsistent)");
+        printf("    cwnd: %" PRIu32 ", ssthresh: %" PRIu32 ", snd_wnd: %" PRIu16
+               ", rcv_wnd: %" PRIu16 ", in flight: %" PRIu32 " bytes\n",
+               tcb->cwnd, tcb->ssthresh, tcb->snd_wnd, tcb->rcv_wnd,
+               (uint32_t) (tcb->snd_nxt - tcb->snd_una));
+        printf("    srtt: %" PRIi32 " us, rttvar: %" PRIi32 " us, rto: %" PRIi32 " us\n",
+               tcb->srtt, tcb->rtt_var, tcb->rto);
+        printf("    retransmits: %" PRIu32 " (%" PRIu32 " bytes), fast retransmits: %"
+               PRIu32 ", timeouts: %" PRIu32 "\n",
+               tcb->retransmits, tcb->rtx_bytes, tcb->fast_retransmits, tcb->timeouts);
+        if (locked) {
+            mutex_unlock(&(tcb->fsm_lock));
+        }
+    }
+    mutex_unlock(&_list_tcb_lock);
+}
@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/cc.h
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ * @}
+ */
+#include <stdlib.h>
+#include "internal/common.h"
+#include "internal/pkt.h"
+#include "internal/cc.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+void _cc_init(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->cwnd_acked = 0;
+    tcb->dup_acks = 0;
+    tcb->status &= ~(STATUS_RECOVERY | STATUS_FAST_RECOVERY);
+    tcb->cc->init(tcb);
+    DEBUG("gnrc_tcp_cc.c : _cc_init() : %s, cwnd=%"PRIu32", ssthresh=%"PRIu32"\n",
+          tcb->cc->name, tcb->cwnd, tcb->ssthresh);
+}
+
+void _cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    tcb->dup_acks = 0;
+
+    if (tcb->status & STATUS_RECOVERY) {
+        bool fast = (tcb->status & STATUS_FAST_RECOVERY);
+
+        /* Partial ACK: the pkt layer retransmits the next segment */
+        if (LSS_32_BIT(tcb->snd_una, tcb->recover)) {
+            if (fast) {
+                /* Deflate by the acknowledged data, allow one new segment (RFC 6582) */
+                tcb->cwnd = (tcb->cwnd > acked) ? tcb->cwnd - acked : 0;
+                tcb->cwnd += gnrc_tcp_cc_smss(tcb);
+                return;
+            }
+        }
+        /* Full ACK: leave recovery */
+        else {
+            tcb->status &= ~(STATUS_RECOVERY | STATUS_FAST_RECOVERY);
+            tcb->rtx_resent = 0;
+            if (fast) {
+                uint32_t flight = gnrc_tcp_cc_flight(tcb) + gnrc_tcp_cc_smss(tcb);
+                tcb->cwnd = (tcb->ssthresh < flight) ? tcb->ssthresh : flight;
+                DEBUG("gnrc_tcp_cc.c : _cc_ack() : Fast recovery done, cwnd=%"PRIu32"\n",
+                      tcb->cwnd);
+                return;
+            }
+        }
+    }
+    tcb->cc->ack(tcb, acked);
+}
+
+void _cc_dup_ack(gnrc_tcp_tcb_t *tcb)
+{
+    /* Every duplicate ACK signals a segment that left the network: inflate cwnd */
+    if (tcb->status & STATUS_FAST_RECOVERY) {
+        tcb->cwnd += gnrc_tcp_cc_smss(tcb);
+
+        /* SACK blocks tell about further holes, fill them one per ACK */
+        if (tcb->status & STATUS_SACK) {
+            _pkt_retransmit(tcb, true);
+        }
+        return;
+    }
+    /* Segments are retransmitted on partial ACKs after a timeout already */
+    if (tcb->status & STATUS_RECOVERY) {
+        return;
+    }
+    tcb->dup_acks += 1;
+    if (tcb->dup_acks < GNRC_TCP_DUP_ACK_THRESHOLD) {
+        return;
+    }
+
+    /* Fast retransmit the missing segment and enter fast recovery */
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= (STATUS_RECOVERY | STATUS_FAST_RECOVERY);
+    tcb->cc->loss(tcb, false);
+    tcb->cwnd = tcb->ssthresh + GNRC_TCP_DUP_ACK_THRESHOLD * gnrc_tcp_cc_smss(tcb);
+    tcb->fast_retransmits += 1;
+    tcb->rtx_resent = 0;
+    DEBUG("gnrc_tcp_cc.c : _cc_dup_ack() : Fast retransmit, ssthresh=%"PRIu32"\n",
+          tcb->ssthresh);
+    _pkt_retransmit(tcb, false);
+}
+
+void _cc_timeout(gnrc_tcp_tcb_t *tcb)
+{
+    /* Go back to slow start, segments up to recover are resent on partial ACKs */
+    tcb->recover = tcb->snd_nxt;
+    tcb->status |= STATUS_RECOVERY;
+    tcb->status &= ~STATUS_FAST_RECOVERY;
+    tcb->dup_acks = 0;
+    tcb->cwnd_acked = 0;
+    tcb->timeouts += 1;
+
+    /* The receiver may have discarded data it SACKed, so the SACK information
+     * is cleared after a timeout (RFC 2018, section 8) */
+    tcb->rtx_sacked = 0;
+    tcb->rtx_resent = 0;
+
+    /* Connections that are not established yet have no congestion state */
+    if (tcb->cwnd > 0) {
+        tcb->cc->loss(tcb, true);
+    }
+    DEBUG("gnrc_tcp_cc.c : _cc_timeout() : cwnd=%"PRIu32", ssthresh=%"PRIu32"\n",
+          tcb->cwnd, tcb->ssthresh);
+}
+
+void _cc_rtt_sample(gnrc_tcp_tcb_t *tcb, int32_t rtt)
+{
+    if (rtt < tcb->rtt_min) {
+        tcb->rtt_min = rtt;
+    }
+
+    /* If this is the first sample taken */
+    if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->srtt = rtt;
+        tcb->rtt_var = (rtt >> 1);
+    }
+    /* If this is a subsequent sample */
+    else {
+        tcb->rtt_var = (tcb->rtt_var / GNRC_TCP_RTO_B_DIV) * (GNRC_TCP_RTO_B_DIV-1);
+        tcb->rtt_var += abs(tcb->srtt - rtt) / GNRC_TCP_RTO_B_DIV;
+        tcb->srtt = (tcb->srtt / GNRC_TCP_RTO_A_DIV) * (GNRC_TCP_RTO_A_DIV-1);
+        tcb->srtt += rtt / GNRC_TCP_RTO_A_DIV;
+    }
+}
+
+void _cc_calc_rto(gnrc_tcp_tcb_t *tcb)
+{
+    /* If there is no RTT estimation: rto is 1 sec (Lower Bound) */
+    if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else {
+        int32_t var = GNRC_TCP_RTO_K * tcb->rtt_var;
+        tcb->rto = tcb->srtt + ((var > (int32_t) GNRC_TCP_RTO_GRANULARITY) ?
+                                var : (int32_t) GNRC_TCP_RTO_GRANULARITY);
+    }
+}
+
+void _cc_backoff(gnrc_tcp_tcb_t *tcb)
+{
+    tcb->rto = tcb->cc->backoff(tcb);
+
+    /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
+    /* New measurements must be taken the next time something is sent. */
+    if (tcb->retries >= 5) {
+        tcb->srtt = RTO_UNINITIALIZED;
+        tcb->rtt_var = RTO_UNINITIALIZED;
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Delay based congestion control, with CoCoA's variable backoff
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ * @}
+ */
+#include "timex.h"
+#include "net/gnrc/tcp/cc.h"
+
+/**
+ * @brief RTO below which the RTO backs off by a factor of 3
+ */
+#define VBF_RTO_SHORT   (1U * US_PER_SEC)
+
+/**
+ * @brief RTO above which the RTO backs off by a factor of 1.5
+ */
+#define VBF_RTO_LONG    (3U * US_PER_SEC)
+
+/* The smoothed RTT exceeds the smallest RTT by half: segments are queued */
+static bool _delayed(const gnrc_tcp_tcb_t *tcb)
+{
+    if (tcb->srtt <= 0 || tcb->rtt_min <= 0 || tcb->rtt_min == INT32_MAX) {
+        return false;
+    }
+    return (tcb->srtt > tcb->rtt_min + (tcb->rtt_min / 2));
+}
+
+static void _init(gnrc_tcp_tcb_t *tcb)
+{
+    /* Start with two segments, lossy links are easily overwhelmed */
+    tcb->cwnd = 2 * gnrc_tcp_cc_smss(tcb);
+    tcb->ssthresh = UINT16_MAX;
+}
+
+static void _ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    if (_delayed(tcb)) {
+        /* Leave slow start once a queue builds up, keep the window otherwise */
+        if (tcb->cwnd < tcb->ssthresh) {
+            tcb->ssthresh = tcb->cwnd;
+        }
+        return;
+    }
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+        return;
+    }
+    tcb->cwnd_acked += acked;
+    if (tcb->cwnd_acked >= tcb->cwnd) {
+        tcb->cwnd_acked -= tcb->cwnd;
+        tcb->cwnd += smss;
+    }
+}
+
+static void _loss(gnrc_tcp_tcb_t *tcb, bool timeout)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+    uint32_t flight = gnrc_tcp_cc_flight(tcb);
+
+    /* A loss without a queue is most likely a link loss: back off less */
+    flight = _delayed(tcb) ? flight / 2 : flight - (flight / 4);
+    tcb->ssthresh = (flight > 2 * smss) ? flight : 2 * smss;
+    if (timeout) {
+        tcb->cwnd = smss;
+    }
+}
+
+static int32_t _backoff(const gnrc_tcp_tcb_t *tcb)
+{
+    /* Variable backoff factor */
+    if (tcb->rto < (int32_t) VBF_RTO_SHORT) {
+        return tcb->rto * 3;
+    }
+    if (tcb->rto > (int32_t) VBF_RTO_LONG) {
+        return tcb->rto + (tcb->rto / 2);
+    }
+    return tcb->rto * 2;
+}
+
+const gnrc_tcp_cc_t gnrc_tcp_cc_cocoa = {
+    .name = "cocoa",
+    .init = _init,
+    .ack = _ack,
+    .loss = _loss,
+    .backoff = _backoff,
+};
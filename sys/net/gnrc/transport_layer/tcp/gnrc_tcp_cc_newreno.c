@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       NewReno congestion control
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ * @}
+ */
+#include "net/gnrc/tcp/cc.h"
+
+static void _init(gnrc_tcp_tcb_t *tcb)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    /* Initial window (RFC 5681, 3.1) */
+    if (smss > 2190) {
+        tcb->cwnd = 2 * smss;
+    }
+    else if (smss > 1095) {
+        tcb->cwnd = 3 * smss;
+    }
+    else {
+        tcb->cwnd = 4 * smss;
+    }
+    /* Arbitrarily high, the send window is limited to 16 bit anyway */
+    tcb->ssthresh = UINT16_MAX;
+}
+
+static void _ack(gnrc_tcp_tcb_t *tcb, uint32_t acked)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+
+    /* Slow start: grow by up to one SMSS per ACK */
+    if (tcb->cwnd < tcb->ssthresh) {
+        tcb->cwnd += (acked < smss) ? acked : smss;
+        return;
+    }
+    /* Congestion avoidance: grow by one SMSS per cwnd acknowledged */
+    tcb->cwnd_acked += acked;
+    if (tcb->cwnd_acked >= tcb->cwnd) {
+        tcb->cwnd_acked -= tcb->cwnd;
+        tcb->cwnd += smss;
+    }
+}
+
+static void _loss(gnrc_tcp_tcb_t *tcb, bool timeout)
+{
+    uint32_t smss = gnrc_tcp_cc_smss(tcb);
+    uint32_t half = gnrc_tcp_cc_flight(tcb) / 2;
+
+    tcb->ssthresh = (half > 2 * smss) ? half : 2 * smss;
+    if (timeout) {
+        /* Loss window */
+        tcb->cwnd = smss;
+    }
+}
+
+static int32_t _backoff(const gnrc_tcp_tcb_t *tcb)
+{
+    return tcb->rto * 2;
+}
+
+const gnrc_tcp_cc_t gnrc_tcp_cc_newreno = {
+    .name = "newreno",
+    .init = _init,
+    .ack = _ack,
+    .loss = _loss,
+    .backoff = _backoff,
+};
@@ -22,6 +22,7 @@
 #include "net/af.h"
 #include "net/tcp.h"
 #include "net/gnrc.h"
+#include "net/gnrc/tcp.h"
 #include "internal/common.h"
 #include "internal/pkt.h"
 #include "internal/fsm.h"
@@ -36,6 +37,15 @@
 
 static msg_t _eventloop_msg_queue[TCP_EVENTLOOP_MSG_QUEUE_SIZE];
 
+#ifdef TEST_SUITES
+static gnrc_tcp_send_hook_t _send_hook = NULL;
+
+void gnrc_tcp_set_send_hook(gnrc_tcp_send_hook_t hook)
+{
+    _send_hook = hook;
+}
+#endif
+
 /**
  * @brief Send function, pass paket down the network stack.
  *
@@ -74,6 +84,14 @@ static int _send(gnrc_pktsnip_t *pkt)
     }
 #endif
 
+#ifdef TEST_SUITES
+    if ((_send_hook != NULL) && !_send_hook(pkt)) {
+        DEBUG("gnrc_tcp_eventloop : _send() : dropped by hook\n");
+        gnrc_pktbuf_release(pkt);
+        return 0;
+    }
+#endif
+
     /* Dispatch packet to network layer */
     assert(nw != NULL);
     if (!gnrc_netapi_dispatch_send(nw->type, GNRC_NETREG_DEMUX_CTX_ALL, pkt)) {
@@ -26,6 +26,8 @@
 #include "internal/pkt.h"
 #include "internal/option.h"
 #include "internal/rcvbuf.h"
+#include "internal/cc.h"
+#include "internal/sack.h"
 #include "internal/fsm.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -83,11 +85,20 @@ static uint16_t _get_random_local_port(void)
  */
 static int _clear_retransmit(gnrc_tcp_tcb_t *tcb)
 {
-    if (tcb->pkt_retransmit != NULL) {
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
+    if (tcb->rtx_len > 0) {
         xtimer_remove(&(tcb->tim_tout));
-        tcb->pkt_retransmit = NULL;
+        for (uint8_t i = 0; i < tcb->rtx_len; ++i) {
+            size_t idx = (tcb->rtx_head + i) % RTX_QUEUE_LEN;
+
+            gnrc_pktbuf_release(tcb->rtx_queue[idx]);
+            tcb->rtx_queue[idx] = NULL;
+        }
+        tcb->rtx_head = 0;
+        tcb->rtx_len = 0;
     }
+    tcb->rtx_sacked = 0;
+    tcb->rtx_resent = 0;
+    tcb->status &= ~STATUS_RTT_PENDING;
     return 0;
 }
 
@@ -123,8 +134,10 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
 
     switch (state) {
         case FSM_STATE_CLOSED:
-            /* Clear retransmit queue */
+            /* Clear retransmit queue and out-of-order segments */
             _clear_retransmit(tcb);
+            _sack_clear(tcb);
+            tcb->status &= ~(STATUS_SACK | STATUS_TIMESTAMPS);
 
             /* Remove connection from active connections */
             mutex_lock(&_list_tcb_lock);
@@ -191,8 +204,13 @@ static int _transition_to(gnrc_tcp_tcb_t *tcb, fsm_state_t state)
             mutex_unlock(&_list_tcb_lock);
             break;
 
-        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_ESTABLISHED:
+            /* The peers MSS is known: setup congestion control */
+            _cc_init(tcb);
+            tcb->status |= STATUS_NOTIFY_USER;
+            break;
+
+        case FSM_STATE_SYN_RCVD:
         case FSM_STATE_CLOSE_WAIT:
             tcb->status |= STATUS_NOTIFY_USER;
             break;
@@ -222,7 +240,6 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
     int ret = 0;
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_open()\n");
-    tcb->rcv_wnd = GNRC_TCP_DEFAULT_WINDOW;
 
     if (tcb->status & STATUS_PASSIVE) {
         /* Passive open, T: CLOSED -> LISTEN */
@@ -230,6 +247,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
             _transition_to(tcb, FSM_STATE_CLOSED);
             return -ENOMEM;
         }
+        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
     }
     else {
         /* Active Open, set TCB values, send SYN, T: CLOSED -> SYN_SENT */
@@ -243,6 +261,7 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
             _transition_to(tcb, FSM_STATE_CLOSED);
             return ret;
         }
+        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
 
         /* Send SYN */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -257,6 +276,9 @@ static int _fsm_call_open(gnrc_tcp_tcb_t *tcb)
 /**
  * @brief FSM Handling function for sending data.
  *
+ * Sends MSS sized segments as long as the send window and the retransmit
+ * queue have room for them.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in,out] buf   Buffer containing data to send.
  * @param[in]     len   Maximum Number of Bytes to send from @p buf.
@@ -267,24 +289,34 @@ static int _fsm_call_send(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_call_send()\n");
 
-    size_t payload = (tcb->snd_una + tcb->snd_wnd) - tcb->snd_nxt;
+    size_t sent = 0;
+
+    /* Keep one slot of the retransmit queue for the FIN */
+    while (sent < len && tcb->rtx_len < GNRC_TCP_RTX_QUEUE_SIZE) {
+        /* Calculate usable window, it may have shrunk below the data in flight */
+        int32_t wnd = (tcb->snd_una + _cc_wnd(tcb)) - tcb->snd_nxt;
+        if (wnd <= 0) {
+            break;
+        }
 
-    /* Check if window is open and all packets were transmitted */
-    if (payload > 0 && tcb->snd_wnd > 0 && tcb->pkt_retransmit == NULL) {
         /* Calculate segment size */
+        size_t payload = (size_t) wnd;
         payload = (payload < GNRC_TCP_MSS) ? payload : GNRC_TCP_MSS;
         payload = (payload < tcb->mss) ? payload : tcb->mss;
-        payload = (payload < len) ? payload : len;
+        payload = (payload < (len - sent)) ? payload : (len - sent);
 
-        /* Calculate payload size for this segment */
+        /* Build segment, stop if the packet buffer is exhausted */
         gnrc_pktsnip_t *out_pkt = NULL;
         uint16_t seq_con = 0;
-        _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt, buf, payload);
+        if (_pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK | MSK_PSH, tcb->snd_nxt, tcb->rcv_nxt,
+                       (uint8_t *) buf + sent, payload) < 0) {
+            break;
+        }
         _pkt_setup_retransmit(tcb, out_pkt, false);
         _pkt_send(tcb, out_pkt, seq_con, false);
-        return payload;
+        sent += payload;
     }
-    return 0;
+    return sent;
 }
 
 /**
@@ -307,9 +339,12 @@ static int _fsm_call_recv(gnrc_tcp_tcb_t *tcb, void *buf, size_t len)
     /* Read data into 'buf' up to 'len' bytes from receive buffer */
     size_t rcvd = ringbuffer_get(&(tcb->rcv_buf), buf, len);
 
-    /* If receive buffer can store more than GNRC_TCP_MSS: open window to available buffer size */
-    if (ringbuffer_get_free(&tcb->rcv_buf) >= GNRC_TCP_MSS) {
-        tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
+    /* Open window to available buffer size if it grows by a MSS or half the buffer,
+     * so the peer is not invited to send tiny segments (Silly Window Syndrome) */
+    unsigned free = ringbuffer_get_free(&tcb->rcv_buf);
+    unsigned step = (tcb->rcv_buf.size / 2 < GNRC_TCP_MSS) ? tcb->rcv_buf.size / 2 : GNRC_TCP_MSS;
+    if (free >= tcb->rcv_wnd + step) {
+        tcb->rcv_wnd = free;
 
         /* Send ACK to anounce window update */
         gnrc_pktsnip_t *out_pkt = NULL;
@@ -383,6 +418,24 @@ static int _fsm_call_abort(gnrc_tcp_tcb_t *tcb)
     return 0;
 }
 
+/**
+ * @brief Takes an RTT sample from the timestamp echoed by the peer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     opt   Options of the received segment.
+ */
+static void _rtt_sample_ts(gnrc_tcp_tcb_t *tcb, const option_t *opt)
+{
+    if ((tcb->status & STATUS_TIMESTAMPS) && (opt->flags & OPTION_TIMESTAMP) && opt->ts_ecr) {
+        uint32_t rtt = _option_ts_now() - opt->ts_ecr;
+
+        /* Timestamps have a resolution of 1 ms, shorter RTTs are not taken */
+        if (rtt > 0 && rtt <= GNRC_TCP_RTO_UPPER_BOUND / US_PER_MS) {
+            _cc_rtt_sample(tcb, (int32_t) (rtt * US_PER_MS));
+        }
+    }
+}
+
 /**
  * @brief FSM handling function for processing of an incomming TCP packet.
  *
@@ -404,6 +457,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     uint32_t seg_wnd = 0;            /* Receive window of the incomming packet */
     uint32_t seg_len = 0;            /* Segment length of the incomming packet */
     uint32_t pay_len = 0;            /* Payload length of the incomming packet */
+    option_t opt;                    /* Timestamps and SACK blocks of the incomming packet */
 
     DEBUG("gnrc_tcp_fsm.c : _fsm_rcvd_pkt()\n");
     /* Search for TCP header. */
@@ -411,7 +465,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     tcp_hdr_t *tcp_hdr = (tcp_hdr_t *) snp->data;
 
     /* Parse packet options, return if they are malformed */
-    if (_option_parse(tcb, tcp_hdr) < 0) {
+    if (_option_parse(tcb, tcp_hdr, &opt) < 0) {
         return 0;
     }
 
@@ -543,6 +597,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             tcb->irs = seg_seq;
             if (ctl & MSK_ACK) {
                 tcb->snd_una = seg_ack;
+                _rtt_sample_ts(tcb, &opt);
                 _pkt_acknowledge(tcb, seg_ack);
             }
             /* Set local network layer address accordingly */
@@ -578,6 +633,14 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
     else {
         seg_len = _pkt_get_seg_len(in_pkt);
         pay_len = _pkt_get_pay_len(in_pkt);
+        /* 0) Reject old duplicates by their timestamp (PAWS, RFC 7323) ... */
+        if ((tcb->status & STATUS_TIMESTAMPS) && (opt.flags & OPTION_TIMESTAMP) &&
+            !(ctl & MSK_RST) && LSS_32_BIT(opt.ts_val, tcb->ts_recent)) {
+            /* ... reply with pure ACK, return */
+            _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt, NULL, 0);
+            _pkt_send(tcb, out_pkt, seq_con, false);
+            return 0;
+        }
         /* 1) Verify sequence number ... */
         if (_pkt_chk_seq_num(tcb, seg_seq, pay_len)) {
             /* ... if invalid, and RST not set, reply with pure ACK, return */
@@ -587,6 +650,11 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             }
             return 0;
         }
+        /* Remember the timestamp to echo, if the segment does not follow a gap */
+        if ((tcb->status & STATUS_TIMESTAMPS) && (opt.flags & OPTION_TIMESTAMP) &&
+            LEQ_32_BIT(seg_seq, tcb->rcv_nxt)) {
+            tcb->ts_recent = opt.ts_val;
+        }
         /* 2) Check RST: If RST is set ... */
         if (ctl & MSK_RST) {
             /* .. and state is SYN_RCVD and the connection is passive: SYN_RCVD -> LISTEN */
@@ -630,10 +698,29 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
             if (tcb->state == FSM_STATE_ESTABLISHED || tcb->state == FSM_STATE_FIN_WAIT_1 ||
                 tcb->state == FSM_STATE_FIN_WAIT_2 || tcb->state == FSM_STATE_CLOSE_WAIT ||
                 tcb->state == FSM_STATE_CLOSING || tcb->state == FSM_STATE_LAST_ACK) {
+                /* Mark the segments the peer received out of order */
+                if ((tcb->status & STATUS_SACK) && (opt.flags & OPTION_SACK)) {
+                    _sack_mark(tcb, &opt);
+                }
                 /* Acknowledge previously sent data */
                 if (LSS_32_BIT(tcb->snd_una, seg_ack) && LEQ_32_BIT(seg_ack, tcb->snd_nxt)) {
+                    uint32_t acked = seg_ack - tcb->snd_una;
+
                     tcb->snd_una = seg_ack;
+                    _rtt_sample_ts(tcb, &opt);
                     _pkt_acknowledge(tcb, seg_ack);
+                    _cc_ack(tcb, acked);
+
+                    /* Signal user: the retransmit queue has room again */
+                    tcb->status |= STATUS_NOTIFY_USER;
+                }
+                /* Duplicate ACK: no data, no window update, data outstanding (RFC 5681) */
+                else if (seg_ack == tcb->snd_una && pay_len == 0 && seg_wnd == tcb->snd_wnd &&
+                         tcb->rtx_len > 0 && !(ctl & (MSK_SYN | MSK_FIN))) {
+                    _cc_dup_ack(tcb);
+
+                    /* Signal user: an inflated window may allow new data */
+                    tcb->status |= STATUS_NOTIFY_USER;
                 }
                 /* ACK received for something not yet sent: Reply with pure ACK */
                 else if (LSS_32_BIT(tcb->snd_nxt, seg_ack)) {
@@ -657,25 +744,25 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 /* Additional processing */
                 /* Check additionaly if previously sent FIN was acknowledged */
                 if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_FIN_WAIT_2);
                     }
                 }
                 /* If retransmission queue is empty, acknowledge close operation */
                 if (tcb->state == FSM_STATE_FIN_WAIT_2) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         /* Optional: Unblock user close operation */
                     }
                 }
                 /* If our FIN has been acknowledged: Transition to TIME_WAIT */
                 if (tcb->state == FSM_STATE_CLOSING) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_TIME_WAIT);
                     }
                 }
                 /* If our FIN was acknowledged and status is LAST_ACK: close connection */
                 if (tcb->state == FSM_STATE_LAST_ACK) {
-                    if (tcb->pkt_retransmit == NULL) {
+                    if (tcb->rtx_len == 0) {
                         _transition_to(tcb, FSM_STATE_CLOSED);
                         return 0;
                     }
@@ -700,22 +787,31 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                         tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), snp->data, snp->size);
                         snp = snp->next;
                     }
+                    /* Segments kept out of order may continue the data now */
+                    if (tcb->status & STATUS_SACK) {
+                        _sack_drain(tcb);
+                    }
                     /* Shrink receive window */
                     tcb->rcv_wnd = ringbuffer_get_free(&(tcb->rcv_buf));
                     /* Notify owner because new data is available */
                     tcb->status |= STATUS_NOTIFY_USER;
                 }
+                /* Keep segments following a gap to SACK them and use them later */
+                else if ((tcb->status & STATUS_SACK) && LSS_32_BIT(tcb->rcv_nxt, seg_seq) &&
+                         !(ctl & MSK_FIN)) {
+                    _sack_queue(tcb, in_pkt);
+                }
                 /* Send ACK, if FIN processing sends ACK already */
                 /* NOTE: this is the place to add payload piggybagging in the future */
-                if (!(ctl & MSK_FIN)) {
+                if (!(ctl & MSK_FIN) || tcb->rcv_nxt != seg_seq + pay_len) {
                     _pkt_build(tcb, &out_pkt, &seq_con, MSK_ACK, tcb->snd_nxt, tcb->rcv_nxt,
                                NULL, 0);
                     _pkt_send(tcb, out_pkt, seq_con, false);
                 }
             }
         }
-        /* 7) Check FIN */
-        if (ctl & MSK_FIN) {
+        /* 7) Check FIN, if all data before it was received */
+        if ((ctl & MSK_FIN) && tcb->rcv_nxt == seg_seq + pay_len) {
             if (tcb->state == FSM_STATE_CLOSED || tcb->state == FSM_STATE_LISTEN ||
                 tcb->state == FSM_STATE_SYN_SENT) {
                 return 0;
@@ -729,7 +825,7 @@ static int _fsm_rcvd_pkt(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *in_pkt)
                 _transition_to(tcb, FSM_STATE_CLOSE_WAIT);
             }
             else if (tcb->state == FSM_STATE_FIN_WAIT_1) {
-                if (tcb->pkt_retransmit == NULL) {
+                if (tcb->rtx_len == 0) {
                     _transition_to(tcb, FSM_STATE_TIME_WAIT);
                 }
                 else {
@@ -771,9 +867,12 @@ static int _fsm_timeout_timewait(gnrc_tcp_tcb_t *tcb)
 static int _fsm_timeout_retransmit(gnrc_tcp_tcb_t *tcb)
 {
     DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit()\n");
-    if (tcb->pkt_retransmit != NULL) {
-        _pkt_setup_retransmit(tcb, tcb->pkt_retransmit, true);
-        _pkt_send(tcb, tcb->pkt_retransmit, 0, true);
+    if (tcb->rtx_len > 0) {
+        /* Retransmit the oldest unacknowledged segment */
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[tcb->rtx_head];
+        _cc_timeout(tcb);
+        _pkt_setup_retransmit(tcb, pkt, true);
+        _pkt_send(tcb, pkt, 0, true);
     }
     else {
         DEBUG("gnrc_tcp_fsm.c : _fsm_timeout_retransmit() : Retransmit queue is empty\n");
@@ -16,16 +16,48 @@
  * @author      Simon Brummer <simon.brummer@posteo.de>
  * @}
  */
+#include <stdbool.h>
+#include <string.h>
+#include "byteorder.h"
 #include "internal/common.h"
+#include "internal/sack.h"
 #include "internal/option.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+/**
+ * @brief Reads a 32 bit value in network byte order from an option.
+ */
+static uint32_t _get_u32(const uint8_t *buf)
 {
+    network_uint32_t val;
+    memcpy(&val, buf, sizeof(val));
+    return byteorder_ntohl(val);
+}
+
+/**
+ * @brief Writes a 32 bit value in network byte order into an option.
+ */
+static void _set_u32(uint8_t *buf, uint32_t val)
+{
+    network_uint32_t tmp = byteorder_htonl(val);
+    memcpy(buf, &tmp, sizeof(tmp));
+}
+
+int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, option_t *opt)
+{
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+
+    memset(opt, 0, sizeof(*opt));
+
+    /* Options in use are negotiated on connection setup */
+    if (ctl & MSK_SYN) {
+        tcb->status &= ~(STATUS_SACK | STATUS_TIMESTAMPS);
+    }
+
     /* Extract offset value. Return if no options are set */
-    uint8_t offset = GET_OFFSET(byteorder_ntohs(hdr->off_ctl));
+    uint8_t offset = GET_OFFSET(ctl);
     if (offset <= TCP_HDR_OFFSET_MIN) {
         return 0;
     }
@@ -50,6 +82,17 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                 opt_left -= 1;
                 continue;
 
+            default:
+                break;
+        }
+
+        /* Any other option has a length field covering at least kind and length */
+        if (opt_left < 2 || option->length < 2 || option->length > opt_left) {
+            DEBUG("gnrc_tcp_option.c : _option_parse() : invalid option length.\n");
+            return -1;
+        }
+
+        switch (option->kind) {
             case TCP_OPTION_KIND_MSS:
                 if (option->length != TCP_OPTION_LENGTH_MSS) {
                     DEBUG("gnrc_tcp_option.c : _option_parse() : invalid MSS Option length.\n");
@@ -60,6 +103,56 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
                       tcb->mss);
                 break;
 
+            case TCP_OPTION_KIND_SACK_PERM:
+                if (option->length != TCP_OPTION_LENGTH_SACK_PERM) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK_PERM length.\n");
+                    return -1;
+                }
+                /* A SYN+ACK offers SACK only if our SYN did, depending on the same config */
+                if ((ctl & MSK_SYN) && GNRC_TCP_SACK) {
+                    tcb->status |= STATUS_SACK;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK_PERM option found\n");
+                break;
+
+            case TCP_OPTION_KIND_SACK: {
+                uint8_t num = (option->length - 2) / TCP_OPTION_LENGTH_SACK_BLOCK;
+
+                if (num == 0 || (option->length - 2) % TCP_OPTION_LENGTH_SACK_BLOCK) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid SACK length.\n");
+                    return -1;
+                }
+                if (num > OPTION_SACK_BLOCKS_MAX) {
+                    num = OPTION_SACK_BLOCKS_MAX;
+                }
+                for (uint8_t i = 0; i < num; i++) {
+                    opt->sack[i][0] = _get_u32(option->value + i * TCP_OPTION_LENGTH_SACK_BLOCK);
+                    opt->sack[i][1] = _get_u32(option->value + i * TCP_OPTION_LENGTH_SACK_BLOCK
+                                               + 4);
+                }
+                opt->sack_num = num;
+                opt->flags |= OPTION_SACK;
+                DEBUG("gnrc_tcp_option.c : _option_parse() : SACK option found. Blocks=%"PRIu8"\n",
+                      num);
+                break;
+            }
+
+            case TCP_OPTION_KIND_TIMESTAMP:
+                if (option->length != TCP_OPTION_LENGTH_TIMESTAMP) {
+                    DEBUG("gnrc_tcp_option.c : _option_parse() : invalid Timestamps length.\n");
+                    return -1;
+                }
+                opt->ts_val = _get_u32(option->value);
+                opt->ts_ecr = _get_u32(option->value + 4);
+                opt->flags |= OPTION_TIMESTAMP;
+                if ((ctl & MSK_SYN) && GNRC_TCP_TIMESTAMPS) {
+                    tcb->status |= STATUS_TIMESTAMPS;
+                    tcb->ts_recent = opt->ts_val;
+                }
+                DEBUG("gnrc_tcp_option.c : _option_parse() : Timestamps option found.\
+                      TSval=%"PRIu32", TSecr=%"PRIu32"\n", opt->ts_val, opt->ts_ecr);
+                break;
+
             default:
                 DEBUG("gnrc_tcp_option.c : _option_parse() : Unknown option found.\
                       KIND=%"PRIu8", LENGTH=%"PRIu8"\n", option->kind, option->length);
@@ -69,3 +162,89 @@ int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
     }
     return 0;
 }
+
+size_t _option_build(gnrc_tcp_tcb_t *tcb, uint8_t *buf, uint16_t ctl)
+{
+    uint8_t *ptr = buf;
+    bool ts = false;
+
+    /* A reset carries no options */
+    if (ctl & MSK_RST) {
+        return 0;
+    }
+
+    if (ctl & MSK_SYN) {
+        /* Add MSS option */
+        network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
+        memcpy(ptr, &mss_option, sizeof(mss_option));
+        ptr += sizeof(mss_option);
+
+        /* A SYN offers SACK if enabled, a SYN+ACK only if the peer offered it too */
+        if ((ctl & MSK_ACK) ? (tcb->status & STATUS_SACK) : GNRC_TCP_SACK) {
+            *ptr++ = TCP_OPTION_KIND_NOP;
+            *ptr++ = TCP_OPTION_KIND_NOP;
+            *ptr++ = TCP_OPTION_KIND_SACK_PERM;
+            *ptr++ = TCP_OPTION_LENGTH_SACK_PERM;
+        }
+        ts = (ctl & MSK_ACK) ? (tcb->status & STATUS_TIMESTAMPS) : GNRC_TCP_TIMESTAMPS;
+    }
+    else {
+        ts = (tcb->status & STATUS_TIMESTAMPS);
+    }
+
+    /* Add timestamps option, the echo reply is valid if ACK is set */
+    if (ts) {
+        *ptr++ = TCP_OPTION_KIND_NOP;
+        *ptr++ = TCP_OPTION_KIND_NOP;
+        *ptr++ = TCP_OPTION_KIND_TIMESTAMP;
+        *ptr++ = TCP_OPTION_LENGTH_TIMESTAMP;
+        _set_u32(ptr, _option_ts_now());
+        _set_u32(ptr + 4, (ctl & MSK_ACK) ? tcb->ts_recent : 0);
+        ptr += 8;
+    }
+
+    /* Report out-of-order segments, three blocks fit next to the timestamps */
+    if (!(ctl & MSK_SYN) && (tcb->status & STATUS_SACK)) {
+        uint32_t blocks[OPTION_SACK_BLOCKS_MAX][2];
+        unsigned num = _sack_blocks(tcb, blocks, ts ? OPTION_SACK_BLOCKS_MAX - 1 :
+                                                      OPTION_SACK_BLOCKS_MAX);
+        if (num > 0) {
+            *ptr++ = TCP_OPTION_KIND_NOP;
+            *ptr++ = TCP_OPTION_KIND_NOP;
+            *ptr++ = TCP_OPTION_KIND_SACK;
+            *ptr++ = 2 + num * TCP_OPTION_LENGTH_SACK_BLOCK;
+            for (unsigned i = 0; i < num; i++) {
+                _set_u32(ptr, blocks[i][0]);
+                _set_u32(ptr + 4, blocks[i][1]);
+                ptr += TCP_OPTION_LENGTH_SACK_BLOCK;
+            }
+        }
+    }
+    assert((size_t) (ptr - buf) <= OPTION_SIZE_MAX && (ptr - buf) % 4 == 0);
+    return ptr - buf;
+}
+
+void _option_ts_update(const gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr)
+{
+    uint16_t ctl = byteorder_ntohs(hdr->off_ctl);
+    uint8_t *opt_ptr = (uint8_t *) hdr + sizeof(tcp_hdr_t);
+    uint8_t opt_left = (GET_OFFSET(ctl) - TCP_HDR_OFFSET_MIN) * 4;
+
+    /* Options were built by _option_build(), no need to check them again */
+    while (opt_left >= 2 && *opt_ptr != TCP_OPTION_KIND_EOL) {
+        tcp_hdr_opt_t *option = (tcp_hdr_opt_t *) opt_ptr;
+
+        if (option->kind == TCP_OPTION_KIND_NOP) {
+            opt_ptr += 1;
+            opt_left -= 1;
+            continue;
+        }
+        if (option->kind == TCP_OPTION_KIND_TIMESTAMP) {
+            _set_u32(option->value, _option_ts_now());
+            _set_u32(option->value + 4, (ctl & MSK_ACK) ? tcb->ts_recent : 0);
+            return;
+        }
+        opt_ptr += option->length;
+        opt_left -= option->length;
+    }
+}
@@ -24,6 +24,7 @@
 #include "net/gnrc.h"
 #include "internal/common.h"
 #include "internal/option.h"
+#include "internal/cc.h"
 #include "internal/pkt.h"
 
 #ifdef MODULE_GNRC_IPV6
@@ -33,19 +34,6 @@
 #define ENABLE_DEBUG (0)
 #include "debug.h"
 
-/**
- * @brief Calculates the maximum of two unsigned numbers.
- *
- * @param[in] x   First comparrison value.
- * @param[in] y   Second comparrison value.
- *
- * @returns   X if x is larger than y, if not y is returned.
- */
-static inline uint32_t _max(const uint32_t x, const uint32_t y)
-{
-  return (x > y) ? x : y;
-}
-
 int _pkt_build_reset_from_pkt(gnrc_pktsnip_t **out_pkt, gnrc_pktsnip_t *in_pkt)
 {
     tcp_hdr_t tcp_hdr_out;
@@ -168,10 +156,10 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     tcp_hdr.urgent_ptr = byteorder_htons(0);
 
     /* Calculate option field size. */
-    /* Add MSS option if SYN is sent */
-    if (ctl & MSK_SYN) {
-        offset += 1;
-    }
+    uint8_t opt_buf[OPTION_SIZE_MAX];
+    size_t opt_len = _option_build(tcb, opt_buf, ctl);
+    offset += opt_len / 4;
+
     /* Set offset and control bit accordingly */
     tcp_hdr.off_ctl = byteorder_htons(_option_build_offset_control(offset, ctl));
 
@@ -185,20 +173,8 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     }
     else {
         /* Add options if existing */
-        if (TCP_HDR_OFFSET_MIN < offset) {
-            uint8_t *opt_ptr = (uint8_t *) tcp_snp->data + sizeof(tcp_hdr);
-            uint8_t opt_left = (offset - TCP_HDR_OFFSET_MIN) * sizeof(network_uint32_t);
-
-            /* Init options field with 'End Of List' - option (0) */
-            memset(opt_ptr, TCP_OPTION_KIND_EOL, opt_left);
-
-            /* If SYN flag is set: Add MSS option */
-            if (ctl & MSK_SYN) {
-                network_uint32_t mss_option = byteorder_htonl(_option_build_mss(GNRC_TCP_MSS));
-                memcpy(opt_ptr, &mss_option, sizeof(mss_option));
-            }
-            /* Increase opt_ptr and decrease opt_left, if other options are added */
-            /* NOTE: Add additional options here */
+        if (opt_len > 0) {
+            memcpy((uint8_t *) tcp_snp->data + sizeof(tcp_hdr), opt_buf, opt_len);
         }
         *(out_pkt) = tcp_snp;
     }
@@ -252,6 +228,30 @@ int _pkt_build(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t **out_pkt, uint16_t *seq_con,
     return 0;
 }
 
+/* Write protects the snips of pkt up to the TCP header, which lower layers may
+ * still hold from an earlier send attempt. Releases pkt on error. */
+static gnrc_pktsnip_t *_write_protect_hdr(gnrc_pktsnip_t *pkt, tcp_hdr_t **hdr)
+{
+    gnrc_pktsnip_t *head, *prev, *snp;
+
+    if ((head = gnrc_pktbuf_start_write(pkt)) == NULL) {
+        gnrc_pktbuf_release(pkt);
+        return NULL;
+    }
+    prev = snp = head;
+    while (snp->type != GNRC_NETTYPE_TCP) {
+        if ((snp = gnrc_pktbuf_start_write(prev->next)) == NULL) {
+            /* the snips from prev->next on are still held for this attempt */
+            gnrc_pktbuf_release(head);
+            return NULL;
+        }
+        prev->next = snp;
+        prev = snp;
+    }
+    *hdr = (tcp_hdr_t *) snp->data;
+    return head;
+}
+
 int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_con,
               const bool retransmit)
 {
@@ -260,14 +260,38 @@ int _pkt_send(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *out_pkt, const uint16_t seq_c
         return -EINVAL;
     }
 
-    /* If this is no retransmission, advance sequence number and measure time */
+    /* If this is no retransmission, advance sequence number */
     if (!retransmit) {
-        tcb->retries = 0;
         tcb->snd_nxt += seq_con;
-        tcb->rtt_start = xtimer_now().ticks32;
+
+        /* Time one segment at a time for the RTT estimation, unless every ACK
+         * carries a timestamp to measure it */
+        if (seq_con > 0 && !(tcb->status & (STATUS_RTT_PENDING | STATUS_TIMESTAMPS))) {
+            tcb->status |= STATUS_RTT_PENDING;
+            tcb->rtt_seq = tcb->snd_nxt;
+            tcb->rtt_start = xtimer_now().ticks32;
+        }
     }
     else {
+        /* Segments in flight during a retransmission are not timed (Karns Algorithm) */
+        tcb->status &= ~STATUS_RTT_PENDING;
         tcb->retries += 1;
+        tcb->retransmits += 1;
+        tcb->rtx_bytes += _pkt_get_pay_len(out_pkt);
+
+        /* The peer drops segments older than the latest timestamp it has seen.
+         * The timestamp is updated in a copy of the header, the frame of an
+         * earlier attempt may still be in flight with the original one. */
+        if (GNRC_TCP_TIMESTAMPS) {
+            tcp_hdr_t *hdr;
+
+            out_pkt = _write_protect_hdr(out_pkt, &hdr);
+            if (out_pkt == NULL) {
+                DEBUG("gnrc_tcp_pkt.c : _pkt_send() : Can't copy header to retransmit\n");
+                return -ENOMEM;
+            }
+            _option_ts_update(tcb, hdr);
+        }
     }
 
     /* Pass packet down the network stack */
@@ -339,6 +363,28 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt)
     return seg_len;
 }
 
+/**
+ * @brief (Re)starts the retransmission timer for the oldest unacknowledged segment.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+static void _start_retransmit_timer(gnrc_tcp_tcb_t *tcb)
+{
+    /* Perform boundry checks on current RTO before usage */
+    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
+    }
+    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
+        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+    }
+
+    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
+    xtimer_remove(&tcb->tim_tout);
+    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
+    tcb->msg_tout.content.ptr = (void *) tcb;
+    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+}
+
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit)
 {
     gnrc_pktsnip_t *snp = NULL;
@@ -351,10 +397,10 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return -EINVAL;
     }
 
-    /* Check if retransmit queue is full and pkt is not already in retransmit queue */
-    if (tcb->pkt_retransmit != NULL && tcb->pkt_retransmit != pkt) {
-        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Nothing to do\n");
-        return -ENOMEM;
+    /* Only the oldest segment in the retransmit queue is retransmitted */
+    if (retransmit && (tcb->rtx_len == 0 || tcb->rtx_queue[tcb->rtx_head] != pkt)) {
+        DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : pkt is not the oldest segment\n");
+        return -EINVAL;
     }
 
     /* Extract control bits and segment length */
@@ -367,93 +413,139 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
         return 0;
     }
 
-    /* Assign pkt and increase users: every send attempt consumes a user */
-    tcb->pkt_retransmit = pkt;
+    if (!retransmit) {
+        /* Check if retransmit queue is full */
+        if (tcb->rtx_len >= RTX_QUEUE_LEN) {
+            DEBUG("gnrc_tcp_pkt.c : _pkt_setup_retransmit() : Retransmit queue is full\n");
+            return -ENOMEM;
+        }
+
+        /* Append pkt to the retransmit queue */
+        tcb->rtx_queue[(tcb->rtx_head + tcb->rtx_len) % RTX_QUEUE_LEN] = pkt;
+        tcb->rtx_len += 1;
+    }
+
+    /* Increase users: every send attempt consumes a user */
     gnrc_pktbuf_hold(pkt, 1);
+    if (retransmit) {
+        tcb->rtx_resent |= (1UL << tcb->rtx_head);
+    }
 
     /* RTO adjustment */
     if (!retransmit) {
-        /* If this is the first transmission: rto is 1 sec (Lower Bound) */
-        if (tcb->srtt == RTO_UNINITIALIZED || tcb->rtt_var == RTO_UNINITIALIZED) {
-            tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-        }
-        else {
-            tcb->rto = tcb->srtt + _max(GNRC_TCP_RTO_GRANULARITY,  GNRC_TCP_RTO_K * tcb->rtt_var);
+        /* The timer is running already if there are older segments in flight */
+        if (tcb->rtx_len > 1) {
+            return 0;
         }
+        _cc_calc_rto(tcb);
     }
     else {
-        /* If this is a retransmission: Double the rto (Timer Backoff) */
-        tcb->rto *= 2;
-
-        /* If the transmission has been tried five times, we assume srtt and rtt_var are bogus */
-        /* New measurements must be taken the next time something is sent. */
-        if (tcb->retries >= 5) {
-            tcb->srtt = RTO_UNINITIALIZED;
-            tcb->rtt_var = RTO_UNINITIALIZED;
-        }
-    }
-
-    /* Perform boundry checks on current RTO before usage */
-    if (tcb->rto < (int32_t) GNRC_TCP_RTO_LOWER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_LOWER_BOUND;
-    }
-    else if (tcb->rto > (int32_t) GNRC_TCP_RTO_UPPER_BOUND) {
-        tcb->rto = GNRC_TCP_RTO_UPPER_BOUND;
+        /* If this is a retransmission: Back off the rto (Timer Backoff) */
+        _cc_backoff(tcb);
     }
-
-    /* Setup retransmission timer, msg to TCP thread with ptr to TCB */
-    tcb->msg_tout.type = MSG_TYPE_RETRANSMISSION;
-    tcb->msg_tout.content.ptr = (void *) tcb;
-    xtimer_set_msg(&tcb->tim_tout, tcb->rto, &tcb->msg_tout, gnrc_tcp_pid);
+    _start_retransmit_timer(tcb);
     return 0;
 }
 
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack)
 {
-    uint32_t seg = 0;
     gnrc_pktsnip_t *snp = NULL;
     tcp_hdr_t *hdr;
+    bool acked = false;
 
     /* Retransmission queue is empty. Nothing to ACK there */
-    if (tcb->pkt_retransmit == NULL) {
+    if (tcb->rtx_len == 0) {
         DEBUG("gnrc_tcp_pkt.c : _pkt_acknowledge() : There is no packet to ack\n");
         return -ENODATA;
     }
 
-    LL_SEARCH_SCALAR(tcb->pkt_retransmit, snp, type, GNRC_NETTYPE_TCP);
-    hdr = (tcp_hdr_t *) snp->data;
+    /* Release all segments that are acknowledged completely, oldest first */
+    while (tcb->rtx_len > 0) {
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[tcb->rtx_head];
 
-    /* There must be a packet, waiting to be acknowledged. */
-    seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(tcb->pkt_retransmit) - 1;
+        LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+        hdr = (tcp_hdr_t *) snp->data;
 
-    /* If segment can be acknowledged -> stop timer, release packet from pktbuf and update rto. */
-    if (LSS_32_BIT(seg, ack)) {
-        xtimer_remove(&(tcb->tim_tout));
-        gnrc_pktbuf_release(tcb->pkt_retransmit);
-        tcb->pkt_retransmit = NULL;
+        uint32_t seg = byteorder_ntohl(hdr->seq_num) + _pkt_get_seg_len(pkt) - 1;
+        if (!LSS_32_BIT(seg, ack)) {
+            break;
+        }
+        gnrc_pktbuf_release(pkt);
+        tcb->rtx_queue[tcb->rtx_head] = NULL;
+        tcb->rtx_sacked &= ~(1UL << tcb->rtx_head);
+        tcb->rtx_resent &= ~(1UL << tcb->rtx_head);
+        tcb->rtx_head = (tcb->rtx_head + 1) % RTX_QUEUE_LEN;
+        tcb->rtx_len -= 1;
+        acked = true;
+    }
 
-        /* Measure round trip time */
+    if (!acked) {
+        return 0;
+    }
+
+    /* New data was acknowledged: stop timer and update rto */
+    xtimer_remove(&(tcb->tim_tout));
+    tcb->retries = 0;
+
+    /* Measure round trip time, if the timed segment was acknowledged */
+    if ((tcb->status & STATUS_RTT_PENDING) && LEQ_32_BIT(tcb->rtt_seq, ack)) {
         int32_t rtt = xtimer_now().ticks32 - tcb->rtt_start;
 
-        /* Use time only if ther was no timer overflow and no retransmission (Karns Alogrithm) */
-        if (tcb->retries == 0 && rtt > 0) {
-            /* If this is the first sample taken */
-            if (tcb->srtt == RTO_UNINITIALIZED && tcb->rtt_var == RTO_UNINITIALIZED) {
-                tcb->srtt = rtt;
-                tcb->rtt_var = (rtt >> 1);
-            }
-            /* If this is a subsequent sample */
-            else {
-                tcb->rtt_var = (tcb->rtt_var / GNRC_TCP_RTO_B_DIV) * (GNRC_TCP_RTO_B_DIV-1);
-                tcb->rtt_var += abs(tcb->srtt - rtt) / GNRC_TCP_RTO_B_DIV;
-                tcb->srtt = (tcb->srtt / GNRC_TCP_RTO_A_DIV) * (GNRC_TCP_RTO_A_DIV-1);
-                tcb->srtt += rtt / GNRC_TCP_RTO_A_DIV;
-            }
+        tcb->status &= ~STATUS_RTT_PENDING;
+
+        /* Use time only if ther was no timer overflow and no timestamps took over */
+        if (rtt > 0 && !(tcb->status & STATUS_TIMESTAMPS)) {
+            _cc_rtt_sample(tcb, rtt);
+        }
+    }
+
+    /* Restart the timer for the segments still in flight */
+    if (tcb->rtx_len > 0) {
+        _cc_calc_rto(tcb);
+        _start_retransmit_timer(tcb);
+
+        /* Without SACK, the peer drops out of order segments: during loss recovery, the
+         * segments following the retransmitted one are most likely lost as well */
+        if ((tcb->status & STATUS_RECOVERY) && LSS_32_BIT(ack, tcb->recover)) {
+            _pkt_retransmit(tcb, false);
         }
     }
     return 0;
 }
 
+int _pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool hole)
+{
+    int highest_sacked = -1;
+
+    /* Only segments below a SACKed one are known to be missing */
+    if (hole) {
+        for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+            if (tcb->rtx_sacked & (1UL << ((tcb->rtx_head + i) % RTX_QUEUE_LEN))) {
+                highest_sacked = i;
+            }
+        }
+    }
+
+    /* Send the oldest segment, that was neither SACKed nor resent during this recovery */
+    for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+        uint8_t idx = (tcb->rtx_head + i) % RTX_QUEUE_LEN;
+
+        if (hole && (int) i >= highest_sacked) {
+            break;
+        }
+        if ((tcb->rtx_sacked | tcb->rtx_resent) & (1UL << idx)) {
+            continue;
+        }
+
+        /* Every send attempt consumes a user */
+        gnrc_pktsnip_t *pkt = tcb->rtx_queue[idx];
+        gnrc_pktbuf_hold(pkt, 1);
+        tcb->rtx_resent |= (1UL << idx);
+        return _pkt_send(tcb, pkt, 0, true);
+    }
+    return -ENODATA;
+}
+
 uint16_t _pkt_calc_csum(const gnrc_pktsnip_t *hdr, const gnrc_pktsnip_t *pseudo_hdr,
                         const gnrc_pktsnip_t *payload)
 {
@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_gnrc
+ * @{
+ *
+ * @file
+ * @brief       Implementation of internal/sack.h
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ * @}
+ */
+#include <stdbool.h>
+#include <string.h>
+#include <utlist.h>
+#include "byteorder.h"
+#include "net/gnrc/pktbuf.h"
+#include "internal/common.h"
+#include "internal/pkt.h"
+#include "internal/sack.h"
+
+#define ENABLE_DEBUG (0)
+#include "debug.h"
+
+/**
+ * @brief Gets the sequence space [left, right) occupied by a segment.
+ */
+static void _seg_range(gnrc_pktsnip_t *pkt, uint32_t *left, uint32_t *right)
+{
+    gnrc_pktsnip_t *snp = NULL;
+
+    LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_TCP);
+    *left = byteorder_ntohl(((tcp_hdr_t *) snp->data)->seq_num);
+    *right = *left + _pkt_get_seg_len(pkt);
+}
+
+void _sack_queue(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt)
+{
+    uint32_t left, right;
+    int free = -1;
+
+    _seg_range(pkt, &left, &right);
+    for (unsigned i = 0; i < GNRC_TCP_OOO_QUEUE_SIZE; i++) {
+        uint32_t l, r;
+
+        if (tcb->ooo_queue[i] == NULL) {
+            free = (free < 0) ? (int) i : free;
+            continue;
+        }
+        /* Retransmission of a segment that is kept already */
+        _seg_range(tcb->ooo_queue[i], &l, &r);
+        if (LEQ_32_BIT(l, left) && LEQ_32_BIT(right, r)) {
+            tcb->ooo_last = i;
+            return;
+        }
+    }
+    if (free < 0) {
+        DEBUG("gnrc_tcp_sack.c : _sack_queue() : Out-of-order queue is full\n");
+        return;
+    }
+    gnrc_pktbuf_hold(pkt, 1);
+    tcb->ooo_queue[free] = pkt;
+    tcb->ooo_last = free;
+    DEBUG("gnrc_tcp_sack.c : _sack_queue() : Keep %"PRIu32" - %"PRIu32"\n", left, right);
+}
+
+void _sack_drain(gnrc_tcp_tcb_t *tcb)
+{
+    bool progress = true;
+
+    while (progress) {
+        progress = false;
+        for (unsigned i = 0; i < GNRC_TCP_OOO_QUEUE_SIZE; i++) {
+            gnrc_pktsnip_t *pkt = tcb->ooo_queue[i];
+            gnrc_pktsnip_t *snp = NULL;
+            uint32_t left, right, skip;
+
+            if (pkt == NULL) {
+                continue;
+            }
+            _seg_range(pkt, &left, &right);
+            if (LSS_32_BIT(tcb->rcv_nxt, left)) {
+                continue;
+            }
+            /* Copy the part of the segment that was not received yet */
+            skip = LSS_32_BIT(tcb->rcv_nxt, right) ? tcb->rcv_nxt - left : right - left;
+            LL_SEARCH_SCALAR(pkt, snp, type, GNRC_NETTYPE_UNDEF);
+            while (snp && snp->type == GNRC_NETTYPE_UNDEF) {
+                if (skip >= snp->size) {
+                    skip -= snp->size;
+                }
+                else {
+                    tcb->rcv_nxt += ringbuffer_add(&(tcb->rcv_buf), (char *) snp->data + skip,
+                                                   snp->size - skip);
+                    skip = 0;
+                }
+                snp = snp->next;
+            }
+            gnrc_pktbuf_release(pkt);
+            tcb->ooo_queue[i] = NULL;
+            progress = true;
+        }
+    }
+}
+
+void _sack_clear(gnrc_tcp_tcb_t *tcb)
+{
+    for (unsigned i = 0; i < GNRC_TCP_OOO_QUEUE_SIZE; i++) {
+        if (tcb->ooo_queue[i] != NULL) {
+            gnrc_pktbuf_release(tcb->ooo_queue[i]);
+            tcb->ooo_queue[i] = NULL;
+        }
+    }
+}
+
+unsigned _sack_blocks(gnrc_tcp_tcb_t *tcb, uint32_t (*blocks)[2], unsigned max)
+{
+    uint32_t ranges[GNRC_TCP_OOO_QUEUE_SIZE][2];
+    uint32_t last = 0;
+    bool has_last = false;
+    unsigned num = 0;
+    unsigned first = 0;
+
+    for (unsigned i = 0; i < GNRC_TCP_OOO_QUEUE_SIZE; i++) {
+        if (tcb->ooo_queue[i] != NULL) {
+            _seg_range(tcb->ooo_queue[i], &ranges[num][0], &ranges[num][1]);
+            if (i == tcb->ooo_last) {
+                last = ranges[num][0];
+                has_last = true;
+            }
+            num++;
+        }
+    }
+
+    /* Merge overlapping and adjacent segments into blocks */
+    for (unsigned i = 0; i < num; i++) {
+        for (unsigned j = i + 1; j < num; j++) {
+            if (LEQ_32_BIT(ranges[j][0], ranges[i][1]) && LEQ_32_BIT(ranges[i][0], ranges[j][1])) {
+                if (LSS_32_BIT(ranges[j][0], ranges[i][0])) {
+                    ranges[i][0] = ranges[j][0];
+                }
+                if (GRT_32_BIT(ranges[j][1], ranges[i][1])) {
+                    ranges[i][1] = ranges[j][1];
+                }
+                num--;
+                if (j != num) {
+                    memcpy(ranges[j], ranges[num], sizeof(ranges[j]));
+                }
+                /* The grown block may reach blocks checked already */
+                j = i;
+            }
+        }
+    }
+
+    if (num == 0) {
+        return 0;
+    }
+
+    /* Report the block holding the latest segment first */
+    for (unsigned i = 0; has_last && i < num; i++) {
+        if (LEQ_32_BIT(ranges[i][0], last) && LSS_32_BIT(last, ranges[i][1])) {
+            first = i;
+            break;
+        }
+    }
+    memcpy(blocks[0], ranges[first], sizeof(blocks[0]));
+    for (unsigned i = 0, n = 1; i < num && n < max; i++) {
+        if (i != first) {
+            memcpy(blocks[n++], ranges[i], sizeof(blocks[0]));
+        }
+    }
+    return (num < max) ? num : max;
+}
+
+void _sack_mark(gnrc_tcp_tcb_t *tcb, const option_t *opt)
+{
+    for (uint8_t i = 0; i < tcb->rtx_len; i++) {
+        uint8_t idx = (tcb->rtx_head + i) % RTX_QUEUE_LEN;
+        uint32_t left, right;
+
+        _seg_range(tcb->rtx_queue[idx], &left, &right);
+        for (uint8_t j = 0; j < opt->sack_num; j++) {
+            if (LEQ_32_BIT(opt->sack[j][0], left) && LEQ_32_BIT(right, opt->sack[j][1])) {
+                tcb->rtx_sacked |= (1UL << idx);
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       RIOT's TCP implementation for the GNRC network stack.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Congestion control and RTT estimation declarations.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef CC_H
+#define CC_H
+
+#include <stdint.h>
+#include "net/gnrc/tcp/tcb.h"
+#include "net/gnrc/tcp/cc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Initializes the congestion state of an established connection.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_init(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Processes an ACK for new data.
+ *
+ * @param[in,out] tcb     TCB holding the connection information.
+ * @param[in]     acked   Number of newly acknowledged bytes.
+ */
+void _cc_ack(gnrc_tcp_tcb_t *tcb, uint32_t acked);
+
+/**
+ * @brief Processes a duplicate ACK, fast retransmits on the third one.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_dup_ack(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Processes a retransmission timeout.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_timeout(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Updates the RTT estimation with a new sample.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     rtt   Measured round trip time.
+ */
+void _cc_rtt_sample(gnrc_tcp_tcb_t *tcb, int32_t rtt);
+
+/**
+ * @brief Calculates the RTO from the current RTT estimation.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_calc_rto(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Backs off the RTO for a retransmission.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _cc_backoff(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Returns the window that may be in flight.
+ *
+ * @param[in] tcb   TCB holding the connection information.
+ *
+ * @returns   Minimum of send window and congestion window.
+ */
+static inline uint32_t _cc_wnd(const gnrc_tcp_tcb_t *tcb)
+{
+    return (tcb->snd_wnd < tcb->cwnd) ? tcb->snd_wnd : tcb->cwnd;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CC_H */
+/** @} */
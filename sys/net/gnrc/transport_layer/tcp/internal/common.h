@@ -49,8 +49,24 @@ extern "C" {
 #define STATUS_ALLOW_ANY_ADDR (1 << 1)
 #define STATUS_NOTIFY_USER    (1 << 2)
 #define STATUS_WAIT_FOR_MSG   (1 << 3)
+#define STATUS_RTT_PENDING    (1 << 4)
+#define STATUS_USER_RCV_BUF   (1 << 5)
+#define STATUS_RECOVERY       (1 << 6)
+#define STATUS_FAST_RECOVERY  (1 << 7)
+#define STATUS_SACK           (1 << 8)
+#define STATUS_TIMESTAMPS     (1 << 9)
 /** @} */
 
+/**
+ * @brief Number of slots in the retransmit queue of a TCB, one more than
+ *        GNRC_TCP_RTX_QUEUE_SIZE to always have room for a FIN.
+ */
+#define RTX_QUEUE_LEN (GNRC_TCP_RTX_QUEUE_SIZE + 1U)
+
+#if RTX_QUEUE_LEN > 32
+#error "GNRC_TCP_RTX_QUEUE_SIZE exceeds the rtx_queue bitmaps of a TCB"
+#endif
+
 /**
  * @brief Defines for "eventloop" thread settings.
  * @{
@@ -22,8 +22,10 @@
 #ifndef OPTION_H
 #define OPTION_H
 
+#include <stddef.h>
 #include <stdint.h>
 #include "assert.h"
+#include "xtimer.h"
 #include "net/tcp.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -31,6 +33,45 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Maximum number of SACK blocks in a segment.
+ */
+#define OPTION_SACK_BLOCKS_MAX (4U)
+
+/**
+ * @brief Maximum size of the option field.
+ */
+#define OPTION_SIZE_MAX ((TCP_HDR_OFFSET_MAX - TCP_HDR_OFFSET_MIN) * 4U)
+
+/**
+ * @brief Flags of options found in a segment.
+ * @{
+ */
+#define OPTION_TIMESTAMP (1 << 0)
+#define OPTION_SACK      (1 << 1)
+/** @} */
+
+/**
+ * @brief Per segment options, that are not stored in the TCB.
+ */
+typedef struct {
+    uint8_t flags;                                /**< Options found */
+    uint8_t sack_num;                             /**< Number of SACK blocks */
+    uint32_t ts_val;                              /**< Timestamp value */
+    uint32_t ts_ecr;                              /**< Timestamp echo reply */
+    uint32_t sack[OPTION_SACK_BLOCKS_MAX][2];     /**< Left and right edges of SACK blocks */
+} option_t;
+
+/**
+ * @brief Returns the clock of the timestamps option.
+ *
+ * @returns   Current time in milliseconds.
+ */
+static inline uint32_t _option_ts_now(void)
+{
+    return (uint32_t) (xtimer_now_usec64() / US_PER_MS);
+}
+
 /**
  * @brief Helper function to build the MSS option.
  *
@@ -61,13 +102,36 @@ static inline uint16_t _option_build_offset_control(uint16_t nopts, uint16_t ctl
 /**
  * @brief Parses options of a given TCP header.
  *
+ * The MSS is stored in @p tcb. On a SYN, SACK and timestamps are enabled in
+ * @p tcb if the peer offers them and they are enabled in the configuration.
+ *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     hdr   TCP header to be parsed.
+ * @param[out]    opt   Timestamps and SACK blocks found in @p hdr.
  *
  * @returns   Zero on success.
  *            Negative value on error.
  */
-int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
+int _option_parse(gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr, option_t *opt);
+
+/**
+ * @brief Builds the options of a segment to send.
+ *
+ * @param[in]  tcb   TCB holding the connection information.
+ * @param[out] buf   Buffer of OPTION_SIZE_MAX bytes for the options.
+ * @param[in]  ctl   Control bits of the segment.
+ *
+ * @returns   Size of the options, a multiple of 4 bytes.
+ */
+size_t _option_build(gnrc_tcp_tcb_t *tcb, uint8_t *buf, uint16_t ctl);
+
+/**
+ * @brief Updates the timestamps option of a segment that is sent again.
+ *
+ * @param[in]     tcb   TCB holding the connection information.
+ * @param[in,out] hdr   TCP header of the segment.
+ */
+void _option_ts_update(const gnrc_tcp_tcb_t *tcb, tcp_hdr_t *hdr);
 
 #ifdef __cplusplus
 }
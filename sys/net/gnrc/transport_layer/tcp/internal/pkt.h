@@ -110,18 +110,26 @@ uint32_t _pkt_get_pay_len(gnrc_pktsnip_t *pkt);
 /**
  * @brief Adds a packet to the retransmission mechanism.
  *
+ * A new segment is appended to the retransmit queue. The retransmission timer
+ * runs for the oldest segment in the queue only, which is the only segment
+ * that is retransmitted.
+ *
  * @param[in,out] tcb          TCB holding the connection information.
  * @param[in]     pkt          Packet to add to the retransmission mechanism.
  * @param[in]     retransmit   Flag used to indicate that @p pkt is a retransmit.
  *
  * @returns   Zero on success.
  *            -ENOMEM if the retransmission queue is full.
- *            -EINVAL if pkt is null.
+ *            -EINVAL if pkt is null or a retransmit of a segment other
+ *            than the oldest one.
  */
 int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool retransmit);
 
 /**
- * @brief Acknowledges and removes packet from the retransmission mechanism.
+ * @brief Acknowledges and removes packets from the retransmission mechanism.
+ *
+ * Releases all segments covered by @p ack, updates the RTT estimation and
+ * restarts the retransmission timer if segments remain in flight.
  *
  * @param[in,out] tcb   TCB holding the connection information.
  * @param[in]     ack   Acknowldegment number used to acknowledge packets.
@@ -131,6 +139,20 @@ int _pkt_setup_retransmit(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt, const bool r
  */
 int _pkt_acknowledge(gnrc_tcp_tcb_t *tcb, const uint32_t ack);
 
+/**
+ * @brief Retransmits the oldest segment in the retransmit queue right away, that was
+ *        neither SACKed nor retransmitted during the current loss recovery.
+ *
+ * The retransmission timer and the RTO are left untouched.
+ *
+ * @param[in,out] tcb    TCB holding the connection information.
+ * @param[in]     hole   Consider only segments below the highest SACKed segment.
+ *
+ * @returns   Zero on success.
+ *            -ENODATA if there is no segment to retransmit.
+ */
+int _pkt_retransmit(gnrc_tcp_tcb_t *tcb, const bool hole);
+
 /**
  * @brief Calculates checksum over payload, TCP header and network layer header.
  *
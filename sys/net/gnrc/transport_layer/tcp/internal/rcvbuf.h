@@ -23,7 +23,7 @@
 #define RCVBUF_H
 
 #include <stdint.h>
-#include "mutex.h"
+#include "objpool.h"
 #include "net/gnrc/tcp/config.h"
 #include "net/gnrc/tcp/tcb.h"
 
@@ -32,19 +32,11 @@ extern "C" {
 #endif
 
 /**
- * @brief Receive buffer entry.
- */
-typedef struct rcvbuf_entry {
-    uint8_t used;                          /**< Flag: Is buffer in use? */
-    uint8_t buffer[GNRC_TCP_RCV_BUF_SIZE]; /**< Receive buffer storage */
-} rcvbuf_entry_t;
-
-/**
- * @brief   Stuct holding receive buffers.
+ * @brief   Stuct holding the pool of receive buffers.
  */
 typedef struct rcvbuf {
-    mutex_t lock;                                 /**< Lock for allocation synchronization */
-    rcvbuf_entry_t entries[GNRC_TCP_RCV_BUFFERS]; /**< Maintained receive buffers */
+    objpool_t pool;                                                 /**< Pool of buffers */
+    uint8_t buffers[GNRC_TCP_RCV_BUFFERS][GNRC_TCP_RCV_BUF_SIZE];   /**< Buffer storage */
 } rcvbuf_t;
 
 /**
@@ -55,6 +47,9 @@ void _rcvbuf_init(void);
 /**
  * @brief Allocate receive buffer and assign it to TCB.
  *
+ * A receive buffer supplied by the user via gnrc_tcp_tcb_set_rcvbuf() is used
+ * instead of a buffer from the pool.
+ *
  * @param[in,out] tcb   TCB that aquires receive buffer.
  *
  * @returns   Zero  on success.
@@ -65,6 +60,8 @@ int _rcvbuf_get_buffer(gnrc_tcp_tcb_t *tcb);
 /**
  * @brief Release allocated receive buffer.
  *
+ * A receive buffer supplied by the user stays assigned to the TCB.
+ *
  * @param[in,out] tcb   TCB holding the receive buffer that should be released.
  */
 void _rcvbuf_release_buffer(gnrc_tcp_tcb_t *tcb);
@@ -0,0 +1,83 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @defgroup    net_gnrc_tcp TCP
+ * @ingroup     net_gnrc
+ * @brief       RIOT's TCP implementation for the GNRC network stack.
+ *
+ * @{
+ *
+ * @file
+ * @brief       Selective acknowledgment (RFC 2018) declarations.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#ifndef SACK_H
+#define SACK_H
+
+#include <stdint.h>
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/tcp/tcb.h"
+#include "option.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Keeps a segment, that follows a gap in the received data.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     pkt   Received segment, held until it is used or discarded.
+ */
+void _sack_queue(gnrc_tcp_tcb_t *tcb, gnrc_pktsnip_t *pkt);
+
+/**
+ * @brief Copies kept segments, that continue the received data, into the
+ *        receive buffer.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _sack_drain(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Discards all kept segments.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ */
+void _sack_clear(gnrc_tcp_tcb_t *tcb);
+
+/**
+ * @brief Builds the SACK blocks for the kept segments.
+ *
+ * The block holding the latest segment comes first (RFC 2018, section 4).
+ *
+ * @param[in]  tcb      TCB holding the connection information.
+ * @param[out] blocks   Left and right edges of the blocks.
+ * @param[in]  max      Maximum number of blocks.
+ *
+ * @returns   Number of blocks.
+ */
+unsigned _sack_blocks(gnrc_tcp_tcb_t *tcb, uint32_t (*blocks)[2], unsigned max);
+
+/**
+ * @brief Marks the segments in the retransmit queue that the peer SACKed.
+ *
+ * @param[in,out] tcb   TCB holding the connection information.
+ * @param[in]     opt   Options of the received segment.
+ */
+void _sack_mark(gnrc_tcp_tcb_t *tcb, const option_t *opt);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SACK_H */
+/** @} */
@@ -243,6 +243,16 @@ static void *_event_loop(void *arg)
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV\n");
                 _receive(msg.content.ptr);
                 break;
+            case GNRC_NETAPI_MSG_TYPE_RCV_BATCH: {
+                gnrc_pktsnip_t *batch = msg.content.ptr;
+
+                DEBUG("udp: GNRC_NETAPI_MSG_TYPE_RCV_BATCH\n");
+                for (unsigned i = 0; i < gnrc_netapi_batch_numof(batch); i++) {
+                    _receive(gnrc_netapi_batch_get(batch, i));
+                }
+                gnrc_pktbuf_release(batch);
+                break;
+            }
             case GNRC_NETAPI_MSG_TYPE_SND:
                 DEBUG("udp: GNRC_NETAPI_MSG_TYPE_SND\n");
                 _send(msg.content.ptr);
@@ -55,6 +55,45 @@ static char addr_str[IPV6_ADDR_MAX_STR_LEN];
 #define FIB_ADDR_PRINT_LENS2(X)     FIB_ADDR_PRINT_LENS1(X)
 #define FIB_ADDR_PRINT_LENS         FIB_ADDR_PRINT_LENS2(FIB_ADDR_PRINT_LEN)
 
+#ifdef MODULE_FIB_TRIE
+#ifdef MODULE_GNRC_IPV6
+#include "net/gnrc/ipv6.h"
+#endif
+
+/**
+ * @brief Maximum number of prefix trie nodes shared by all FIB tables
+ */
+#ifndef FIB_TRIE_NODES_NUMOF
+/* a trie with N prefixes has at most N - 1 nodes without entries, so all
+ * potential users of the FIB have to add twice their table size here */
+#   if defined(MODULE_GNRC_IPV6)
+#       define FIB_TRIE_NODES_NUMOF     (2 * GNRC_IPV6_FIB_TABLE_SIZE)
+#   else
+#       error "FIB_TRIE_NODES_NUMOF must be twice the size of all FIB tables"
+#   endif
+#endif
+
+/**
+ * @brief Node of the path-compressed prefix trie over the entries of a table
+ */
+typedef struct fib_trie_node {
+    struct fib_trie_node *child[2];         /**< sub-tries, selected by the bit
+                                             *   following the node's prefix */
+    fib_entry_t *entries;                   /**< entries with exactly this
+                                             *   prefix, in table order */
+    uint8_t pfx[UNIVERSAL_ADDRESS_SIZE];    /**< prefix of the node */
+    uint16_t pfx_len;                       /**< length of the prefix in bits */
+} fib_trie_node_t;
+
+static fib_trie_node_t fib_trie_nodes[FIB_TRIE_NODES_NUMOF];
+/* free nodes are linked by child[0], nodes beyond fib_trie_unused were never
+ * handed out */
+static fib_trie_node_t *fib_trie_free = NULL;
+static size_t fib_trie_unused = 0;
+static size_t fib_trie_available = FIB_TRIE_NODES_NUMOF;
+static mutex_t fib_trie_mtx = MUTEX_INIT;
+#endif
+
 /**
  * @brief convert an offset given in ms to abolute time in time in us
  * @param[in]  ms       the milliseconds to be converted
@@ -65,6 +104,249 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
     *target = xtimer_now_usec64() + (ms * US_PER_MS);
 }
 
+#ifdef MODULE_FIB_TRIE
+static int fib_remove(fib_table_t *table, fib_entry_t *entry);
+
+/**
+ * @brief checks if the lifetime of a used entry expired
+ */
+static inline bool fib_entry_expired(const fib_entry_t *entry, uint64_t now)
+{
+    return (entry->lifetime != 0) &&
+           (entry->lifetime != FIB_LIFETIME_NO_EXPIRE) &&
+           (entry->lifetime < now);
+}
+
+static inline unsigned fib_trie_bit(const uint8_t *addr, unsigned pos)
+{
+    return (addr[pos >> 3] >> (7 - (pos & 0x7))) & 0x1;
+}
+
+/**
+ * @brief checks if the prefix of the given node covers an address
+ */
+static bool fib_trie_covers(const fib_trie_node_t *node, const uint8_t *addr)
+{
+    unsigned bytes = node->pfx_len >> 3;
+    unsigned bits = node->pfx_len & 0x7;
+
+    if (memcmp(node->pfx, addr, bytes) != 0) {
+        return false;
+    }
+    return (bits == 0) ||
+           (((node->pfx[bytes] ^ addr[bytes]) & (0xff << (8 - bits))) == 0);
+}
+
+/**
+ * @brief returns the number of leading bits an address shares with the prefix
+ *        of the given node, but at most max_len
+ */
+static unsigned fib_trie_common(const fib_trie_node_t *node,
+                                const uint8_t *addr, unsigned max_len)
+{
+    unsigned len = 0;
+
+    if (max_len > node->pfx_len) {
+        max_len = node->pfx_len;
+    }
+    while (((len + 8) <= max_len) && (node->pfx[len >> 3] == addr[len >> 3])) {
+        len += 8;
+    }
+    while ((len < max_len) &&
+           (fib_trie_bit(node->pfx, len) == fib_trie_bit(addr, len))) {
+        len++;
+    }
+    return len;
+}
+
+/**
+ * @brief returns the prefix length an entry is indexed with
+ *
+ * The all zero address is the default route and matches everything, entries
+ * without a prefix length in their flags only match their exact address.
+ */
+static unsigned fib_trie_pfx_len(const fib_entry_t *entry)
+{
+    const universal_address_container_t *global = entry->global;
+    unsigned addr_len = global->address_size << 3;
+    unsigned pfx_len = (entry->global_flags & FIB_FLAG_NET_PREFIX_MASK)
+                       >> FIB_FLAG_NET_PREFIX_SHIFT;
+    size_t i;
+
+    for (i = 0; (i < global->address_size) && (global->address[i] == 0); i++) {}
+    if (i == global->address_size) {
+        return 0;
+    }
+    if ((pfx_len == 0) || (pfx_len > addr_len)) {
+        pfx_len = addr_len;
+    }
+    return pfx_len;
+}
+
+/* must be called with fib_trie_mtx locked */
+static fib_trie_node_t *fib_trie_node_alloc(const uint8_t *pfx,
+                                            unsigned pfx_len)
+{
+    fib_trie_node_t *node;
+
+    if (fib_trie_free != NULL) {
+        node = fib_trie_free;
+        fib_trie_free = node->child[0];
+    }
+    else {
+        node = &fib_trie_nodes[fib_trie_unused++];
+    }
+    fib_trie_available--;
+    memset(node, 0, sizeof(fib_trie_node_t));
+    memcpy(node->pfx, pfx, (pfx_len + 7) >> 3);
+    if (pfx_len & 0x7) {
+        node->pfx[pfx_len >> 3] &= 0xff << (8 - (pfx_len & 0x7));
+    }
+    node->pfx_len = pfx_len;
+    return node;
+}
+
+/* must be called with fib_trie_mtx locked */
+static void fib_trie_node_free(fib_trie_node_t *node)
+{
+    node->child[0] = fib_trie_free;
+    fib_trie_free = node;
+    fib_trie_available++;
+}
+
+/**
+ * @brief adds an entry to the prefix trie of the table
+ *
+ * @return 0 on success
+ *         -ENOMEM if no trie nodes are left
+ */
+static int fib_trie_add(fib_table_t *table, fib_entry_t *entry)
+{
+    const uint8_t *pfx = entry->global->address;
+    unsigned pfx_len = fib_trie_pfx_len(entry);
+    fib_trie_node_t **link = &table->trie;
+    fib_trie_node_t *node;
+    fib_entry_t **ptr;
+
+    mutex_lock(&fib_trie_mtx);
+    /* an insertion takes at most two nodes */
+    if (fib_trie_available < 2) {
+        mutex_unlock(&fib_trie_mtx);
+        return -ENOMEM;
+    }
+    while ((node = *link) != NULL) {
+        unsigned common = fib_trie_common(node, pfx, pfx_len);
+
+        if (common < node->pfx_len) {
+            /* prefixes diverge within node's prefix: put a new node with the
+             * common prefix in front of it */
+            fib_trie_node_t *split = fib_trie_node_alloc(pfx, common);
+
+            split->child[fib_trie_bit(node->pfx, common)] = node;
+            *link = split;
+            if (common == pfx_len) {
+                node = split;
+            }
+            else {
+                link = &split->child[fib_trie_bit(pfx, common)];
+                node = NULL;
+            }
+            break;
+        }
+        if (node->pfx_len == pfx_len) {
+            break;
+        }
+        link = &node->child[fib_trie_bit(pfx, node->pfx_len)];
+    }
+    if (node == NULL) {
+        node = fib_trie_node_alloc(pfx, pfx_len);
+        *link = node;
+    }
+    mutex_unlock(&fib_trie_mtx);
+    /* keep entries in table order so look-ups find the same entry as a linear
+     * search through the table would */
+    for (ptr = &node->entries; (*ptr != NULL) && (*ptr < entry);
+         ptr = &(*ptr)->trie_next) {}
+    entry->trie_next = *ptr;
+    *ptr = entry;
+    return 0;
+}
+
+/**
+ * @brief removes an entry from the prefix trie of the table
+ */
+static void fib_trie_remove(fib_table_t *table, fib_entry_t *entry)
+{
+    const uint8_t *pfx = entry->global->address;
+    unsigned pfx_len = fib_trie_pfx_len(entry);
+    fib_trie_node_t **link = &table->trie, **parent_link = NULL;
+    fib_trie_node_t *node;
+    fib_entry_t **ptr;
+
+    while (((node = *link) != NULL) && (node->pfx_len < pfx_len)) {
+        parent_link = link;
+        link = &node->child[fib_trie_bit(pfx, node->pfx_len)];
+    }
+    if ((node == NULL) || (node->pfx_len != pfx_len)) {
+        return;
+    }
+    for (ptr = &node->entries; (*ptr != NULL) && (*ptr != entry);
+         ptr = &(*ptr)->trie_next) {}
+    if (*ptr == NULL) {
+        return;
+    }
+    *ptr = entry->trie_next;
+    entry->trie_next = NULL;
+    if ((node->entries != NULL) ||
+        ((node->child[0] != NULL) && (node->child[1] != NULL))) {
+        /* node is still required */
+        return;
+    }
+    mutex_lock(&fib_trie_mtx);
+    *link = (node->child[0] != NULL) ? node->child[0] : node->child[1];
+    fib_trie_node_free(node);
+    if ((*link == NULL) && (parent_link != NULL)) {
+        fib_trie_node_t *parent = *parent_link;
+
+        /* a parent without entries was only there to branch */
+        if (parent->entries == NULL) {
+            *parent_link = (parent->child[0] != NULL) ? parent->child[0]
+                                                      : parent->child[1];
+            fib_trie_node_free(parent);
+        }
+    }
+    mutex_unlock(&fib_trie_mtx);
+}
+
+/**
+ * @brief releases all nodes of the prefix trie of the table
+ */
+static void fib_trie_clear(fib_table_t *table)
+{
+    fib_trie_node_t *node = table->trie;
+
+    mutex_lock(&fib_trie_mtx);
+    /* rotate left children up, so the trie can be released without a stack */
+    while (node != NULL) {
+        if (node->child[0] != NULL) {
+            fib_trie_node_t *left = node->child[0];
+
+            node->child[0] = left->child[1];
+            left->child[1] = node;
+            node = left;
+        }
+        else {
+            fib_trie_node_t *next = node->child[1];
+
+            fib_trie_node_free(node);
+            node = next;
+        }
+    }
+    mutex_unlock(&fib_trie_mtx);
+    table->trie = NULL;
+}
+#endif
+
 /**
  * @brief returns pointer to the entry for the given destination address
  *
@@ -79,6 +361,86 @@ static void fib_lifetime_to_absolute(uint32_t ms, uint64_t *target)
  *         1 if we found the exact address next-hop
  *         -EHOSTUNREACH if no fitting next-hop is available
  */
+#ifdef MODULE_FIB_TRIE
+static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
+                          fib_entry_t **entry_arr, size_t *entry_arr_size) {
+    uint64_t now = xtimer_now_usec64();
+    size_t dst_len = dst_size << 3;
+    fib_entry_t *expired;
+    fib_entry_t *match;
+
+#if ENABLE_DEBUG
+    DEBUG("[fib_find_entry] dst =");
+    for (size_t i = 0; i < dst_size; i++) {
+        DEBUG(" %02x", dst[i]);
+    }
+    DEBUG("\n");
+#endif
+
+    do {
+        fib_trie_node_t *node = table->trie;
+
+        expired = NULL;
+        match = NULL;
+        /* walk down the trie, remembering the longest matching prefix */
+        while ((node != NULL) && (node->pfx_len <= dst_len) &&
+               fib_trie_covers(node, dst)) {
+            fib_entry_t *node_match = NULL;
+
+            for (fib_entry_t *entry = node->entries; entry != NULL;
+                 entry = entry->trie_next) {
+                if (fib_entry_expired(entry, now)) {
+                    expired = entry;
+                    break;
+                }
+                if (entry->global->address_size != dst_size) {
+                    continue;
+                }
+                if (memcmp(entry->global->address, dst, dst_size) == 0) {
+                    /* we will not find a better one so we return */
+                    entry_arr[0] = entry;
+                    *entry_arr_size = 1;
+                    return 1;
+                }
+                if (node_match == NULL) {
+                    node_match = entry;
+                }
+            }
+            if (expired != NULL) {
+                break;
+            }
+            if (node_match != NULL) {
+                match = node_match;
+            }
+            if (node->pfx_len == dst_len) {
+                break;
+            }
+            node = node->child[fib_trie_bit(dst, node->pfx_len)];
+        }
+        if (expired != NULL) {
+            /* remove this entry since its lifetime expired and try again */
+            fib_remove(table, expired);
+        }
+    } while (expired != NULL);
+
+    if (match == NULL) {
+        *entry_arr_size = 0;
+        return -EHOSTUNREACH;
+    }
+
+#if ENABLE_DEBUG
+    DEBUG("[fib_find_entry] found prefix on interface %d:", match->iface_id);
+    for (size_t i = 0; i < match->global->address_size; i++) {
+        DEBUG(" %02x", match->global->address[i]);
+    }
+    DEBUG("\n");
+#endif
+
+    entry_arr[0] = match;
+    *entry_arr_size = 1;
+    return 0;
+}
+#else
 static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
                           fib_entry_t **entry_arr, size_t *entry_arr_size) {
     uint64_t now = xtimer_now_usec64();
@@ -188,6 +550,7 @@ static int fib_find_entry(fib_table_t *table, uint8_t *dst, size_t dst_size,
     *entry_arr_size = count;
     return ret;
 }
+#endif
 
 /**
  * @brief updates the next hop the lifetime and the interface id for a given entry
@@ -246,7 +609,17 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                             uint8_t *next_hop, size_t next_hop_size, uint32_t
                             next_hop_flags, uint32_t lifetime)
 {
+#ifdef MODULE_FIB_TRIE
+    uint64_t now = xtimer_now_usec64();
+#endif
+
     for (size_t i = 0; i < table->size; ++i) {
+#ifdef MODULE_FIB_TRIE
+        /* look-ups only expire the entries on their path through the trie */
+        if (fib_entry_expired(&table->data.entries[i], now)) {
+            fib_remove(table, &table->data.entries[i]);
+        }
+#endif
         if (table->data.entries[i].lifetime == 0) {
 
             table->data.entries[i].global = universal_address_add(dst, dst_size);
@@ -268,6 +641,12 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
                     table->data.entries[i].lifetime = FIB_LIFETIME_NO_EXPIRE;
                 }
 
+#ifdef MODULE_FIB_TRIE
+                if (fib_trie_add(table, &table->data.entries[i]) < 0) {
+                    fib_remove(table, &table->data.entries[i]);
+                    return -ENOMEM;
+                }
+#endif
                 return 0;
             }
         }
@@ -279,13 +658,19 @@ static int fib_create_entry(fib_table_t *table, kernel_pid_t iface_id,
 /**
  * @brief removes the given entry
  *
+ * @param[in] table the FIB table the entry belongs to
  * @param[in] entry the entry to be removed
  *
  * @return 0 on success
  */
-static int fib_remove(fib_entry_t *entry)
+static int fib_remove(fib_table_t *table, fib_entry_t *entry)
 {
+    (void)table;
+
     if (entry->global != NULL) {
+#ifdef MODULE_FIB_TRIE
+        fib_trie_remove(table, entry);
+#endif
         universal_address_rem(entry->global);
     }
 
@@ -457,7 +842,7 @@ void fib_remove_entry(fib_table_t *table, uint8_t *dst, size_t dst_size)
 
     if (ret == 1) {
         /* we must take the according entry and update the values */
-        fib_remove(entry[0]);
+        fib_remove(table, entry[0]);
     }
     else {
         /* we have ambiguous entries, i.e. count > 1
@@ -477,7 +862,7 @@ void fib_flush(fib_table_t *table, kernel_pid_t interface)
     for (size_t i = 0; i < table->size; ++i) {
         if ((interface == KERNEL_PID_UNDEF) ||
             (interface == table->data.entries[i].iface_id)) {
-            fib_remove(&table->data.entries[i]);
+            fib_remove(table, &table->data.entries[i]);
         }
     }
 
@@ -596,6 +981,9 @@ void fib_init(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        fib_trie_clear(table);
+#endif
     }
     universal_address_init();
     mutex_unlock(&(table->mtx_access));
@@ -621,6 +1009,9 @@ void fib_deinit(fib_table_t *table)
     }
     else {
         memset(table->data.entries, 0, (table->size * sizeof(fib_entry_t)));
+#ifdef MODULE_FIB_TRIE
+        fib_trie_clear(table);
+#endif
     }
     universal_address_reset();
     mutex_unlock(&(table->mtx_access));
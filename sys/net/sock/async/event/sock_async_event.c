@@ -0,0 +1,112 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     net_sock_async_event
+ * @{
+ *
+ * @file
+ * @brief       Asynchronous sock using @ref sys_event implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ * @}
+ */
+
+#include <assert.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "net/sock/ip.h"
+#include "net/sock/udp.h"
+#include "net/sock/async/event.h"
+
+static sock_async_flags_t _take_flags(sock_event_t *event)
+{
+    unsigned state = irq_disable();
+    sock_async_flags_t flags = event->flags;
+
+    event->flags = 0;
+    irq_restore(state);
+    return flags;
+}
+
+static void _post(sock_async_ctx_t *ctx, sock_async_flags_t flags)
+{
+    unsigned state = irq_disable();
+
+    ctx->event.flags |= flags;
+    irq_restore(state);
+    event_post(ctx->queue, &ctx->event.super);
+}
+
+static void _init_ctx(sock_async_ctx_t *ctx, void *sock, event_queue_t *queue,
+                      event_handler_t handler)
+{
+    assert(queue != NULL);
+    ctx->event.super.list_node.next = NULL;
+    ctx->event.super.handler = handler;
+    ctx->event.sock = sock;
+    ctx->event.flags = 0;
+    ctx->queue = queue;
+}
+
+#ifdef MODULE_SOCK_IP
+static void _ip_event_handler(event_t *ev)
+{
+    sock_event_t *event = container_of(ev, sock_event_t, super);
+    sock_async_flags_t flags = _take_flags(event);
+
+    if (flags) {
+        event->cb.ip(event->sock, flags);
+    }
+}
+
+static void _ip_cb(sock_ip_t *sock, sock_async_flags_t flags)
+{
+    _post(sock_ip_get_async_ctx(sock), flags);
+}
+
+void sock_ip_event_init(sock_ip_t *sock, event_queue_t *queue,
+                        sock_ip_cb_t handler)
+{
+    sock_async_ctx_t *ctx = sock_ip_get_async_ctx(sock);
+
+    assert(handler != NULL);
+    _init_ctx(ctx, sock, queue, _ip_event_handler);
+    ctx->event.cb.ip = handler;
+    sock_ip_set_cb(sock, _ip_cb);
+}
+#endif
+
+#ifdef MODULE_SOCK_UDP
+static void _udp_event_handler(event_t *ev)
+{
+    sock_event_t *event = container_of(ev, sock_event_t, super);
+    sock_async_flags_t flags = _take_flags(event);
+
+    if (flags) {
+        event->cb.udp(event->sock, flags);
+    }
+}
+
+static void _udp_cb(sock_udp_t *sock, sock_async_flags_t flags)
+{
+    _post(sock_udp_get_async_ctx(sock), flags);
+}
+
+void sock_udp_event_init(sock_udp_t *sock, event_queue_t *queue,
+                         sock_udp_cb_t handler)
+{
+    sock_async_ctx_t *ctx = sock_udp_get_async_ctx(sock);
+
+    assert(handler != NULL);
+    _init_ctx(ctx, sock, queue, _udp_event_handler);
+    ctx->event.cb.udp = handler;
+    sock_udp_set_cb(sock, _udp_cb);
+}
+#endif
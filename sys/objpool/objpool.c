@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_objpool
+ * @{
+ *
+ * @file
+ * @brief       Object pool implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "objpool.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+#define _INDEX_MASK     (0xffffUL)
+#define _TAG_INC        (0x10000UL)
+
+/* every free block stores the index + 1 of the next free block in its first
+ * two bytes, 0 terminates the stack */
+static inline uint16_t _get_next(const uint8_t *block)
+{
+    uint16_t next;
+
+    memcpy(&next, block, sizeof(next));
+    return next;
+}
+
+static inline void _set_next(uint8_t *block, uint16_t next)
+{
+    memcpy(block, &next, sizeof(next));
+}
+
+void objpool_init(objpool_t *pool, void *data, size_t size, size_t num)
+{
+    assert((pool != NULL) && (data != NULL) && (size >= sizeof(uint16_t)) &&
+           (num != 0) && (num <= OBJPOOL_NUMOF_MAX));
+
+    DEBUG("objpool: Initialize pool of %u times %u Bytes at %p\n",
+          (unsigned)num, (unsigned)size, data);
+
+    pool->data = data;
+    pool->size = size;
+    pool->num = num;
+    pool->used = 0;
+    pool->max_used = 0;
+    pool->failed = 0;
+    for (size_t i = 0; i < num; i++) {
+        _set_next(&pool->data[i * size], (i + 1 < num) ? (i + 2) : 0);
+    }
+    __atomic_store_n(&pool->head, 1, __ATOMIC_RELEASE);
+}
+
+void *objpool_alloc(objpool_t *pool)
+{
+    assert(pool != NULL);
+
+    uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_ACQUIRE);
+    uint32_t new_head;
+    uint8_t *block;
+
+    do {
+        unsigned idx = head & _INDEX_MASK;
+
+        if (idx == 0) {
+            __atomic_fetch_add(&pool->failed, 1, __ATOMIC_RELAXED);
+            DEBUG("objpool: %p exhausted\n", (void *)pool);
+            return NULL;
+        }
+        block = &pool->data[(idx - 1) * pool->size];
+        /* the block may have been allocated and written to by now, the swap
+         * fails in that case as the tag has changed */
+        new_head = ((head & ~_INDEX_MASK) + _TAG_INC) | _get_next(block);
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, new_head, false,
+                                          __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    unsigned used = __atomic_add_fetch(&pool->used, 1, __ATOMIC_RELAXED);
+    unsigned max_used = __atomic_load_n(&pool->max_used, __ATOMIC_RELAXED);
+
+    while ((used > max_used) &&
+           !__atomic_compare_exchange_n(&pool->max_used, &max_used, used, false,
+                                        __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {}
+
+    DEBUG("objpool: Allocate %u Bytes at %p\n", (unsigned)pool->size,
+          (void *)block);
+    return block;
+}
+
+void objpool_free(objpool_t *pool, void *ptr)
+{
+    assert((pool != NULL) && (ptr != NULL));
+
+    uint8_t *block = ptr;
+    size_t offset = block - pool->data;
+    uint16_t idx = (offset / pool->size) + 1;
+    uint32_t head = __atomic_load_n(&pool->head, __ATOMIC_RELAXED);
+    uint32_t new_head;
+
+    assert((block >= pool->data) && ((offset % pool->size) == 0) &&
+           ((offset / pool->size) < pool->num));
+
+    do {
+        _set_next(block, head & _INDEX_MASK);
+        new_head = ((head & ~_INDEX_MASK) + _TAG_INC) | idx;
+    } while (!__atomic_compare_exchange_n(&pool->head, &head, new_head, false,
+                                          __ATOMIC_RELEASE, __ATOMIC_RELAXED));
+
+    __atomic_fetch_sub(&pool->used, 1, __ATOMIC_RELAXED);
+    DEBUG("objpool: Free %u Bytes at %p\n", (unsigned)pool->size, ptr);
+}
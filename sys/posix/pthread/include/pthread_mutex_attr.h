@@ -168,7 +168,11 @@ int pthread_mutexattr_getprotocol(const pthread_mutexattr_t *attr, int *protocol
 
 /**
  * @brief            Sets the priority inheritance of the mutex to create.
- * @note             This implementation only supports `PTHREAD_PRIO_NONE` mutexes.
+ * @note             This implementation only supports `PTHREAD_PRIO_NONE` mutexes,
+ *                   and `PTHREAD_PRIO_INHERIT` mutexes with the
+ *                   `core_mutex_priority_inheritance` module. As all mutexes
+ *                   inherit priorities with that module, the setting has no
+ *                   effect.
  * @param[in,out]    attr       Attribute set to change.
  * @param[in]        protocol   Either #PTHREAD_PRIO_NONE or #PTHREAD_PRIO_INHERIT or #PTHREAD_PRIO_PROTECT.
  * @returns         `0` on success.
@@ -0,0 +1,164 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_round_robin
+ * @{
+ *
+ * @file
+ * @brief       Round robin scheduling implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+
+#include "clist.h"
+#include "irq.h"
+#include "sched.h"
+#include "sched_round_robin.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define ENABLE_DEBUG    (0)
+#include "debug.h"
+
+static uint32_t _quantum[KERNEL_PID_LAST + 1];
+/* rest of the quantum of threads that were preempted by a thread of higher
+ * priority, 0 if their next slice is a full quantum */
+static uint32_t _left[KERNEL_PID_LAST + 1];
+static xtimer_t _timer;
+/* thread the timer currently runs for, KERNEL_PID_UNDEF if not armed */
+static kernel_pid_t _slice_pid = KERNEL_PID_UNDEF;
+/* time the current slice ends at */
+static uint32_t _slice_end;
+static bool _initialized;
+
+static inline bool _has_peers(const thread_t *thread)
+{
+    const clist_node_t *rq = &sched_runqueues[thread->priority];
+
+    /* rq->next is the last node of the circular runqueue, which is its own
+     * successor if it is the only one */
+    return (rq->next != NULL) && (rq->next->next != rq->next);
+}
+
+static void _disarm(void)
+{
+    if (_slice_pid != KERNEL_PID_UNDEF) {
+        thread_t *thread = (thread_t *)thread_get(_slice_pid);
+
+        xtimer_remove(&_timer);
+        /* a preempted thread resumes its slice, a thread that blocked starts
+         * with a full quantum once it is ready again */
+        if ((thread != NULL) && (thread->status >= STATUS_ON_RUNQUEUE)) {
+            int32_t left = (int32_t)(_slice_end - xtimer_now_usec());
+
+            _left[_slice_pid] = (left > 0) ? (uint32_t)left : 1;
+        }
+        else {
+            _left[_slice_pid] = 0;
+        }
+        _slice_pid = KERNEL_PID_UNDEF;
+    }
+}
+
+static void _arm(const thread_t *thread)
+{
+    uint32_t slice = sched_round_robin_get_quantum(thread->pid);
+
+    _disarm();
+    if (slice == SCHED_ROUND_ROBIN_NO_PREEMPT) {
+        return;
+    }
+    if (_left[thread->pid] != 0) {
+        slice = _left[thread->pid];
+        _left[thread->pid] = 0;
+    }
+    _slice_pid = thread->pid;
+    _slice_end = xtimer_now_usec() + slice;
+    xtimer_set(&_timer, slice);
+}
+
+static void _expired(void *arg)
+{
+    thread_t *active = (thread_t *)sched_active_thread;
+    kernel_pid_t slice_pid = _slice_pid;
+
+    (void)arg;
+    _slice_pid = KERNEL_PID_UNDEF;
+    _left[slice_pid] = 0;
+    /* if the peers blocked in the meantime, the timer is armed again once one
+     * of them is ready */
+    if ((active == NULL) || (active->pid != slice_pid) ||
+        (active->status != STATUS_RUNNING) || !_has_peers(active)) {
+        return;
+    }
+    DEBUG("sched_round_robin: quantum of %" PRIkernel_pid " expired\n",
+          active->pid);
+    /* move the running thread to the end of its runqueue like thread_yield()
+     * does, unless it is not at the head anymore (sched_change_priority()
+     * appends threads), then the head is one of its peers already. The
+     * scheduler arms the timer for the next thread. */
+    clist_node_t *rq = &sched_runqueues[active->priority];
+    if (rq->next->next == &active->rq_entry) {
+        clist_lpoprpush(rq);
+    }
+    sched_context_switch_request = 1;
+}
+
+void sched_round_robin_init(void)
+{
+    unsigned state = irq_disable();
+
+    _timer.callback = _expired;
+    _timer.arg = NULL;
+    _initialized = true;
+    irq_restore(state);
+}
+
+void sched_round_robin_set_quantum(kernel_pid_t pid, uint32_t quantum)
+{
+    assert(pid_is_valid(pid));
+    _quantum[pid] = quantum;
+    _left[pid] = 0;
+}
+
+uint32_t sched_round_robin_get_quantum(kernel_pid_t pid)
+{
+    assert(pid_is_valid(pid));
+    return (_quantum[pid] != 0) ? _quantum[pid] : SCHED_ROUND_ROBIN_QUANTUM;
+}
+
+void sched_round_robin_switch(thread_t *thread)
+{
+    if (!_initialized) {
+        return;
+    }
+    if (_has_peers(thread)) {
+        _arm(thread);
+    }
+    else {
+        _disarm();
+    }
+}
+
+void sched_round_robin_ready(thread_t *thread)
+{
+    thread_t *active = (thread_t *)sched_active_thread;
+
+    /* the running thread got a peer: start its quantum */
+    if (_initialized && (_slice_pid == KERNEL_PID_UNDEF) && (active != NULL) &&
+        (active != thread) && (active->status == STATUS_RUNNING) &&
+        (active->priority == thread->priority)) {
+        _arm(active);
+    }
+}
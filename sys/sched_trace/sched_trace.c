@@ -0,0 +1,197 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_sched_trace
+ * @{
+ *
+ * @file
+ * @brief       Scheduler trace implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <errno.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "irq.h"
+#include "sched_trace.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifdef CPU_NATIVE
+#include <fcntl.h>
+#include "native_internal.h"
+#endif
+
+#define _MASK   (SCHED_TRACE_SIZE - 1)
+
+static sched_trace_entry_t _ring[SCHED_TRACE_SIZE];
+/* total number of entries recorded, the ring holds the last
+ * SCHED_TRACE_SIZE of them */
+static unsigned _count;
+static volatile bool _enabled;
+
+void sched_trace_init(void)
+{
+    sched_trace_clear();
+    _enabled = true;
+}
+
+void sched_trace_enable(bool enable)
+{
+    _enabled = enable;
+}
+
+void sched_trace_clear(void)
+{
+    unsigned state = irq_disable();
+
+    _count = 0;
+    irq_restore(state);
+}
+
+void sched_trace_record(uint8_t event, uint8_t info, kernel_pid_t a,
+                        kernel_pid_t b, uint16_t value)
+{
+    if (!_enabled) {
+        return;
+    }
+
+    unsigned state = irq_disable();
+    sched_trace_entry_t *entry = &_ring[_count++ & _MASK];
+
+    entry->time = xtimer_now().ticks32;
+    entry->event = event;
+    entry->info = info;
+    entry->a = a;
+    entry->b = b;
+    entry->value = value;
+    irq_restore(state);
+}
+
+unsigned sched_trace_get(sched_trace_entry_t *buf, unsigned max)
+{
+    unsigned state = irq_disable();
+    unsigned numof = (_count < SCHED_TRACE_SIZE) ? _count : SCHED_TRACE_SIZE;
+    unsigned start = _count - numof;
+
+    if (numof > max) {
+        /* skip the oldest ones */
+        start += numof - max;
+        numof = max;
+    }
+    for (unsigned i = 0; i < numof; i++) {
+        buf[i] = _ring[(start + i) & _MASK];
+    }
+    irq_restore(state);
+    return numof;
+}
+
+static void _write_names(sched_trace_write_t write, void *arg)
+{
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        char name[SCHED_TRACE_NAME_LEN] = { 0 };
+        const char *tmp = thread_getname(pid);
+
+        if (thread_get(pid) == NULL) {
+            continue;
+        }
+        if (tmp != NULL) {
+            strncpy(name, tmp, sizeof(name) - 1);
+        }
+        write(&pid, sizeof(pid), arg);
+        write(name, sizeof(name), arg);
+    }
+}
+
+unsigned sched_trace_dump(sched_trace_write_t write, void *arg)
+{
+    sched_trace_hdr_t hdr = {
+        .magic = SCHED_TRACE_MAGIC,
+        .version = SCHED_TRACE_VERSION,
+        .entry_size = sizeof(sched_trace_entry_t),
+        .hz = XTIMER_HZ,
+    };
+    bool enabled = _enabled;
+
+    /* output may block or send messages itself, so the ring is frozen while
+     * it is written */
+    _enabled = false;
+    hdr.numof = (_count < SCHED_TRACE_SIZE) ? _count : SCHED_TRACE_SIZE;
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        if (thread_get(pid) != NULL) {
+            hdr.names_numof++;
+        }
+    }
+    write(&hdr, sizeof(hdr), arg);
+    _write_names(write, arg);
+    for (unsigned i = _count - hdr.numof; i != _count; i++) {
+        write(&_ring[i & _MASK], sizeof(sched_trace_entry_t), arg);
+    }
+    _count = 0;
+    _enabled = enabled;
+    return hdr.numof;
+}
+
+void sched_trace_print(void)
+{
+    static const char *names[] = { "switch", "irq enter", "irq exit", "send",
+                                   "recv" };
+    bool enabled = _enabled;
+    unsigned numof = (_count < SCHED_TRACE_SIZE) ? _count : SCHED_TRACE_SIZE;
+
+    _enabled = false;
+    printf("%u of %u events (%lu ticks/s)\n", numof, _count,
+           (unsigned long)XTIMER_HZ);
+    for (unsigned i = _count - numof; i != _count; i++) {
+        sched_trace_entry_t *entry = &_ring[i & _MASK];
+        const char *name = "?";
+
+        if (entry->event < (sizeof(names) / sizeof(names[0]))) {
+            name = names[entry->event];
+        }
+        printf("%10" PRIu32 " %-9s %3" PRIkernel_pid " -> %3" PRIkernel_pid
+               " info: %3u value: 0x%04x\n", entry->time, name,
+               entry->a, entry->b, entry->info, entry->value);
+    }
+    _enabled = enabled;
+}
+
+#ifdef CPU_NATIVE
+static void _write_fd(const void *buf, size_t len, void *arg)
+{
+    int *fd = arg;
+
+    if ((*fd >= 0) && (real_write(*fd, buf, len) != (ssize_t)len)) {
+        real_close(*fd);
+        *fd = -EIO;
+    }
+}
+
+int sched_trace_dump_file(const char *path)
+{
+    int fd = real_open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    unsigned numof;
+
+    if (fd < 0) {
+        return -errno;
+    }
+    numof = sched_trace_dump(_write_fd, &fd);
+    if (fd < 0) {
+        return fd;
+    }
+    real_close(fd);
+    return numof;
+}
+#endif
@@ -27,9 +27,7 @@
 #include "net/gnrc/netif/hdr.h"
 #include "net/lora.h"
 
-#ifdef MODULE_NETSTATS
 #include "net/netstats.h"
-#endif
 #ifdef MODULE_L2FILTER
 #include "net/l2filter.h"
 #endif
@@ -592,6 +590,15 @@ static void _netif_list(kernel_pid_t iface)
     }
 #endif
 
+    netstats_rx_batch_t rx_batch;
+    res = gnrc_netapi_get(iface, NETOPT_RX_BATCH_STATS, 0, &rx_batch,
+                          sizeof(rx_batch));
+    if (res >= 0) {
+        printf("\n          RX wakeups %" PRIu32 "  frames %" PRIu32
+               "  max. frames per wakeup %" PRIu32 "\n", rx_batch.wakeups,
+               rx_batch.frames, rx_batch.max_batch);
+    }
+
 #ifdef MODULE_NETSTATS_L2
     puts("");
     _netif_stats(iface, NETSTATS_LAYER2, false);
@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ * @author  Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+
+#include "net/gnrc/tcp.h"
+
+int _gnrc_tcp_cmd(int argc, char **argv)
+{
+    (void)argc;
+    (void)argv;
+    gnrc_tcp_stats();
+    return 0;
+}
+
+/** @} */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     sys_shell_commands
+ * @{
+ *
+ * @file
+ * @brief       Shell command for the scheduler trace
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "sched_trace.h"
+
+static void _usage(const char *cmd)
+{
+#ifdef CPU_NATIVE
+    printf("usage: %s [clear|dump <file>]\n", cmd);
+#else
+    printf("usage: %s [clear]\n", cmd);
+#endif
+}
+
+int _sched_trace_handler(int argc, char **argv)
+{
+    if (argc == 1) {
+        sched_trace_print();
+    }
+    else if (strcmp(argv[1], "clear") == 0) {
+        sched_trace_clear();
+    }
+#ifdef CPU_NATIVE
+    else if ((argc == 3) && (strcmp(argv[1], "dump") == 0)) {
+        int res = sched_trace_dump_file(argv[2]);
+
+        if (res < 0) {
+            printf("error: unable to write %s (%d)\n", argv[2], res);
+            return 1;
+        }
+        printf("wrote %d events to %s\n", res, argv[2]);
+    }
+#endif
+    else {
+        _usage(argv[0]);
+        return 1;
+    }
+    return 0;
+}
@@ -111,6 +111,10 @@ extern int _gnrc_pktbuf_cmd(int argc, char **argv);
 extern int _gnrc_rpl(int argc, char **argv);
 #endif
 
+#ifdef MODULE_GNRC_TCP
+extern int _gnrc_tcp_cmd(int argc, char **argv);
+#endif
+
 #ifdef MODULE_GNRC_SIXLOWPAN_CTX
 #ifdef MODULE_GNRC_IPV6_NIB_6LBR
 extern int _gnrc_6ctx(int argc, char **argv);
@@ -153,6 +157,10 @@ extern int _i2c_scan(int argc, char **argv);
 extern int _loramac_handler(int argc, char **argv);
 #endif
 
+#ifdef MODULE_SCHED_TRACE
+extern int _sched_trace_handler(int argc, char **argv);
+#endif
+
 const shell_command_t _shell_command_list[] = {
     {"reboot", "Reboot the node", _reboot_handler},
 #ifdef MODULE_CONFIG
@@ -216,6 +224,9 @@ const shell_command_t _shell_command_list[] = {
 #ifdef MODULE_GNRC_RPL
     {"rpl", "rpl configuration tool ('rpl help' for more information)", _gnrc_rpl },
 #endif
+#ifdef MODULE_GNRC_TCP
+    {"tcp", "prints state and statistics of TCP connections", _gnrc_tcp_cmd },
+#endif
 #ifdef MODULE_GNRC_SIXLOWPAN_CTX
 #ifdef MODULE_GNRC_IPV6_NIB_6LBR
     {"6ctx", "6LoWPAN context configuration tool", _gnrc_6ctx },
@@ -251,6 +262,9 @@ const shell_command_t _shell_command_list[] = {
 #endif
 #ifdef MODULE_SEMTECH_LORAMAC
     {"loramac", "Control Semtech loramac stack", _loramac_handler},
+#endif
+#ifdef MODULE_SCHED_TRACE
+    {"schedtrace", "Prints or dumps the scheduler trace", _sched_trace_handler},
 #endif
     {NULL, NULL, NULL}
 };
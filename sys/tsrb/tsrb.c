@@ -17,16 +17,39 @@
  * @}
  */
 
+#include <string.h>
+
 #include "tsrb.h"
 
+/* the other side of the buffer may look at the counters at any time, so the
+ * compiler must not move buffer accesses across their updates */
+#define _BARRIER()      __asm__ volatile ("" : : : "memory")
+
+static inline void _copy(uint8_t *dst, const uint8_t *src, size_t n)
+{
+    /* single bytes are common on UARTs, don't pay a call to memcpy() for them */
+    if (n == 1) {
+        *dst = *src;
+    }
+    else if (n > 1) {
+        memcpy(dst, src, n);
+    }
+}
+
 static void _push(tsrb_t *rb, uint8_t c)
 {
-    rb->buf[rb->writes++ & (rb->size - 1)] = c;
+    rb->buf[rb->writes & (rb->size - 1)] = c;
+    _BARRIER();
+    rb->writes++;
 }
 
 static uint8_t _pop(tsrb_t *rb)
 {
-    return rb->buf[rb->reads++ & (rb->size - 1)];
+    uint8_t c = rb->buf[rb->reads & (rb->size - 1)];
+
+    _BARRIER();
+    rb->reads++;
+    return c;
 }
 
 int tsrb_get_one(tsrb_t *rb)
@@ -41,22 +64,35 @@ int tsrb_get_one(tsrb_t *rb)
 
 int tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        *dst++ = _pop(rb);
-        tmp--;
+    unsigned reads = rb->reads;
+    unsigned pos = reads & (rb->size - 1);
+    size_t avail = rb->writes - reads;
+    size_t len = rb->size - pos;
+
+    if (n > avail) {
+        n = avail;
     }
-    return (n - tmp);
+    if (len > n) {
+        len = n;
+    }
+    /* the remainder, if any, starts at the beginning of the buffer */
+    _copy(dst, &rb->buf[pos], len);
+    _copy(dst + len, rb->buf, n - len);
+    _BARRIER();
+    rb->reads = reads + n;
+    return n;
 }
 
 int tsrb_drop(tsrb_t *rb, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_empty(rb)) {
-        _pop(rb);
-        tmp--;
+    size_t avail = tsrb_avail(rb);
+
+    if (n > avail) {
+        n = avail;
     }
-    return (n - tmp);
+    _BARRIER();
+    rb->reads += n;
+    return n;
 }
 
 int tsrb_add_one(tsrb_t *rb, uint8_t c)
@@ -72,10 +108,46 @@ int tsrb_add_one(tsrb_t *rb, uint8_t c)
 
 int tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
 {
-    size_t tmp = n;
-    while (tmp && !tsrb_full(rb)) {
-        _push(rb, *src++);
-        tmp--;
+    unsigned writes = rb->writes;
+    unsigned pos = writes & (rb->size - 1);
+    size_t free = rb->size - (writes - rb->reads);
+    size_t len = rb->size - pos;
+
+    if (n > free) {
+        n = free;
     }
-    return (n - tmp);
+    if (len > n) {
+        len = n;
+    }
+    /* the remainder, if any, goes to the beginning of the buffer */
+    _copy(&rb->buf[pos], src, len);
+    _copy(rb->buf, src + len, n - len);
+    _BARRIER();
+    rb->writes = writes + n;
+    return n;
+}
+
+unsigned tsrb_reserve(tsrb_t *rb, uint8_t **region)
+{
+    unsigned pos = rb->writes & (rb->size - 1);
+    unsigned free = tsrb_free(rb);
+
+    *region = &rb->buf[pos];
+    return ((rb->size - pos) < free) ? (rb->size - pos) : free;
+}
+
+void tsrb_commit(tsrb_t *rb, size_t n)
+{
+    assert(n <= tsrb_free(rb));
+    _BARRIER();
+    rb->writes += n;
+}
+
+unsigned tsrb_peek_region(const tsrb_t *rb, uint8_t **region)
+{
+    unsigned pos = rb->reads & (rb->size - 1);
+    unsigned avail = tsrb_avail(rb);
+
+    *region = &rb->buf[pos];
+    return ((rb->size - pos) < avail) ? (rb->size - pos) : avail;
 }
@@ -252,6 +252,133 @@ int _xtimer_set_absolute(xtimer_t *timer, uint32_t target)
     return res;
 }
 
+#ifdef MODULE_XTIMER_HEAP
+/*
+ * Timer "lists" are pairing heaps: xtimer_t::next links siblings,
+ * xtimer_t::child points to the leftmost child and xtimer_t::prev points to
+ * the left sibling or, for the leftmost child, to the parent. Roots have
+ * neither siblings nor a parent.
+ */
+static inline int _heap_before(xtimer_t *a, xtimer_t *b, int long_key)
+{
+    if (long_key && (a->long_target != b->long_target)) {
+        return a->long_target < b->long_target;
+    }
+    return a->target <= b->target;
+}
+
+static xtimer_t *_heap_meld(xtimer_t *a, xtimer_t *b, int long_key)
+{
+    if (!a) {
+        return b;
+    }
+    if (!b) {
+        return a;
+    }
+    if (!_heap_before(a, b, long_key)) {
+        xtimer_t *tmp = a;
+        a = b;
+        b = tmp;
+    }
+    /* make b the leftmost child of a */
+    b->prev = a;
+    b->next = a->child;
+    if (a->child) {
+        a->child->prev = b;
+    }
+    a->child = b;
+    return a;
+}
+
+static xtimer_t *_heap_merge_pairs(xtimer_t *first, int long_key)
+{
+    xtimer_t *pairs = NULL;
+    xtimer_t *res = NULL;
+
+    /* first pass: meld siblings pairwise from left to right */
+    while (first) {
+        xtimer_t *a = first;
+        xtimer_t *b = first->next;
+
+        first = (b) ? b->next : NULL;
+        a->next = a->prev = NULL;
+        if (b) {
+            b->next = b->prev = NULL;
+        }
+        a = _heap_meld(a, b, long_key);
+        a->next = pairs;
+        pairs = a;
+    }
+    /* second pass: meld the pairs from right to left */
+    while (pairs) {
+        xtimer_t *next = pairs->next;
+
+        pairs->next = NULL;
+        res = _heap_meld(res, pairs, long_key);
+        pairs = next;
+    }
+    return res;
+}
+
+static xtimer_t *_heap_pop(xtimer_t **root, int long_key)
+{
+    xtimer_t *timer = *root;
+
+    *root = _heap_merge_pairs(timer->child, long_key);
+    timer->child = NULL;
+    return timer;
+}
+
+/* removes a non-root timer from whatever heap it is part of */
+static void _heap_cut(xtimer_t *timer)
+{
+    xtimer_t *first = timer->child;
+
+    /* the children are not earlier than timer, so they can take its place
+     * among its siblings without violating the heap order */
+    if (first) {
+        xtimer_t *last = first;
+
+        while (last->next) {
+            last = last->next;
+        }
+        last->next = timer->next;
+        if (timer->next) {
+            timer->next->prev = last;
+        }
+    }
+    else {
+        first = timer->next;
+    }
+    if (first) {
+        first->prev = timer->prev;
+    }
+    if (timer->prev->child == timer) {
+        timer->prev->child = first;
+    }
+    else {
+        timer->prev->next = first;
+    }
+    timer->child = timer->next = timer->prev = NULL;
+}
+
+static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    timer->child = timer->prev = NULL;
+    *list_head = _heap_meld(*list_head, timer, 0);
+}
+
+static void _add_timer_to_long_list(xtimer_t **list_head, xtimer_t *timer)
+{
+    timer->child = timer->prev = NULL;
+    *list_head = _heap_meld(*list_head, timer, 1);
+}
+
+static inline xtimer_t *_pop_timer(xtimer_t **list_head)
+{
+    return _heap_pop(list_head, 0);
+}
+#else /* MODULE_XTIMER_HEAP */
 static void _add_timer_to_list(xtimer_t **list_head, xtimer_t *timer)
 {
     while (*list_head && (*list_head)->target <= timer->target) {
@@ -287,11 +414,20 @@ static int _remove_timer_from_list(xtimer_t **list_head, xtimer_t *timer)
     return 0;
 }
 
+static inline xtimer_t *_pop_timer(xtimer_t **list_head)
+{
+    xtimer_t *timer = *list_head;
+
+    *list_head = timer->next;
+    return timer;
+}
+#endif /* MODULE_XTIMER_HEAP */
+
 static void _remove(xtimer_t *timer)
 {
     if (timer_list_head == timer) {
         uint32_t next;
-        timer_list_head = timer->next;
+        _pop_timer(&timer_list_head);
         if (timer_list_head) {
             /* schedule callback on next timer target time */
             next = timer_list_head->target - XTIMER_OVERHEAD;
@@ -301,6 +437,20 @@ static void _remove(xtimer_t *timer)
         }
         _lltimer_set(next);
     }
+#ifdef MODULE_XTIMER_HEAP
+    else if (overflow_list_head == timer) {
+        _heap_pop(&overflow_list_head, 0);
+    }
+    else if (long_list_head == timer) {
+        _heap_pop(&long_list_head, 1);
+    }
+    else if (timer->prev) {
+        _heap_cut(timer);
+    }
+    /* mark timer as unset, so it is never cut from a heap twice */
+    timer->target = 0;
+    timer->long_target = 0;
+#else
     else {
         if (!_remove_timer_from_list(&timer_list_head, timer)) {
             if (!_remove_timer_from_list(&overflow_list_head, timer)) {
@@ -308,6 +458,7 @@ static void _remove(xtimer_t *timer)
             }
         }
     }
+#endif
 }
 
 void xtimer_remove(xtimer_t *timer)
@@ -346,6 +497,21 @@ static inline int _this_high_period(uint32_t target)
 #endif
 }
 
+#ifdef MODULE_XTIMER_HEAP
+/**
+ * @brief move long timers that will expire in the current short timer period
+ *        to the current timer heap
+ */
+static void _select_long_timers(void)
+{
+    while (long_list_head && (long_list_head->long_target <= _long_cnt) &&
+           _this_high_period(long_list_head->target)) {
+        xtimer_t *timer = _heap_pop(&long_list_head, 1);
+
+        _add_timer_to_list(&timer_list_head, timer);
+    }
+}
+#else /* MODULE_XTIMER_HEAP */
 /**
  * @brief compare two timers' target values, return the one with lower value.
  *
@@ -435,6 +601,7 @@ static void _select_long_timers(void)
         }
     }
 }
+#endif /* MODULE_XTIMER_HEAP */
 
 /**
  * @brief handle low-level timer overflow, advance to next short timer period
@@ -454,7 +621,28 @@ static void _next_period(void)
 #endif
 
     /* swap overflow list to current timer list */
+#ifdef MODULE_XTIMER_HEAP
+    /* timers of the past period that were not fired in time are kept, a heap
+     * node must never be left dangling. They are due at the start of this
+     * period, so they fire before its timers instead of at their old offset
+     * within it */
+    xtimer_t *late = timer_list_head;
+
+    timer_list_head = overflow_list_head;
+    while (late) {
+        xtimer_t *timer = _heap_pop(&late, 0);
+
+#if XTIMER_MASK
+        timer->target = _xtimer_high_cnt;
+#else
+        timer->target = 0;
+#endif
+        timer->long_target = _long_cnt;
+        _add_timer_to_list(&timer_list_head, timer);
+    }
+#else
     timer_list_head = overflow_list_head;
+#endif
     overflow_list_head = NULL;
 
     _select_long_timers();
@@ -503,11 +691,8 @@ overflow:
         /* make sure we don't fire too early */
         while (_time_left(_xtimer_lltimer_mask(timer_list_head->target), reference)) {}
 
-        /* pick first timer in list */
-        xtimer_t *timer = timer_list_head;
-
-        /* advance list */
-        timer_list_head = timer->next;
+        /* pick first timer in list and advance list */
+        xtimer_t *timer = _pop_timer(&timer_list_head);
 
         /* make sure timer is recognized as being already fired */
         timer->target = 0;
@@ -0,0 +1,154 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure throughput and latency of event work queues with
+ *              different numbers of workers
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "irq.h"
+#include "kernel_defines.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "event/workqueue.h"
+
+#ifndef BENCH_JOBS_NUMOF
+#define BENCH_JOBS_NUMOF    (64U)
+#endif
+
+#ifndef BENCH_JOB_SPIN
+#define BENCH_JOB_SPIN      (1000U)
+#endif
+
+#ifndef BENCH_JOB_SLEEP_US
+#define BENCH_JOB_SLEEP_US  (2000U)
+#endif
+
+#define FLAG_DONE           (0x1)
+#define WORKERS_TOTAL       (1U + 2U + 4U)
+#define RUNS_NUMOF          (sizeof(_numof) / sizeof(_numof[0]))
+
+typedef struct {
+    event_t super;
+    uint32_t submitted;
+} job_t;
+
+static const unsigned _numof[] = { 1, 2, 4 };
+static event_workqueue_t _wq[RUNS_NUMOF];
+static event_workqueue_worker_t _workers[WORKERS_TOTAL];
+static char _stacks[WORKERS_TOTAL][THREAD_STACKSIZE_DEFAULT];
+static job_t _jobs[BENCH_JOBS_NUMOF];
+static thread_t *_main;
+static uint32_t _sleep;
+static unsigned _done;
+static uint32_t _latency_sum;
+static uint32_t _latency_max;
+static volatile unsigned _sink;
+
+static void _handler(event_t *event)
+{
+    job_t *job = container_of(event, job_t, super);
+    uint32_t latency = xtimer_now_usec() - job->submitted;
+    unsigned state;
+
+    for (unsigned i = 0; i < BENCH_JOB_SPIN; i++) {
+        _sink++;
+    }
+    if (_sleep) {
+        xtimer_usleep(_sleep);
+    }
+
+    state = irq_disable();
+    _latency_sum += latency;
+    if (latency > _latency_max) {
+        _latency_max = latency;
+    }
+    bool last = (++_done == BENCH_JOBS_NUMOF);
+    irq_restore(state);
+
+    if (last) {
+        thread_flags_set(_main, FLAG_DONE);
+    }
+}
+
+static bool _bench(const char *name, event_workqueue_t *wq, uint32_t sleep)
+{
+    unsigned stolen = 0;
+
+    _sleep = sleep;
+    _done = 0;
+    _latency_sum = 0;
+    _latency_max = 0;
+    for (unsigned i = 0; i < wq->numof; i++) {
+        wq->workers[i].stolen = 0;
+    }
+
+    uint32_t start = xtimer_now_usec();
+    for (unsigned i = 0; i < BENCH_JOBS_NUMOF; i++) {
+        _jobs[i].submitted = xtimer_now_usec();
+        event_workqueue_submit(wq, &_jobs[i].super);
+    }
+    thread_flags_wait_any(FLAG_DONE);
+    uint32_t diff = xtimer_now_usec() - start;
+
+    for (unsigned i = 0; i < wq->numof; i++) {
+        stolen += wq->workers[i].stolen;
+    }
+    printf("%s: workers: %u, %u/%u jobs, %lu jobs/s, latency avg: %lu us, "
+           "max: %lu us, stolen: %u\n", name, wq->numof, _done,
+           BENCH_JOBS_NUMOF,
+           (unsigned long)(((uint64_t)_done * US_PER_SEC) / diff),
+           (unsigned long)(_latency_sum / BENCH_JOBS_NUMOF),
+           (unsigned long)_latency_max, stolen);
+    return (_done == BENCH_JOBS_NUMOF);
+}
+
+int main(void)
+{
+    bool success = true;
+    unsigned offset = 0;
+
+    puts("event work queue benchmark");
+    printf("jobs: %u, spin: %u, sleep: %u us\n", BENCH_JOBS_NUMOF,
+           BENCH_JOB_SPIN, BENCH_JOB_SLEEP_US);
+
+    _main = (thread_t *)sched_active_thread;
+    for (unsigned i = 0; i < BENCH_JOBS_NUMOF; i++) {
+        _jobs[i].super.handler = _handler;
+    }
+    for (unsigned i = 0; i < RUNS_NUMOF; i++) {
+        if (event_workqueue_init(&_wq[i], &_workers[offset], _numof[i],
+                                 _stacks[offset], sizeof(_stacks[0]),
+                                 THREAD_PRIORITY_MAIN - 1) < 0) {
+            puts("FAILED: unable to start workers");
+            return 1;
+        }
+        offset += _numof[i];
+    }
+
+    for (unsigned i = 0; i < RUNS_NUMOF; i++) {
+        success &= _bench("cpu", &_wq[i], 0);
+    }
+    for (unsigned i = 0; i < RUNS_NUMOF; i++) {
+        success &= _bench("io", &_wq[i], BENCH_JOB_SLEEP_US);
+    }
+
+    puts(success ? "SUCCESS" : "FAILED");
+    return 0;
+}
@@ -0,0 +1,23 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for kind in ("cpu", "io"):
+        for workers in (1, 2, 4):
+            child.expect(r"{}: workers: {}, (\d+)/(\d+) jobs, \d+ jobs/s"
+                         .format(kind, workers))
+            assert child.match.group(1) == child.match.group(2)
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
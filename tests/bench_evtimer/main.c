@@ -0,0 +1,85 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure evtimer_add() and evtimer_del() depending on the
+ *              number of pending events
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "evtimer.h"
+#include "random.h"
+#include "xtimer.h"
+
+#ifndef BENCH_EVENTS_MAX
+#define BENCH_EVENTS_MAX    (100U)
+#endif
+
+/* events are deleted in the order i * BENCH_DEL_STRIDE % n, the stride must
+ * be coprime to all numbers of events benchmarked */
+#define BENCH_DEL_STRIDE    (7U)
+/* offsets are far in the future, so no event fires while measuring */
+#define BENCH_OFFSET_MIN    (3600LU * MS_PER_SEC)
+
+static evtimer_t bench_evtimer;
+static evtimer_event_t bench_events[BENCH_EVENTS_MAX];
+static const unsigned bench_numof[] = { 10, 100, 1000 };
+
+static void bench_handler(evtimer_event_t *event)
+{
+    (void)event;
+}
+
+static void bench(unsigned numof)
+{
+    uint32_t start, add, del;
+
+    for (unsigned i = 0; i < numof; i++) {
+        bench_events[i].offset = BENCH_OFFSET_MIN +
+                                 random_uint32_range(0, BENCH_OFFSET_MIN);
+    }
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < numof; i++) {
+        evtimer_add(&bench_evtimer, &bench_events[i]);
+    }
+    add = xtimer_now_usec() - start;
+
+    start = xtimer_now_usec();
+    for (unsigned i = 0; i < numof; i++) {
+        evtimer_del(&bench_evtimer, &bench_events[(i * BENCH_DEL_STRIDE) % numof]);
+    }
+    del = xtimer_now_usec() - start;
+
+    printf("{ \"events\" : %u, \"add_ns\" : %lu, \"del_ns\" : %lu }\n", numof,
+           (unsigned long)(((uint64_t)add * NS_PER_US) / numof),
+           (unsigned long)(((uint64_t)del * NS_PER_US) / numof));
+}
+
+int main(void)
+{
+    /* average time per evtimer_add() and evtimer_del() with n events
+     * pending */
+    puts("Benchmarking evtimer");
+    evtimer_init(&bench_evtimer, bench_handler);
+    for (unsigned i = 0; i < sizeof(bench_numof) / sizeof(bench_numof[0]); i++) {
+        if (bench_numof[i] <= BENCH_EVENTS_MAX) {
+            bench(bench_numof[i]);
+        }
+    }
+    puts("Benchmark done");
+    return 0;
+}
@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact("Benchmarking evtimer")
+    child.expect(r"{ \"events\" : 10, \"add_ns\" : \d+, \"del_ns\" : \d+ }")
+    child.expect_exact("Benchmark done")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,162 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure FIB look-ups per second depending on the number of
+ *              entries in the table
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "random.h"
+#include "xtimer.h"
+#include "net/fib.h"
+
+#ifndef BENCH_LOOKUPS
+#define BENCH_LOOKUPS       (10000U)
+#endif
+
+#define BENCH_ADDR_SIZE     (16U)
+#define BENCH_TABLE_SIZE    (1024U)
+#define BENCH_IFACE         (1U)
+
+#ifdef MODULE_FIB_TRIE
+#define BENCH_TRIE          "yes"
+#else
+#define BENCH_TRIE          "no"
+#endif
+
+static const unsigned _sizes[] = { 16, 128, 1024 };
+static fib_entry_t _entries[BENCH_TABLE_SIZE];
+static fib_table_t _table = { .data.entries = _entries,
+                              .table_type = FIB_TABLE_TYPE_SH,
+                              .size = BENCH_TABLE_SIZE,
+                              .mtx_access = MUTEX_INIT,
+                              .notify_rp_pos = 0 };
+static uint8_t _pfxs[BENCH_TABLE_SIZE][BENCH_ADDR_SIZE];
+static uint8_t _pfx_lens[BENCH_TABLE_SIZE];
+
+/* fe80::<idx + 1> */
+static void _next_hop(uint8_t *next_hop, unsigned idx)
+{
+    memset(next_hop, 0, BENCH_ADDR_SIZE);
+    next_hop[0] = 0xfe;
+    next_hop[1] = 0x80;
+    next_hop[14] = (idx + 1) >> 8;
+    next_hop[15] = (idx + 1) & 0xff;
+}
+
+static bool _covers(const uint8_t *pfx, unsigned pfx_len, const uint8_t *addr)
+{
+    unsigned bytes = pfx_len / 8;
+    unsigned bits = pfx_len % 8;
+
+    if (memcmp(pfx, addr, bytes) != 0) {
+        return false;
+    }
+    return (bits == 0) ||
+           (((pfx[bytes] ^ addr[bytes]) & (0xff << (8 - bits))) == 0);
+}
+
+static int _add_route(unsigned idx)
+{
+    uint8_t *pfx = _pfxs[idx];
+    uint8_t next_hop[BENCH_ADDR_SIZE];
+
+    /* 2001:db8::/32 */
+    memset(pfx, 0, BENCH_ADDR_SIZE);
+    pfx[0] = 0x20;
+    pfx[1] = 0x01;
+    pfx[2] = 0x0d;
+    pfx[3] = 0xb8;
+    random_bytes(&pfx[4], 4);
+    _pfx_lens[idx] = 48 + (random_uint32() % 17);
+    _next_hop(next_hop, idx);
+    return fib_add_entry(&_table, BENCH_IFACE, pfx, BENCH_ADDR_SIZE,
+                         ((uint32_t)_pfx_lens[idx] << FIB_FLAG_NET_PREFIX_SHIFT),
+                         next_hop, BENCH_ADDR_SIZE, 0,
+                         (uint32_t)FIB_LIFETIME_NO_EXPIRE);
+}
+
+static bool _check(const uint8_t *dst, unsigned route,
+                   const uint8_t *next_hop)
+{
+    /* find the route by the next hop we gave it */
+    unsigned idx = ((next_hop[14] << 8) | next_hop[15]) - 1;
+
+    return (idx < BENCH_TABLE_SIZE) &&
+           _covers(_pfxs[idx], _pfx_lens[idx], dst) &&
+           (_pfx_lens[idx] >= _pfx_lens[route]);
+}
+
+static bool _bench(unsigned entries)
+{
+    bool success = true;
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < BENCH_LOOKUPS; i++) {
+        uint8_t dst[BENCH_ADDR_SIZE];
+        uint8_t next_hop[BENCH_ADDR_SIZE];
+        size_t next_hop_size = sizeof(next_hop);
+        uint32_t next_hop_flags;
+        kernel_pid_t iface;
+        unsigned route = i % entries;
+
+        memcpy(dst, _pfxs[route], sizeof(dst));
+        dst[12] = i >> 24;
+        dst[13] = i >> 16;
+        dst[14] = i >> 8;
+        dst[15] = i;
+        if ((fib_get_next_hop(&_table, &iface, next_hop, &next_hop_size,
+                              &next_hop_flags, dst, sizeof(dst), 0) < 0) ||
+            !_check(dst, route, next_hop)) {
+            success = false;
+        }
+    }
+
+    uint32_t diff = xtimer_now_usec() - start;
+
+    if (diff == 0) {
+        diff = 1;
+    }
+    printf("%5u entries: %lu lookups/s\n", entries,
+           (unsigned long)(((uint64_t)BENCH_LOOKUPS * US_PER_SEC) / diff));
+    return success;
+}
+
+int main(void)
+{
+    bool success = true;
+    unsigned entries = 0;
+
+    puts("FIB look-up benchmark");
+    printf("look-ups: %u, prefix trie: %s\n", BENCH_LOOKUPS, BENCH_TRIE);
+    fib_init(&_table);
+    for (unsigned i = 0; i < sizeof(_sizes) / sizeof(_sizes[0]); i++) {
+        for (; entries < _sizes[i]; entries++) {
+            if (_add_route(entries) < 0) {
+                puts("FAILED: unable to add route");
+                return 1;
+            }
+        }
+        success &= _bench(entries);
+    }
+
+    puts(success ? "SUCCESS" : "FAILED: wrong route returned");
+    return 0;
+}
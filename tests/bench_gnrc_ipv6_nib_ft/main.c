@@ -0,0 +1,106 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure forwarding table look-ups per second depending on the
+ *              number of routes in the NIB
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "xtimer.h"
+#include "net/gnrc/ipv6/nib/ft.h"
+#include "net/ipv6/addr.h"
+
+#ifndef BENCH_LOOKUPS
+#define BENCH_LOOKUPS   (10000U)
+#endif
+
+#define BENCH_IFACE     (1U)
+
+static const unsigned _sizes[] = { 8, 32, 64, 128 };
+static ipv6_addr_t _pfxs[GNRC_IPV6_NIB_OFFL_NUMOF];
+static uint8_t _pfx_lens[GNRC_IPV6_NIB_OFFL_NUMOF];
+static const ipv6_addr_t _next_hop = { {
+        0xfe, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    } };
+
+static int _add_route(unsigned idx)
+{
+    ipv6_addr_t *pfx = &_pfxs[idx];
+
+    /* 2001:db8::/32 */
+    pfx->u8[0] = 0x20;
+    pfx->u8[1] = 0x01;
+    pfx->u8[2] = 0x0d;
+    pfx->u8[3] = 0xb8;
+    random_bytes(&pfx->u8[4], 4);
+    _pfx_lens[idx] = 48 + (random_uint32() % 17);
+    return gnrc_ipv6_nib_ft_add(pfx, _pfx_lens[idx], &_next_hop, BENCH_IFACE,
+                                0);
+}
+
+static bool _bench(unsigned routes)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    bool success = true;
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < BENCH_LOOKUPS; i++) {
+        ipv6_addr_t dst = _pfxs[i % routes];
+
+        dst.u64[1].u32[0] = i;
+        if ((gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) < 0) ||
+            (ipv6_addr_match_prefix(&fte.dst, &dst) < fte.dst_len) ||
+            (fte.dst_len < _pfx_lens[i % routes])) {
+            success = false;
+        }
+    }
+
+    uint32_t diff = xtimer_now_usec() - start;
+
+    if (diff == 0) {
+        diff = 1;
+    }
+    printf("%5u routes: %lu lookups/s\n", routes,
+           (unsigned long)(((uint64_t)BENCH_LOOKUPS * US_PER_SEC) / diff));
+    return success;
+}
+
+int main(void)
+{
+    bool success = true;
+    unsigned routes = 0;
+
+    puts("NIB forwarding table look-up benchmark");
+    printf("look-ups: %u, prefix trie: %s\n", BENCH_LOOKUPS,
+           GNRC_IPV6_NIB_CONF_OFFL_TRIE ? "yes" : "no");
+    for (unsigned i = 0; i < sizeof(_sizes) / sizeof(_sizes[0]); i++) {
+        for (; routes < _sizes[i]; routes++) {
+            if (_add_route(routes) < 0) {
+                puts("FAILED: unable to add route");
+                return 1;
+            }
+        }
+        success &= _bench(routes);
+    }
+
+    puts(success ? "SUCCESS" : "FAILED: wrong route returned");
+    return 0;
+}
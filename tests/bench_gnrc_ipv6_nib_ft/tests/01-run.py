@@ -0,0 +1,20 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    for routes in (8, 32, 64, 128):
+        child.expect(r"{:>5} routes: \d+ lookups/s".format(routes))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
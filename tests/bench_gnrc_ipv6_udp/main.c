@@ -0,0 +1,351 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Measure packets per second through the GNRC IPv6 to UDP
+ *              receive path and compare sock_udp_recv() with
+ *              sock_udp_recv_buf()
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "msg.h"
+#include "thread.h"
+#include "xtimer.h"
+#include "net/gnrc/ipv6.h"
+#include "net/gnrc/netapi.h"
+#include "net/gnrc/netreg.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/udp.h"
+#include "net/protnum.h"
+#include "net/sock/udp.h"
+
+#ifndef BENCH_PKTS_NUMOF
+#define BENCH_PKTS_NUMOF    (20000U)
+#endif
+
+#ifndef BENCH_BURST
+#define BENCH_BURST         (8U)
+#endif
+
+#ifndef BENCH_PAYLOAD_SIZE
+#define BENCH_PAYLOAD_SIZE  (32U)
+#endif
+
+#ifndef BENCH_SOCK_PKTS_NUMOF
+#define BENCH_SOCK_PKTS_NUMOF   (4000U)
+#endif
+
+#ifndef BENCH_SOCK_PAYLOAD_MAX
+#define BENCH_SOCK_PAYLOAD_MAX  (1024U)
+#endif
+
+/* sock mbox holds up to SOCK_MBOX_SIZE packets */
+#define BENCH_SOCK_BURST    (4U)
+#define BENCH_PORT          (6789U)
+#define BENCH_SOCK_PORT     (6790U)
+#define SINK_QUEUE_SIZE     (16U)
+#define SOCK_SIZES_NUMOF    (sizeof(_sock_sizes) / sizeof(_sock_sizes[0]))
+
+static const unsigned _sock_sizes[] = { 16, 256, BENCH_SOCK_PAYLOAD_MAX };
+static char _sink_stack[THREAD_STACKSIZE_DEFAULT];
+static char _feeder_stack[THREAD_STACKSIZE_DEFAULT];
+static char _sock_stack[THREAD_STACKSIZE_DEFAULT + BENCH_SOCK_PAYLOAD_MAX];
+static kernel_pid_t _feeder_pid;
+static gnrc_pktsnip_t *_feed[BENCH_BURST];
+static unsigned _feed_num;
+static msg_t _sink_queue[SINK_QUEUE_SIZE];
+static uint8_t _frame[sizeof(ipv6_hdr_t) + sizeof(udp_hdr_t) +
+                      ((BENCH_PAYLOAD_SIZE > BENCH_SOCK_PAYLOAD_MAX) ?
+                       BENCH_PAYLOAD_SIZE : BENCH_SOCK_PAYLOAD_MAX)];
+static size_t _frame_len;
+static volatile unsigned _received;
+static sock_udp_t _sock;
+static bool _sock_copy;
+static bool _sock_success = true;
+static volatile uint8_t _sock_sink;
+
+static void *_sink(void *arg)
+{
+    gnrc_netreg_entry_t entry = GNRC_NETREG_ENTRY_INIT_PID(BENCH_PORT,
+                                                           sched_active_pid);
+    msg_t msg;
+
+    (void)arg;
+    msg_init_queue(_sink_queue, SINK_QUEUE_SIZE);
+    gnrc_netreg_register(GNRC_NETTYPE_UDP, &entry);
+
+    while (1) {
+        msg_receive(&msg);
+        if (msg.type == GNRC_NETAPI_MSG_TYPE_RCV) {
+            _received++;
+            gnrc_pktbuf_release(msg.content.ptr);
+        }
+    }
+
+    return NULL;
+}
+
+/* dispatches a burst with a higher priority than the IPv6 thread has, so the
+ * packets pile up in its message queue */
+static void *_feeder(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        thread_sleep();
+        for (unsigned i = 0; i < _feed_num; i++) {
+            gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                         GNRC_NETREG_DEMUX_CTX_ALL, _feed[i]);
+        }
+    }
+
+    return NULL;
+}
+
+static int _build_frame(size_t payload_len, uint16_t port)
+{
+    gnrc_pktsnip_t *payload, *udp, *ipv6;
+    size_t offset = 0;
+
+    payload = gnrc_pktbuf_add(NULL, NULL, payload_len, GNRC_NETTYPE_UNDEF);
+    if (payload == NULL) {
+        return -1;
+    }
+    memset(payload->data, 0xa5, payload->size);
+    udp = gnrc_udp_hdr_build(payload, port, port);
+    if (udp == NULL) {
+        gnrc_pktbuf_release(payload);
+        return -1;
+    }
+    ipv6 = gnrc_ipv6_hdr_build(udp, &ipv6_addr_loopback, &ipv6_addr_loopback);
+    if (ipv6 == NULL) {
+        gnrc_pktbuf_release(udp);
+        return -1;
+    }
+    ((udp_hdr_t *)udp->data)->length = byteorder_htons(gnrc_pkt_len(udp));
+    ((ipv6_hdr_t *)ipv6->data)->len = byteorder_htons(gnrc_pkt_len(udp));
+    ((ipv6_hdr_t *)ipv6->data)->nh = PROTNUM_UDP;
+    ((ipv6_hdr_t *)ipv6->data)->hl = 64;
+    if (gnrc_udp_calc_csum(udp, ipv6) < 0) {
+        gnrc_pktbuf_release(ipv6);
+        return -1;
+    }
+    /* flatten the packet as a network interface would have received it */
+    for (gnrc_pktsnip_t *snip = ipv6; snip != NULL; snip = snip->next) {
+        memcpy(&_frame[offset], snip->data, snip->size);
+        offset += snip->size;
+    }
+    _frame_len = offset;
+    gnrc_pktbuf_release(ipv6);
+    return 0;
+}
+
+static unsigned _alloc_burst(gnrc_pktsnip_t **pkts)
+{
+    unsigned i;
+
+    for (i = 0; i < BENCH_BURST; i++) {
+        pkts[i] = gnrc_pktbuf_add(NULL, _frame, _frame_len,
+                                  GNRC_NETTYPE_IPV6);
+        if (pkts[i] == NULL) {
+            break;
+        }
+    }
+    return i;
+}
+
+enum {
+    MODE_SINGLE,
+    MODE_BATCH,
+    MODE_QUEUED,
+};
+
+static bool _bench(const char *name, unsigned mode)
+{
+    gnrc_pktsnip_t *pkts[BENCH_BURST];
+    unsigned sent = 0;
+
+    _received = 0;
+    uint32_t start = xtimer_now_usec();
+    while (sent < BENCH_PKTS_NUMOF) {
+        unsigned num = _alloc_burst(pkts);
+
+        if (mode == MODE_BATCH) {
+            gnrc_netapi_dispatch_receive_batch(GNRC_NETTYPE_IPV6,
+                                               GNRC_NETREG_DEMUX_CTX_ALL,
+                                               pkts, num);
+        }
+        else if (mode == MODE_QUEUED) {
+            memcpy(_feed, pkts, num * sizeof(pkts[0]));
+            _feed_num = num;
+            thread_wakeup(_feeder_pid);
+        }
+        else {
+            for (unsigned i = 0; i < num; i++) {
+                gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                             GNRC_NETREG_DEMUX_CTX_ALL,
+                                             pkts[i]);
+            }
+        }
+        sent += num;
+        /* the stack threads have higher priority than main, so the burst is
+         * completely handled once we get here */
+    }
+    uint32_t diff = xtimer_now_usec() - start;
+
+    printf("%s: %u/%u packets, %lu pkts/s\n", name, _received, sent,
+           (unsigned long)(((uint64_t)_received * US_PER_SEC) / diff));
+    return (_received == sent);
+}
+
+/* the stack threads have higher priority, so the packets are waiting in the
+ * mbox of the sock when this returns */
+static unsigned _sock_inject_burst(void)
+{
+    unsigned i;
+
+    for (i = 0; i < BENCH_SOCK_BURST; i++) {
+        gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, _frame, _frame_len,
+                                              GNRC_NETTYPE_IPV6);
+
+        if (pkt == NULL) {
+            break;
+        }
+        gnrc_netapi_dispatch_receive(GNRC_NETTYPE_IPV6,
+                                     GNRC_NETREG_DEMUX_CTX_ALL, pkt);
+    }
+    return i;
+}
+
+static unsigned _sock_drain_copy(size_t payload_len)
+{
+    uint8_t buf[BENCH_SOCK_PAYLOAD_MAX];
+    unsigned num = 0;
+    ssize_t res;
+
+    while ((res = sock_udp_recv(&_sock, buf, sizeof(buf), 0, NULL)) >= 0) {
+        if ((size_t)res == payload_len) {
+            _sock_sink ^= buf[0] ^ buf[res - 1];
+            num++;
+        }
+    }
+    return num;
+}
+
+static unsigned _sock_drain_buf(size_t payload_len)
+{
+    void *data, *ctx = NULL;
+    unsigned num = 0;
+    ssize_t res;
+
+    while ((res = sock_udp_recv_buf(&_sock, &data, &ctx, 0, NULL)) >= 0) {
+        if ((size_t)res == payload_len) {
+            _sock_sink ^= ((uint8_t *)data)[0] ^ ((uint8_t *)data)[res - 1];
+            num++;
+        }
+    }
+    return num;
+}
+
+static void *_sock_bench(void *arg)
+{
+    const char *name = _sock_copy ? "recv" : "recv_buf";
+
+    (void)arg;
+    for (unsigned s = 0; s < SOCK_SIZES_NUMOF; s++) {
+        unsigned sent = 0, received = 0;
+        uint32_t diff = 0;
+
+        if (_build_frame(_sock_sizes[s], BENCH_SOCK_PORT) < 0) {
+            puts("FAILED: unable to build frame");
+            _sock_success = false;
+            return NULL;
+        }
+#ifdef DEVELHELP
+        gnrc_pktbuf_max_used_reset();
+#endif
+        while (sent < BENCH_SOCK_PKTS_NUMOF) {
+            sent += _sock_inject_burst();
+
+            uint32_t start = xtimer_now_usec();
+            received += _sock_copy ? _sock_drain_copy(_sock_sizes[s])
+                                   : _sock_drain_buf(_sock_sizes[s]);
+            diff += xtimer_now_usec() - start;
+        }
+        printf("%s: payload: %u byte, %u/%u packets, %lu pkts/s\n",
+               name, _sock_sizes[s], received, sent,
+               (unsigned long)(((uint64_t)received * US_PER_SEC) /
+                               (diff ? diff : 1)));
+#ifdef DEVELHELP
+        printf("%s: payload: %u byte, packet buffer max. used: %u byte\n",
+               name, _sock_sizes[s], (unsigned)gnrc_pktbuf_max_used());
+#endif
+        _sock_success &= (received == sent);
+    }
+    return NULL;
+}
+
+static bool _bench_sock(bool copy)
+{
+    _sock_copy = copy;
+    /* runs to completion as its priority is higher than main's */
+    thread_create(_sock_stack, sizeof(_sock_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sock_bench, NULL, "sock_bench");
+    printf("%s: stack used: %u byte\n", copy ? "recv" : "recv_buf",
+           (unsigned)(sizeof(_sock_stack) -
+                      thread_measure_stack_free(_sock_stack)));
+    return _sock_success;
+}
+
+int main(void)
+{
+    sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+    puts("IPv6 -> UDP receive path benchmark");
+    printf("packets: %u, burst: %u, payload: %u byte\n", BENCH_PKTS_NUMOF,
+           BENCH_BURST, BENCH_PAYLOAD_SIZE);
+
+    if (_build_frame(BENCH_PAYLOAD_SIZE, BENCH_PORT) < 0) {
+        puts("FAILED: unable to build frame");
+        return 1;
+    }
+    thread_create(_sink_stack, sizeof(_sink_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sink, NULL, "sink");
+
+    _feeder_pid = thread_create(_feeder_stack, sizeof(_feeder_stack),
+                                GNRC_IPV6_PRIO - 1, THREAD_CREATE_STACKTEST,
+                                _feeder, NULL, "feeder");
+
+    bool success = _bench("single", MODE_SINGLE);
+    success &= _bench("batch", MODE_BATCH);
+    success &= _bench("queued", MODE_QUEUED);
+
+    printf("sock: packets: %u, burst: %u\n", BENCH_SOCK_PKTS_NUMOF,
+           BENCH_SOCK_BURST);
+    local.port = BENCH_SOCK_PORT;
+    if (sock_udp_create(&_sock, &local, NULL, 0) < 0) {
+        puts("FAILED: unable to create sock");
+        return 1;
+    }
+    success &= _bench_sock(true);
+    success &= _bench_sock(false);
+
+    puts(success ? "SUCCESS" : "FAILED: packets were lost");
+    return 0;
+}
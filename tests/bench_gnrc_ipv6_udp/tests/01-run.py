@@ -0,0 +1,32 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect(r"single: (\d+)/(\d+) packets, \d+ pkts/s")
+    assert child.match.group(1) == child.match.group(2)
+    child.expect(r"batch: (\d+)/(\d+) packets, \d+ pkts/s")
+    assert child.match.group(1) == child.match.group(2)
+    child.expect(r"queued: (\d+)/(\d+) packets, \d+ pkts/s")
+    assert child.match.group(1) == child.match.group(2)
+    for func in ("recv", "recv_buf"):
+        for size in (16, 256, 1024):
+            child.expect(r"{}: payload: {} byte, (\d+)/(\d+) packets, "
+                         r"\d+ pkts/s".format(func, size))
+            assert child.match.group(1) == child.match.group(2)
+            child.expect(r"{}: payload: {} byte, packet buffer max. used: "
+                         r"\d+ byte".format(func, size))
+        child.expect(r"{}: stack used: \d+ byte".format(func))
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,110 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the Internet checksum implementation
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "random.h"
+#include "xtimer.h"
+#include "net/inet_csum.h"
+
+#ifndef BENCH_RUNS
+#define BENCH_RUNS          (1000U)
+#endif
+
+#define BENCH_MAX_SIZE      (1280U)
+
+static uint32_t _src[(BENCH_MAX_SIZE / sizeof(uint32_t)) + 1];
+static const uint16_t _sizes[] = { 8, 40, 127, 1280 };
+static volatile uint16_t _sink;
+
+/* implementation of inet_csum_slice() this benchmark compares against */
+static uint16_t _ref_csum(uint16_t sum, const uint8_t *buf, uint16_t len)
+{
+    uint32_t csum = sum;
+
+    for (unsigned i = 0; i < (len >> 1); buf += 2, i++) {
+        csum += (uint16_t)(*buf << 8) + *(buf + 1);
+    }
+    if (len & 1) {
+        csum += (uint16_t)(*buf << 8);
+    }
+    while (csum >> 16) {
+        uint16_t carry = csum >> 16;
+        csum = (csum & 0xffff) + carry;
+    }
+    return csum;
+}
+
+static uint16_t _run_ref(const uint8_t *src, uint16_t len)
+{
+    return _ref_csum(0, src, len);
+}
+
+static uint16_t _run_csum(const uint8_t *src, uint16_t len)
+{
+    return inet_csum(0, src, len);
+}
+
+static uint16_t _bench(const char *name,
+                       uint16_t (*func)(const uint8_t *, uint16_t),
+                       const uint8_t *src, uint16_t len)
+{
+    uint16_t res = func(src, len);
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned i = 0; i < BENCH_RUNS; i++) {
+        _sink = func(src, len);
+    }
+
+    uint32_t diff = xtimer_now_usec() - start;
+
+    if (diff == 0) {
+        diff = 1;
+    }
+    printf("%18s: %5u byte: %8lu KiB/s\n", name, len,
+           (unsigned long)(((uint64_t)len * BENCH_RUNS * US_PER_SEC) /
+                           (1024LU * diff)));
+    return res;
+}
+
+int main(void)
+{
+    bool success = true;
+
+    puts("Internet checksum benchmark");
+    random_bytes((uint8_t *)_src, sizeof(_src));
+
+    for (unsigned i = 0; i < sizeof(_sizes) / sizeof(_sizes[0]); i++) {
+        /* word aligned and odd address */
+        for (unsigned offset = 0; offset < 2; offset++) {
+            const uint8_t *src = ((uint8_t *)_src) + offset;
+            uint16_t len = _sizes[i];
+            uint16_t ref;
+
+            printf("offset %u\n", offset);
+            ref = _bench("reference", _run_ref, src, len);
+            success &= (_bench("inet_csum", _run_csum, src, len) == ref);
+        }
+    }
+
+    puts(success ? "SUCCESS" : "FAILED");
+    return 0;
+}
@@ -28,8 +28,19 @@
 #define TEST_DURATION       (1000000U)
 #endif
 
+#ifndef PRODUCERS_NUMOF
+#define PRODUCERS_NUMOF     (3U)
+#endif
+
+#define QUEUE_SIZE          (8U)
+
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
+static char _producer_stacks[PRODUCERS_NUMOF][THREAD_STACKSIZE_DEFAULT];
+static char _consumer_stack[THREAD_STACKSIZE_DEFAULT];
+static msg_t _queue[QUEUE_SIZE];
+static kernel_pid_t _consumer_pid;
+static volatile uint32_t _received;
 
 static void _timer_callback(void*arg)
 {
@@ -50,6 +61,57 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+static void *_consumer(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    msg_init_queue(_queue, QUEUE_SIZE);
+    while(1) {
+        msg_receive(&test);
+        _received++;
+    }
+
+    return NULL;
+}
+
+static void *_producer(void *arg)
+{
+    (void)arg;
+    msg_t test;
+
+    /* all producers run at the priority of the consumer, so yielding lets the
+     * others fill the queue before the consumer gets to empty it */
+    while(!_flag) {
+        msg_send(&test, _consumer_pid);
+        thread_yield();
+    }
+
+    return NULL;
+}
+
+static uint32_t _multi_producer(xtimer_t *timer)
+{
+    _flag = 0;
+    _received = 0;
+    _consumer_pid = thread_create(_consumer_stack, sizeof(_consumer_stack),
+                                  (THREAD_PRIORITY_MAIN - 1),
+                                  THREAD_CREATE_STACKTEST, _consumer, NULL,
+                                  "consumer");
+    for (unsigned i = 0; i < PRODUCERS_NUMOF; i++) {
+        thread_create(_producer_stacks[i], sizeof(_producer_stacks[i]),
+                      (THREAD_PRIORITY_MAIN - 1),
+                      THREAD_CREATE_STACKTEST | THREAD_CREATE_WOUT_YIELD,
+                      _producer, NULL, "producer");
+    }
+    xtimer_set(timer, TEST_DURATION);
+    /* main only gets here again once all producers are done and the
+     * consumer waits for more */
+    thread_yield_higher();
+
+    return _received;
+}
+
 int main(void)
 {
     printf("main starting\n");
@@ -77,5 +139,8 @@ int main(void)
 
     printf("{ \"result\" : %"PRIu32" }\n", n);
 
+    n = _multi_producer(&timer);
+    printf("{ \"result_multi_producer\" : %"PRIu32" }\n", n);
+
     return 0;
 }
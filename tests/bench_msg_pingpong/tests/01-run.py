@@ -13,6 +13,7 @@ from testrunner import run
 
 def testfunc(child):
     child.expect(r"{ \"result\" : \d+ }")
+    child.expect(r"{ \"result_multi_producer\" : \d+ }")
 
 
 if __name__ == "__main__":
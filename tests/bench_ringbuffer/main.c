@@ -0,0 +1,202 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Benchmark for the ringbuffer and tsrb transfer functions
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "ringbuffer.h"
+#include "tsrb.h"
+#include "xtimer.h"
+
+#ifndef BENCH_BYTES
+#define BENCH_BYTES         (256U * 1024U)
+#endif
+
+#define BENCH_BUF_SIZE      (256U)
+#define BENCH_MAX_CHUNK     (128U)
+
+static char _rb_buf[BENCH_BUF_SIZE];
+static uint8_t _tsrb_buf[BENCH_BUF_SIZE];
+static ringbuffer_t _rb;
+static tsrb_t _tsrb;
+static uint8_t _in[BENCH_MAX_CHUNK];
+static uint8_t _out[BENCH_MAX_CHUNK];
+/* the chunk sizes don't divide the buffer size, so transfers wrap around */
+static const uint16_t _chunks[] = { 1, 24, 100 };
+
+/* implementation of ringbuffer_add() this benchmark compares against */
+static unsigned _ref_rb_add(ringbuffer_t *rb, const char *buf, unsigned n)
+{
+    unsigned i;
+    for (i = 0; i < n; i++) {
+        if (ringbuffer_full(rb)) {
+            break;
+        }
+        unsigned pos = rb->start + rb->avail++;
+        if (pos >= rb->size) {
+            pos -= rb->size;
+        }
+        rb->buf[pos] = buf[i];
+    }
+    return i;
+}
+
+/* implementations of tsrb_add() and tsrb_get() this benchmark compares
+ * against */
+static int _ref_tsrb_add(tsrb_t *rb, const uint8_t *src, size_t n)
+{
+    size_t tmp = n;
+    while (tmp && !tsrb_full(rb)) {
+        rb->buf[rb->writes++ & (rb->size - 1)] = *src++;
+        tmp--;
+    }
+    return (n - tmp);
+}
+
+static int _ref_tsrb_get(tsrb_t *rb, uint8_t *dst, size_t n)
+{
+    size_t tmp = n;
+    while (tmp && !tsrb_empty(rb)) {
+        *dst++ = rb->buf[rb->reads++ & (rb->size - 1)];
+        tmp--;
+    }
+    return (n - tmp);
+}
+
+static void _run_rb_ref(unsigned len)
+{
+    _ref_rb_add(&_rb, (char *)_in, len);
+    ringbuffer_get(&_rb, (char *)_out, len);
+}
+
+static void _run_rb(unsigned len)
+{
+    ringbuffer_add(&_rb, (char *)_in, len);
+    ringbuffer_get(&_rb, (char *)_out, len);
+}
+
+static void _run_rb_zero_copy(unsigned len)
+{
+    unsigned done = 0;
+    char *region;
+
+    while (done < len) {
+        unsigned n = ringbuffer_reserve(&_rb, &region);
+
+        n = (n < (len - done)) ? n : (len - done);
+        memcpy(region, &_in[done], n);
+        ringbuffer_commit(&_rb, n);
+        done += n;
+    }
+    for (done = 0; done < len;) {
+        unsigned n = ringbuffer_peek_region(&_rb, &region);
+
+        n = (n < (len - done)) ? n : (len - done);
+        memcpy(&_out[done], region, n);
+        ringbuffer_remove(&_rb, n);
+        done += n;
+    }
+}
+
+static void _run_tsrb_ref(unsigned len)
+{
+    _ref_tsrb_add(&_tsrb, _in, len);
+    _ref_tsrb_get(&_tsrb, _out, len);
+}
+
+static void _run_tsrb(unsigned len)
+{
+    tsrb_add(&_tsrb, _in, len);
+    tsrb_get(&_tsrb, _out, len);
+}
+
+static void _run_tsrb_zero_copy(unsigned len)
+{
+    unsigned done = 0;
+    uint8_t *region;
+
+    while (done < len) {
+        unsigned n = tsrb_reserve(&_tsrb, &region);
+
+        n = (n < (len - done)) ? n : (len - done);
+        memcpy(region, &_in[done], n);
+        tsrb_commit(&_tsrb, n);
+        done += n;
+    }
+    for (done = 0; done < len;) {
+        unsigned n = tsrb_peek_region(&_tsrb, &region);
+
+        n = (n < (len - done)) ? n : (len - done);
+        memcpy(&_out[done], region, n);
+        tsrb_drop(&_tsrb, n);
+        done += n;
+    }
+}
+
+static bool _bench(const char *name, void (*func)(unsigned), unsigned len)
+{
+    bool success = true;
+    uint32_t start = xtimer_now_usec();
+
+    for (unsigned bytes = 0; bytes < BENCH_BYTES; bytes += len) {
+        func(len);
+    }
+
+    uint32_t diff = xtimer_now_usec() - start;
+
+    if (diff == 0) {
+        diff = 1;
+    }
+    /* the chunk went through the buffer unchanged */
+    success &= (memcmp(_in, _out, len) == 0);
+    success &= ringbuffer_empty(&_rb) && tsrb_empty(&_tsrb);
+    printf("%18s: %4u byte chunks: %8lu KiB/s\n", name, len,
+           (unsigned long)(((uint64_t)BENCH_BYTES * US_PER_SEC) /
+                           (1024LU * diff)));
+    memset(_out, 0, sizeof(_out));
+    return success;
+}
+
+int main(void)
+{
+    bool success = true;
+
+    puts("ringbuffer and tsrb benchmark");
+    for (unsigned i = 0; i < sizeof(_in); i++) {
+        _in[i] = i + 1;
+    }
+    ringbuffer_init(&_rb, _rb_buf, sizeof(_rb_buf));
+    tsrb_init(&_tsrb, _tsrb_buf, sizeof(_tsrb_buf));
+
+    for (unsigned i = 0; i < sizeof(_chunks) / sizeof(_chunks[0]); i++) {
+        unsigned len = _chunks[i];
+
+        success &= _bench("ringbuffer ref", _run_rb_ref, len);
+        success &= _bench("ringbuffer", _run_rb, len);
+        success &= _bench("ringbuffer 0-copy", _run_rb_zero_copy, len);
+        success &= _bench("tsrb ref", _run_tsrb_ref, len);
+        success &= _bench("tsrb", _run_tsrb, len);
+        success &= _bench("tsrb 0-copy", _run_tsrb_zero_copy, len);
+    }
+
+    puts(success ? "SUCCESS" : "FAILED");
+    return 0;
+}
@@ -30,6 +30,11 @@
 volatile unsigned _flag = 0;
 static char _stack[THREAD_STACKSIZE_MAIN];
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+static char _busy_stacks[2][THREAD_STACKSIZE_DEFAULT];
+static volatile uint32_t _busy_count[2];
+#endif
+
 static void _timer_callback(void*arg)
 {
     (void)arg;
@@ -48,6 +53,20 @@ static void *_second_thread(void *arg)
     return NULL;
 }
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+static void *_busy_thread(void *arg)
+{
+    volatile uint32_t *count = arg;
+
+    /* never yields, so only time slicing lets the other busy thread run */
+    while(!_flag) {
+        (*count)++;
+    }
+
+    return NULL;
+}
+#endif
+
 int main(void)
 {
     printf("main starting\n");
@@ -73,5 +92,20 @@ int main(void)
 
     printf("{ \"result\" : %"PRIu32" }\n", n);
 
+#ifdef MODULE_SCHED_ROUND_ROBIN
+    _flag = 0;
+    for (unsigned i = 0; i < 2; i++) {
+        thread_create(_busy_stacks[i], sizeof(_busy_stacks[i]),
+                      THREAD_PRIORITY_MAIN - 1,
+                      THREAD_CREATE_STACKTEST | THREAD_CREATE_WOUT_YIELD,
+                      _busy_thread, (void *)&_busy_count[i], "busy");
+    }
+    xtimer_set(&timer, TEST_DURATION);
+    /* main gets back here when both busy threads are done */
+    thread_yield_higher();
+    printf("{ \"busy\" : [ %"PRIu32", %"PRIu32" ] }\n", _busy_count[0],
+           _busy_count[1]);
+#endif
+
     return 0;
 }
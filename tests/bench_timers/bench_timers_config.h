@@ -95,6 +95,18 @@ extern "C" {
 #define TIM_TEST_TO_REF(x) (x)
 #endif
 
+/* Maximum number of concurrently active timers used for measuring the cost of
+ * xtimer_set/xtimer_remove, set to 0 to skip the measurement */
+/* Reduce this if RAM usage is too high */
+#ifndef TEST_XTIMER_SCALE_MAX
+#define TEST_XTIMER_SCALE_MAX 256
+#endif
+
+/* Number of set/remove operations measured per number of active timers */
+#ifndef TEST_XTIMER_SCALE_ITERATIONS
+#define TEST_XTIMER_SCALE_ITERATIONS 256
+#endif
+
 /* Longest timer timeout tested (TUT ticks)*/
 /* Reduce this if RAM usage is too high */
 #ifndef TEST_MAX
@@ -447,6 +447,55 @@ static void run_test(test_ctx_t *ctx, uint32_t interval, unsigned int variant)
     xtimer_remove(&xt_parallel);
     xtimer_remove(&xt);
 }
+
+#if TEST_XTIMER_SCALE_MAX
+/* Background timers for measuring the set/remove cost vs. active timers */
+static xtimer_t scale_timers[TEST_XTIMER_SCALE_MAX];
+
+static void bench_set_remove(void)
+{
+    xtimer_t probe = { .target = 0, .long_target = 0, .callback = nop };
+
+    print_str("xtimer_set/xtimer_remove cost (reference ticks per call):\n");
+    print_str("active    set       remove\n");
+    for (unsigned int active = 1; active <= TEST_XTIMER_SCALE_MAX; active <<= 1) {
+        uint32_t set_ticks = 0;
+        uint32_t remove_ticks = 0;
+        /* arm background timers with random targets far in the future, so
+         * that none of them fires during the measurement */
+        for (unsigned int k = 0; k < active; ++k) {
+            scale_timers[k].callback = nop;
+            _xtimer_set(&scale_timers[k],
+                        random_uint32_range(TIM_TEST_FREQ, TIM_TEST_FREQ * 4));
+        }
+        for (unsigned int k = 0; k < TEST_XTIMER_SCALE_ITERATIONS; ++k) {
+            uint32_t offset = random_uint32_range(TIM_TEST_FREQ, TIM_TEST_FREQ * 4);
+            uint32_t begin = timer_read(TIM_REF_DEV);
+            _xtimer_set(&probe, offset);
+            uint32_t middle = timer_read(TIM_REF_DEV);
+            xtimer_remove(&probe);
+            uint32_t end = timer_read(TIM_REF_DEV);
+            set_ticks += middle - begin;
+            remove_ticks += end - middle;
+        }
+        for (unsigned int k = 0; k < active; ++k) {
+            xtimer_remove(&scale_timers[k]);
+        }
+        print_u32_dec(active);
+        print_str("\t  ");
+        print_u32_dec(set_ticks / TEST_XTIMER_SCALE_ITERATIONS);
+        print_str(".");
+        print_u32_dec(((set_ticks % TEST_XTIMER_SCALE_ITERATIONS) * 10) /
+                      TEST_XTIMER_SCALE_ITERATIONS);
+        print_str("\t    ");
+        print_u32_dec(remove_ticks / TEST_XTIMER_SCALE_ITERATIONS);
+        print_str(".");
+        print_u32_dec(((remove_ticks % TEST_XTIMER_SCALE_ITERATIONS) * 10) /
+                      TEST_XTIMER_SCALE_ITERATIONS);
+        print("\n", 1);
+    }
+}
+#endif /* TEST_XTIMER_SCALE_MAX */
 #else /* TEST_XTIMER */
 static void run_test(test_ctx_t *ctx, uint32_t interval, unsigned int variant)
 {
@@ -737,6 +786,9 @@ int main(void)
     print_u32_dec(spin_max);
     print("\n", 1);
     estimate_cpu_overhead();
+#if TEST_XTIMER && TEST_XTIMER_SCALE_MAX
+    bench_set_remove();
+#endif
 #ifdef MODULE_PERIPH_RTT
     rtt_begin = rtt_get_counter();
 #endif
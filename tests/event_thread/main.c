@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the shared event thread and periodic
+ *              events
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include "event/periodic.h"
+#include "event/thread.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define PERIODIC_COUNT      (5U)
+#define PERIODIC_INTERVAL   (10U * US_PER_MS)
+
+static unsigned _order[EVENT_QUEUE_PRIO_NUMOF];
+static unsigned _order_idx;
+static volatile unsigned _periodic_count;
+static uint32_t _periodic_last;
+static volatile uint32_t _periodic_max_jitter;
+
+static void _prio_handler(event_t *event);
+static void _start_handler(event_t *event);
+static void _periodic_handler(event_t *event);
+
+static event_t _events[EVENT_QUEUE_PRIO_NUMOF] = {
+    { .handler = _prio_handler },
+    { .handler = _prio_handler },
+    { .handler = _prio_handler },
+};
+static event_t _start = { .handler = _start_handler };
+static event_t _periodic = { .handler = _periodic_handler };
+
+static void _prio_handler(event_t *event)
+{
+    _order[_order_idx++] = event - _events;
+}
+
+/* posts events in reverse priority order, they are handled once this handler
+ * returns */
+static void _start_handler(event_t *event)
+{
+    (void)event;
+    event_post(EVENT_PRIO_LOWEST, &_events[EVENT_QUEUE_PRIO_LOWEST]);
+    event_post(EVENT_PRIO_MEDIUM, &_events[EVENT_QUEUE_PRIO_MEDIUM]);
+    event_post(EVENT_PRIO_HIGHEST, &_events[EVENT_QUEUE_PRIO_HIGHEST]);
+}
+
+static void _periodic_handler(event_t *event)
+{
+    uint32_t now = xtimer_now_usec();
+
+    (void)event;
+    if (_periodic_count > 0) {
+        uint32_t diff = now - _periodic_last;
+        uint32_t jitter = (diff > PERIODIC_INTERVAL) ? diff - PERIODIC_INTERVAL
+                                                     : PERIODIC_INTERVAL - diff;
+
+        if (jitter > _periodic_max_jitter) {
+            _periodic_max_jitter = jitter;
+        }
+    }
+    _periodic_last = now;
+    _periodic_count++;
+}
+
+#ifdef DEVELHELP
+/* the handlers of all services posting to the event thread share its stack */
+static void _print_stack_usage(void)
+{
+    for (kernel_pid_t pid = KERNEL_PID_FIRST; pid <= KERNEL_PID_LAST; pid++) {
+        const thread_t *thread = (const thread_t *)thread_get(pid);
+
+        if ((thread != NULL) && (strcmp(thread->name, "event") == 0)) {
+            unsigned used = thread->stack_size -
+                            thread_measure_stack_free(thread->stack_start);
+
+            printf("event thread: %u of %u bytes stack used\n", used,
+                   (unsigned)thread->stack_size);
+        }
+    }
+}
+#endif
+
+int main(void)
+{
+    event_periodic_t periodic;
+    bool success = true;
+
+    puts("event_thread test");
+
+    event_post(EVENT_PRIO_LOWEST, &_start);
+    printf("handling order:");
+    for (unsigned i = 0; i < _order_idx; i++) {
+        printf(" %u", _order[i]);
+        success &= (_order[i] == i);
+    }
+    puts("");
+    success &= (_order_idx == EVENT_QUEUE_PRIO_NUMOF);
+
+    event_periodic_init(&periodic, EVENT_PRIO_MEDIUM, &_periodic);
+    event_periodic_set_count(&periodic, PERIODIC_COUNT);
+    event_periodic_start(&periodic, PERIODIC_INTERVAL);
+    xtimer_usleep((PERIODIC_COUNT + 2) * PERIODIC_INTERVAL);
+    printf("periodic event: %u times (should be %u), max. jitter: %lu us\n",
+           _periodic_count, PERIODIC_COUNT,
+           (unsigned long)_periodic_max_jitter);
+    success &= (_periodic_count == PERIODIC_COUNT);
+
+#ifdef DEVELHELP
+    _print_stack_usage();
+#endif
+
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+    return 0;
+}
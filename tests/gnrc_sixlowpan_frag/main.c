@@ -345,6 +345,75 @@ static void test_rbuf_add__success_complete(void)
     _check_pktbuf(NULL);
 }
 
+static void test_rbuf_add__interleaved_senders(void)
+{
+    uint8_t *fragments[] = { _fragment1, _fragment2, _fragment3, _fragment4 };
+    const size_t sizes[] = { sizeof(_fragment1), sizeof(_fragment2),
+                             sizeof(_fragment3), sizeof(_fragment4) };
+    const size_t offsets[] = { TEST_FRAGMENT1_OFFSET, TEST_FRAGMENT2_OFFSET,
+                               TEST_FRAGMENT3_OFFSET, TEST_FRAGMENT4_OFFSET };
+    uint8_t src[sizeof(_test_netif_hdr_src)];
+    gnrc_netreg_entry_t reg = GNRC_NETREG_ENTRY_INIT_PID(
+            GNRC_NETREG_DEMUX_CTX_ALL,
+            sched_active_pid
+        );
+    const unsigned frags_numof = sizeof(fragments) / sizeof(fragments[0]);
+
+    memcpy(src, _test_netif_hdr_src, sizeof(src));
+    gnrc_netreg_register(TEST_DATAGRAM_NETTYPE, &reg);
+    /* several generations of datagrams to also reuse released entries */
+    for (unsigned round = 0; round < 3; round++) {
+        for (unsigned f = 0; f < frags_numof; f++) {
+            /* every sender sends its datagram in a different fragment order */
+            for (unsigned sender = 0; sender < RBUF_SIZE; sender++) {
+                unsigned idx = (f + sender) % frags_numof;
+                gnrc_pktsnip_t *pkt;
+
+                src[sizeof(src) - 1] = (uint8_t)sender;
+                gnrc_netif_hdr_set_src_addr(&_test_netif_hdr.hdr, src,
+                                            sizeof(src));
+                _set_fragment_tag(fragments[idx], TEST_TAG + round);
+                pkt = gnrc_pktbuf_add(NULL, fragments[idx], sizes[idx],
+                                      GNRC_NETTYPE_SIXLOWPAN);
+                TEST_ASSERT_NOT_NULL(pkt);
+                rbuf_add(&_test_netif_hdr.hdr, pkt, offsets[idx], TEST_PAGE);
+                if (f == (frags_numof - 1)) {
+                    msg_t msg = { .type = 0U };
+                    gnrc_pktsnip_t *datagram;
+
+                    TEST_ASSERT_MESSAGE(
+                            xtimer_msg_receive_timeout(&msg,
+                                                       TEST_RECEIVE_TIMEOUT) >= 0,
+                            "Receiving reassembled datagram timed out"
+                        );
+                    TEST_ASSERT_EQUAL_INT(GNRC_NETAPI_MSG_TYPE_RCV, msg.type);
+                    datagram = msg.content.ptr;
+                    TEST_ASSERT_NOT_NULL(datagram);
+                    TEST_ASSERT_EQUAL_INT(TEST_DATAGRAM_SIZE, datagram->size);
+                    TEST_ASSERT_MESSAGE(memcmp(_datagram, datagram->data,
+                                               TEST_DATAGRAM_SIZE) == 0,
+                                        "Reassembled datagram does not "
+                                        "contain expected data");
+                    gnrc_pktbuf_release(datagram);
+                }
+                else {
+                    /* no datagram of any sender was lost so far */
+                    unsigned in_use = 0;
+
+                    for (unsigned i = 0; i < RBUF_SIZE; i++) {
+                        in_use += !rbuf_entry_empty(&rbuf_array()[i]);
+                    }
+                    TEST_ASSERT_EQUAL_INT((f == 0) ? sender + 1 : RBUF_SIZE,
+                                          in_use);
+                }
+            }
+        }
+    }
+    gnrc_netreg_unregister(TEST_DATAGRAM_NETTYPE, &reg);
+    TEST_ASSERT_NULL(_first_non_empty_rbuf());
+    _check_pktbuf(NULL);
+}
+
 static void test_rbuf_add__full_rbuf(void)
 {
     gnrc_pktsnip_t *pkt;
@@ -552,6 +621,7 @@ static void run_unittests(void)
         new_TestFixture(test_rbuf_add__success_subsequent_fragment),
         new_TestFixture(test_rbuf_add__success_duplicate_fragments),
         new_TestFixture(test_rbuf_add__success_complete),
+        new_TestFixture(test_rbuf_add__interleaved_senders),
         new_TestFixture(test_rbuf_add__full_rbuf),
         new_TestFixture(test_rbuf_add__too_big_fragment),
         new_TestFixture(test_rbuf_add__overlap_lhs),
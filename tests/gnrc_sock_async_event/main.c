@@ -0,0 +1,128 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for serving several UDP socks from one
+ *              event queue
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "event.h"
+#include "mutex.h"
+#include "net/ipv6/addr.h"
+#include "net/sock/udp.h"
+#include "net/sock/async/event.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#define SOCK_NUMOF          (2U)
+/* messages per sock, must not exceed SOCK_MBOX_SIZE */
+#define MSG_NUMOF           (4U)
+#define PORT_BASE           (61616U)
+#define TIMEOUT             (1U * US_PER_SEC)
+
+static event_queue_t _queue;
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sock_udp_t _socks[SOCK_NUMOF];
+static unsigned _received[SOCK_NUMOF];
+static unsigned _handler_calls[SOCK_NUMOF];
+static mutex_t _done = MUTEX_INIT_LOCKED;
+
+static void _handler(sock_udp_t *sock, sock_async_flags_t flags)
+{
+    unsigned idx = sock - _socks;
+    unsigned received = 0;
+
+    _handler_calls[idx]++;
+    if (flags & SOCK_ASYNC_MSG_RECV) {
+        uint8_t data;
+
+        while (sock_udp_recv(sock, &data, sizeof(data), 0, NULL) > 0) {
+            if (data == idx) {
+                _received[idx]++;
+            }
+        }
+    }
+    for (unsigned i = 0; i < SOCK_NUMOF; i++) {
+        received += _received[i];
+    }
+    if (received == (SOCK_NUMOF * MSG_NUMOF)) {
+        mutex_unlock(&_done);
+    }
+}
+
+static void *_event_loop(void *arg)
+{
+    (void)arg;
+    event_queue_claim(&_queue);
+    event_loop(&_queue);
+    return NULL;
+}
+
+int main(void)
+{
+    sock_udp_ep_t remote = SOCK_IPV6_EP_ANY;
+    bool success = true;
+
+    puts("gnrc_sock_async_event test");
+
+    /* the thread serving the queue has a lower priority than main, so all
+     * messages are queued in the socks before it handles their events */
+    event_queue_init_detached(&_queue);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN + 1,
+                  THREAD_CREATE_STACKTEST, _event_loop, NULL, "sock_event");
+
+    for (unsigned i = 0; i < SOCK_NUMOF; i++) {
+        sock_udp_ep_t local = SOCK_IPV6_EP_ANY;
+
+        local.port = PORT_BASE + i;
+        if (sock_udp_create(&_socks[i], &local, NULL, 0) < 0) {
+            puts("[FAILED] unable to create sock");
+            return 1;
+        }
+        sock_udp_event_init(&_socks[i], &_queue, _handler);
+    }
+
+    /* interleave the messages to both socks */
+    ipv6_addr_set_loopback((ipv6_addr_t *)&remote.addr.ipv6);
+    for (unsigned n = 0; n < MSG_NUMOF; n++) {
+        for (unsigned i = 0; i < SOCK_NUMOF; i++) {
+            uint8_t data = i;
+
+            remote.port = PORT_BASE + i;
+            if (sock_udp_send(NULL, &data, sizeof(data), &remote) < 0) {
+                puts("[FAILED] unable to send");
+                return 1;
+            }
+        }
+    }
+
+    if (xtimer_mutex_lock_timeout(&_done, TIMEOUT) < 0) {
+        puts("timed out");
+        success = false;
+    }
+    for (unsigned i = 0; i < SOCK_NUMOF; i++) {
+        printf("sock %u: received %u of %u messages in %u handler calls\n",
+               i, _received[i], MSG_NUMOF, _handler_calls[i]);
+        success &= (_received[i] == MSG_NUMOF);
+    }
+
+    puts(success ? "[SUCCESS]" : "[FAILED]");
+    return 0;
+}
@@ -23,6 +23,9 @@
 #include <stdio.h>
 
 #include "net/sock/udp.h"
+#ifdef MODULE_SOCK_ASYNC
+#include "net/sock/async.h"
+#endif
 #include "xtimer.h"
 
 #include "constants.h"
@@ -32,6 +35,15 @@
 
 static uint8_t _test_buffer[_TEST_BUFFER_SIZE];
 static sock_udp_t _sock, _sock2;
+#ifdef MODULE_SOCK_ASYNC
+static sock_async_flags_t _async_flags;
+
+static void _async_cb(sock_udp_t *sock, sock_async_flags_t flags)
+{
+    assert(sock == &_sock);
+    _async_flags |= flags;
+}
+#endif
 
 #define CALL(fn)            puts("Calling " # fn); fn; tear_down()
 
@@ -421,6 +433,54 @@ static void test_sock_udp_recv__non_blocking(void)
     assert(_check_net());
 }
 
+static void test_sock_udp_recv_buf(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+    sock_udp_ep_t result;
+    void *data = NULL, *ctx = NULL;
+
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    assert(sizeof("ABCD") == sock_udp_recv_buf(&_sock, &data, &ctx,
+                                               SOCK_NO_TIMEOUT, &result));
+    assert((data != NULL) && (ctx != NULL));
+    assert(memcmp(data, "ABCD", sizeof("ABCD")) == 0);
+    assert(AF_INET6 == result.family);
+    assert(memcmp(&result.addr, &src_addr, sizeof(result.addr)) == 0);
+    assert(_TEST_PORT_REMOTE == result.port);
+    assert(0 == sock_udp_recv_buf(&_sock, &data, &ctx, 0, NULL));
+    assert((data == NULL) && (ctx == NULL));
+    assert(_check_net());
+}
+
+#ifdef MODULE_SOCK_ASYNC
+static void test_sock_udp_recv__async(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const sock_udp_ep_t local = { .family = AF_INET6,
+                                         .port = _TEST_PORT_LOCAL };
+
+    _async_flags = 0;
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    sock_udp_set_cb(&_sock, _async_cb);
+    assert(_inject_packet(&src_addr, &dst_addr, _TEST_PORT_REMOTE,
+                          _TEST_PORT_LOCAL, "ABCD", sizeof("ABCD"),
+                          _TEST_NETIF));
+    assert(_async_flags == SOCK_ASYNC_MSG_RECV);
+    assert(sizeof("ABCD") == sock_udp_recv(&_sock, _test_buffer,
+                                           sizeof(_test_buffer), 0, NULL));
+    assert(-EAGAIN == sock_udp_recv(&_sock, _test_buffer,
+                                    sizeof(_test_buffer), 0, NULL));
+    assert(_check_net());
+}
+#endif
+
 static void test_sock_udp_send__EAFNOSUPPORT(void)
 {
     static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
@@ -693,6 +753,33 @@ static void test_sock_udp_send__no_sock(void)
     assert(_check_net());
 }
 
+#ifdef MODULE_SOCK_ASYNC
+static void test_sock_udp_send__async(void)
+{
+    static const ipv6_addr_t src_addr = { .u8 = _TEST_ADDR_LOCAL };
+    static const ipv6_addr_t dst_addr = { .u8 = _TEST_ADDR_REMOTE };
+    static const sock_udp_ep_t local = { .addr = { .ipv6 = _TEST_ADDR_LOCAL },
+                                         .family = AF_INET6,
+                                         .netif = _TEST_NETIF,
+                                         .port = _TEST_PORT_LOCAL };
+    static const sock_udp_ep_t remote = { .addr = { .ipv6 = _TEST_ADDR_REMOTE },
+                                          .family = AF_INET6,
+                                          .port = _TEST_PORT_REMOTE };
+
+    _async_flags = 0;
+    assert(0 == sock_udp_create(&_sock, &local, NULL, SOCK_FLAGS_REUSE_EP));
+    sock_udp_set_cb(&_sock, _async_cb);
+    assert(sizeof("ABCD") == sock_udp_send(&_sock, "ABCD", sizeof("ABCD"),
+                                           &remote));
+    assert(_async_flags == SOCK_ASYNC_MSG_SENT);
+    assert(_check_packet(&src_addr, &dst_addr, _TEST_PORT_LOCAL,
+                         _TEST_PORT_REMOTE, "ABCD", sizeof("ABCD"),
+                         _TEST_NETIF, false));
+    xtimer_usleep(1000);    /* let GNRC stack finish */
+    assert(_check_net());
+}
+#endif
+
 int main(void)
 {
     _net_init();
@@ -724,6 +811,10 @@ int main(void)
     CALL(test_sock_udp_recv__unsocketed_with_remote());
     CALL(test_sock_udp_recv__with_timeout());
     CALL(test_sock_udp_recv__non_blocking());
+    CALL(test_sock_udp_recv_buf());
+#ifdef MODULE_SOCK_ASYNC
+    CALL(test_sock_udp_recv__async());
+#endif
     _prepare_send_checks();
     CALL(test_sock_udp_send__EAFNOSUPPORT());
     CALL(test_sock_udp_send__EINVAL_addr());
@@ -741,6 +832,9 @@ int main(void)
     CALL(test_sock_udp_send__unsocketed());
     CALL(test_sock_udp_send__no_sock_no_netif());
     CALL(test_sock_udp_send__no_sock());
+#ifdef MODULE_SOCK_ASYNC
+    CALL(test_sock_udp_send__async());
+#endif
 
     puts("ALL TESTS SUCCESSFUL");
 
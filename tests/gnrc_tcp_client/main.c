@@ -13,6 +13,7 @@
 #include "net/gnrc/ipv6.h"
 #include "net/gnrc/netif.h"
 #include "net/gnrc/tcp.h"
+#include "xtimer.h"
 
 #define ENABLE_DEBUG (0)
 #include "debug.h"
@@ -80,6 +81,7 @@ void *cli_thread(void *arg)
     uint32_t cycles = 0;
     uint32_t cycles_ok = 0;
     uint32_t failed_payload_verifications = 0;
+    uint32_t start = 0;
 
     /* Transmission control block */
     gnrc_tcp_tcb_t tcb;
@@ -143,6 +145,9 @@ void *cli_thread(void *arg)
             bufs[tid][i] = TEST_PATERN_CLI;
         }
 
+        /* Measure duration of data exchange */
+        start = xtimer_now_usec();
+
         /* Send data, stop if errors were found */
         for (size_t sent = 0; sent < sizeof(bufs[tid]) && ret >= 0; sent += ret) {
             ret = gnrc_tcp_send(&tcb, bufs[tid] + sent, sizeof(bufs[tid]) - sent, 0);
@@ -212,6 +217,16 @@ void *cli_thread(void *arg)
               }
         }
 
+        /* Report throughput: NBYTE sent and NBYTE received */
+        if (ret >= 0) {
+            uint32_t duration = xtimer_now_usec() - start;
+            printf("TID=%d : %u bytes exchanged in %"PRIu32" us, %"PRIu32" bytes/s\n", tid,
+                   (unsigned) (2 * NBYTE), duration,
+                   (uint32_t) (((uint64_t) 2 * NBYTE * US_PER_SEC) / (duration ? duration : 1)));
+            printf("TID=%d : %"PRIu32" segments (%"PRIu32" bytes) retransmitted\n", tid,
+                   tcb.retransmits, tcb.rtx_bytes);
+        }
+
         /* If there was no error: Check received pattern */
         for (size_t i = 0; i < sizeof(bufs[tid]); ++i) {
             if (bufs[tid][i] != TEST_PATERN_SRV) {
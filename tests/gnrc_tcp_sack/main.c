@@ -0,0 +1,199 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Compare GNRC TCP retransmissions with and without SACK under
+ *              deterministic packet loss
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "msg.h"
+#include "net/af.h"
+#include "net/tcp.h"
+#include "net/gnrc/pktbuf.h"
+#include "net/gnrc/tcp.h"
+#include "thread.h"
+
+#define SERVER_PORT     (80U)
+#define NBYTE           (4096U)
+/* number of the data segment of a connection that is dropped */
+#define LOSS_SEGMENT    (2U)
+#define TIMEOUT         (GNRC_TCP_CONNECTION_TIMEOUT_DURATION)
+
+#define MSK_SYN         (0x0002)
+
+static char _server_stack[THREAD_STACKSIZE_DEFAULT + THREAD_EXTRA_STACKSIZE_PRINTF];
+static kernel_pid_t _main_pid;
+
+static gnrc_tcp_tcb_t _client_tcb;
+static gnrc_tcp_tcb_t _server_tcb;
+static uint8_t _client_buf[NBYTE];
+static uint8_t _server_buf[NBYTE];
+
+static unsigned _data_segments;
+static bool _strip_sack_perm;
+
+static void _remove_sack_perm(tcp_hdr_t *hdr)
+{
+    uint8_t *opt = (uint8_t *)(hdr + 1);
+    uint8_t *end = (uint8_t *)hdr + ((byteorder_ntohs(hdr->off_ctl) >> 12) * 4);
+
+    while ((opt < end) && (*opt != TCP_OPTION_KIND_EOL)) {
+        if (*opt == TCP_OPTION_KIND_NOP) {
+            opt++;
+            continue;
+        }
+        if (((opt + 1) >= end) || (opt[1] < 2)) {
+            return;
+        }
+        if (*opt == TCP_OPTION_KIND_SACK_PERM) {
+            /* keep the header size, the checksum is calculated afterwards */
+            opt[0] = TCP_OPTION_KIND_NOP;
+            opt[1] = TCP_OPTION_KIND_NOP;
+            return;
+        }
+        opt += opt[1];
+    }
+}
+
+static bool _send_hook(gnrc_pktsnip_t *pkt)
+{
+    gnrc_pktsnip_t *tcp = gnrc_pktsnip_search_type(pkt, GNRC_NETTYPE_TCP);
+    tcp_hdr_t *hdr = tcp->data;
+
+    if (_strip_sack_perm && (byteorder_ntohs(hdr->off_ctl) & MSK_SYN)) {
+        _remove_sack_perm(hdr);
+    }
+    /* only the client sends data, retransmissions are counted as well */
+    if ((tcp->next != NULL) && (tcp->next->size > 0)) {
+        if (++_data_segments == LOSS_SEGMENT) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void *_server(void *arg)
+{
+    (void)arg;
+
+    while (1) {
+        msg_t msg;
+        size_t rcvd = 0;
+
+        gnrc_tcp_tcb_init(&_server_tcb);
+        int res = gnrc_tcp_open_passive(&_server_tcb, AF_INET6, NULL,
+                                        SERVER_PORT);
+        if (res < 0) {
+            printf("gnrc_tcp_open_passive() failed: %d\n", res);
+            msg.content.value = 0;
+            msg_send(&msg, _main_pid);
+            return NULL;
+        }
+        while (rcvd < NBYTE) {
+            ssize_t n = gnrc_tcp_recv(&_server_tcb, _server_buf + rcvd,
+                                      NBYTE - rcvd, TIMEOUT);
+            if (n < 0) {
+                printf("gnrc_tcp_recv() failed: %d\n", (int)n);
+                break;
+            }
+            rcvd += n;
+        }
+        gnrc_tcp_close(&_server_tcb);
+
+        for (unsigned i = 0; i < rcvd; i++) {
+            if (_server_buf[i] != (uint8_t)i) {
+                printf("payload mismatch at %u\n", i);
+                rcvd = 0;
+                break;
+            }
+        }
+        msg.content.value = rcvd;
+        msg_send(&msg, _main_pid);
+    }
+    return NULL;
+}
+
+static int _run(bool sack, uint32_t *rtx_bytes)
+{
+    char target_addr[] = "::1";
+    size_t sent = 0;
+    msg_t msg;
+
+    _strip_sack_perm = !sack;
+    _data_segments = 0;
+
+    gnrc_tcp_tcb_init(&_client_tcb);
+    int res = gnrc_tcp_open_active(&_client_tcb, AF_INET6, target_addr,
+                                   SERVER_PORT, 0);
+    if (res < 0) {
+        printf("gnrc_tcp_open_active() failed: %d\n", res);
+        return res;
+    }
+    while (sent < NBYTE) {
+        ssize_t n = gnrc_tcp_send(&_client_tcb, _client_buf + sent,
+                                  NBYTE - sent, TIMEOUT);
+        if (n < 0) {
+            printf("gnrc_tcp_send() failed: %d\n", (int)n);
+            gnrc_tcp_abort(&_client_tcb);
+            return n;
+        }
+        sent += n;
+    }
+    gnrc_tcp_close(&_client_tcb);
+
+    msg_receive(&msg);
+    if (msg.content.value != NBYTE) {
+        printf("server received %u of %u bytes\n",
+               (unsigned)msg.content.value, NBYTE);
+        return -1;
+    }
+    *rtx_bytes = _client_tcb.rtx_bytes;
+    printf("{ \"sack\" : %d, \"retransmits\" : %u, \"rtx_bytes\" : %u }\n",
+           sack, (unsigned)_client_tcb.retransmits, (unsigned)*rtx_bytes);
+    return 0;
+}
+
+int main(void)
+{
+    uint32_t rtx_sack;
+    uint32_t rtx_nosack;
+
+    puts("gnrc_tcp SACK loss test");
+
+    for (unsigned i = 0; i < NBYTE; i++) {
+        _client_buf[i] = (uint8_t)i;
+    }
+    _main_pid = thread_getpid();
+    gnrc_tcp_set_send_hook(_send_hook);
+    thread_create(_server_stack, sizeof(_server_stack),
+                  THREAD_PRIORITY_MAIN - 1, THREAD_CREATE_STACKTEST,
+                  _server, NULL, "server");
+
+    if ((_run(false, &rtx_nosack) < 0) || (_run(true, &rtx_sack) < 0)) {
+        puts("FAILURE");
+        return 1;
+    }
+    if ((rtx_sack == 0) || (rtx_sack >= rtx_nosack)) {
+        puts("FAILURE: SACK did not reduce the retransmitted bytes");
+        return 1;
+    }
+    gnrc_tcp_set_send_hook(NULL);
+    puts("SUCCESS");
+    return 0;
+}
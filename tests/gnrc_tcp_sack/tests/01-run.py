@@ -0,0 +1,30 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+# each run waits for a retransmission timeout and TIME_WAIT
+TIMEOUT = 30
+
+
+def testfunc(child):
+    child.expect_exact("gnrc_tcp SACK loss test")
+    child.expect(r"{ \"sack\" : 0, \"retransmits\" : \d+, "
+                 r"\"rtx_bytes\" : (\d+) }", timeout=TIMEOUT)
+    nosack = int(child.match.group(1))
+    child.expect(r"{ \"sack\" : 1, \"retransmits\" : \d+, "
+                 r"\"rtx_bytes\" : (\d+) }", timeout=TIMEOUT)
+    sack = int(child.match.group(1))
+    assert 0 < sack < nosack
+    child.expect_exact("SUCCESS")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,100 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup tests
+ * @{
+ *
+ * @file
+ * @brief   msg_receive_bulk() and mbox_get_bulk() test application
+ *
+ * @author  Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "mbox.h"
+#include "msg.h"
+#include "thread.h"
+
+#define QUEUE_SIZE      (4U)
+#define MSG_NUMOF       (6U)
+
+static char _stack[THREAD_STACKSIZE_MAIN];
+static kernel_pid_t _main_pid;
+static msg_t _queue[QUEUE_SIZE];
+static msg_t _mbox_queue[QUEUE_SIZE];
+static mbox_t _mbox;
+
+static void *_sender(void *arg)
+{
+    (void)arg;
+    msg_t msg;
+
+    /* the last messages block on the full queue of main */
+    for (unsigned i = 0; i < MSG_NUMOF; i++) {
+        msg.type = i;
+        msg_send(&msg, _main_pid);
+    }
+    for (unsigned i = 0; i < MSG_NUMOF; i++) {
+        msg.type = i;
+        mbox_put(&_mbox, &msg);
+    }
+    return NULL;
+}
+
+static unsigned _check(const msg_t *msgs, unsigned num, unsigned expected)
+{
+    for (unsigned i = 0; i < num; i++) {
+        if (msgs[i].type != expected) {
+            printf("unexpected message %u, expected %u\n",
+                   (unsigned)msgs[i].type, expected);
+            return 0;
+        }
+        expected++;
+    }
+    return num;
+}
+
+int main(void)
+{
+    msg_t msgs[MSG_NUMOF];
+    unsigned num, total = 0;
+
+    _main_pid = thread_getpid();
+    msg_init_queue(_queue, QUEUE_SIZE);
+    mbox_init(&_mbox, _mbox_queue, QUEUE_SIZE);
+    thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _sender, NULL, "sender");
+
+    /* the sender is blocked on the fifth message now */
+    num = msg_receive_bulk(msgs, 3);
+    printf("msg_receive_bulk: %u (should be 3)\n", num);
+    total += _check(msgs, num, 0);
+    /* taking messages unblocked the sender, which then blocked on the mbox */
+    num = msg_receive_bulk(msgs, MSG_NUMOF);
+    printf("msg_receive_bulk: %u (should be 3)\n", num);
+    total += _check(msgs, num, 3);
+
+    num = mbox_get_bulk(&_mbox, msgs, MSG_NUMOF);
+    printf("mbox_get_bulk: %u (should be 4)\n", num);
+    total += _check(msgs, num, 0);
+    num = mbox_get_bulk(&_mbox, msgs, MSG_NUMOF);
+    printf("mbox_get_bulk: %u (should be 2)\n", num);
+    total += _check(msgs, num, 4);
+
+    if (total == (2 * MSG_NUMOF)) {
+        puts("[SUCCESS]");
+    }
+    else {
+        puts("[FAILED]");
+    }
+    return 0;
+}
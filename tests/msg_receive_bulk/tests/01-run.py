@@ -0,0 +1,22 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def testfunc(child):
+    child.expect_exact(u"msg_receive_bulk: 3 (should be 3)")
+    child.expect_exact(u"msg_receive_bulk: 3 (should be 3)")
+    child.expect_exact(u"mbox_get_bulk: 4 (should be 4)")
+    child.expect_exact(u"mbox_get_bulk: 2 (should be 2)")
+    child.expect_exact(u"[SUCCESS]")
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,130 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for mutex priority inheritance
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "mutex.h"
+#include "thread.h"
+#include "xtimer.h"
+
+#ifndef HOLD_TIME
+#define HOLD_TIME       (100U * US_PER_MS)
+#endif
+
+#ifndef BUSY_TIME
+#define BUSY_TIME       (10U * HOLD_TIME)
+#endif
+
+#define HIGH_DELAY      (HOLD_TIME / 10)
+#define MID_DELAY       (HOLD_TIME / 5)
+
+static mutex_t _res_mtx = MUTEX_INIT;
+static mutex_t _other_mtx = MUTEX_INIT;
+static kernel_pid_t _main_pid;
+
+static char _stack_high[THREAD_STACKSIZE_DEFAULT];
+static char _stack_mid[THREAD_STACKSIZE_DEFAULT];
+static char _stack_low[THREAD_STACKSIZE_DEFAULT];
+
+/* With arg != NULL, t_low also holds _other_mtx, which it locks before and
+ * unlocks while t_high still waits for _res_mtx */
+static void *_low_handler(void *arg)
+{
+    if (arg != NULL) {
+        mutex_lock(&_other_mtx);
+    }
+    mutex_lock(&_res_mtx);
+    puts("t_low: got resource");
+    if (arg != NULL) {
+        xtimer_usleep(HOLD_TIME / 2);
+        mutex_unlock(&_other_mtx);
+        puts("t_low: freed other resource");
+        xtimer_usleep(HOLD_TIME / 2);
+    }
+    else {
+        xtimer_usleep(HOLD_TIME);
+    }
+    mutex_unlock(&_res_mtx);
+    puts("t_low: freed resource");
+    return NULL;
+}
+
+static void *_mid_handler(void *arg)
+{
+    (void)arg;
+
+    xtimer_usleep(MID_DELAY);
+    puts("t_mid: keeping the CPU busy");
+
+    uint32_t start = xtimer_now_usec();
+    while ((xtimer_now_usec() - start) < BUSY_TIME) {}
+
+    puts("t_mid: done");
+    return NULL;
+}
+
+static void *_high_handler(void *arg)
+{
+    (void)arg;
+
+    xtimer_usleep(HIGH_DELAY);
+    puts("t_high: allocating resource");
+
+    uint32_t start = xtimer_now_usec();
+    mutex_lock(&_res_mtx);
+    uint32_t blocked = xtimer_now_usec() - start;
+    mutex_unlock(&_res_mtx);
+
+    printf("t_high: blocked for %lu us (bound: %lu us)\n",
+           (unsigned long)blocked, (unsigned long)HOLD_TIME);
+    puts((blocked <= HOLD_TIME) ? "SUCCESS" : "FAILED");
+
+    msg_t msg;
+    msg_try_send(&msg, _main_pid);
+    return NULL;
+}
+
+static void _run(void *low_arg)
+{
+    msg_t msg;
+
+    thread_create(_stack_low, sizeof(_stack_low), THREAD_PRIORITY_MAIN - 1,
+                  THREAD_CREATE_STACKTEST, _low_handler, low_arg, "t_low");
+    thread_create(_stack_mid, sizeof(_stack_mid), THREAD_PRIORITY_MAIN - 2,
+                  THREAD_CREATE_STACKTEST, _mid_handler, NULL, "t_mid");
+    thread_create(_stack_high, sizeof(_stack_high), THREAD_PRIORITY_MAIN - 3,
+                  THREAD_CREATE_STACKTEST, _high_handler, NULL, "t_high");
+    /* main only runs again once all threads are done */
+    msg_receive(&msg);
+}
+
+int main(void)
+{
+    puts("Mutex priority inheritance test");
+    _main_pid = thread_getpid();
+
+    puts("one mutex");
+    _run(NULL);
+    puts("two mutexes, unlocked in non-LIFO order");
+    _run(&_other_mtx);
+
+    return 0;
+}
@@ -0,0 +1,31 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import sys
+from testrunner import run
+
+
+def _run(child, other):
+    child.expect_exact("t_low: got resource")
+    child.expect_exact("t_high: allocating resource")
+    child.expect_exact("t_mid: keeping the CPU busy")
+    if other:
+        child.expect_exact("t_low: freed other resource")
+    child.expect(r"t_high: blocked for \d+ us \(bound: \d+ us\)")
+    child.expect_exact("SUCCESS")
+
+
+def testfunc(child):
+    child.expect_exact("one mutex")
+    _run(child, False)
+    child.expect_exact("two mutexes, unlocked in non-LIFO order")
+    _run(child, True)
+
+
+if __name__ == "__main__":
+    sys.exit(run(testfunc))
@@ -0,0 +1,87 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2019 Freie Universität Berlin
+#
+# This file is subject to the terms and conditions of the GNU Lesser
+# General Public License v2.1. See the file LICENSE in the top level
+# directory for more details.
+
+import re
+import os
+import sys
+import subprocess
+import time
+
+from scapy.all import Ether, IPv6, ICMPv6EchoRequest, sendp
+from testrunner import run
+
+
+BURST = 32
+# NETDEV_TAP_RX_QUEUE_SIZE
+RX_QUEUE_SIZE = 4
+
+
+def check_and_search_output(cmd, pattern, res_group, *args, **kwargs):
+    output = subprocess.check_output(cmd, *args, **kwargs).decode("utf-8")
+    for line in output.splitlines():
+        m = re.search(pattern, line)
+        if m is not None:
+            return m.group(res_group)
+    return None
+
+
+def get_bridge(tap):
+    res = check_and_search_output(
+            ["bridge", "link"],
+            r"{}.+master\s+(?P<master>[^\s]+)".format(tap),
+            "master"
+        )
+    return tap if res is None else res
+
+
+def expect_rx_stats(child):
+    child.expect(r"RX wakeups (?P<wakeups>\d+)  frames (?P<frames>\d+)  "
+                 r"max. frames per wakeup (?P<max_batch>\d+)")
+    return (int(child.match.group("wakeups")),
+            int(child.match.group("frames")),
+            int(child.match.group("max_batch")))
+
+
+def testfunc(child):
+    tap = get_bridge(os.environ["TAP"])
+
+    child.sendline("ifconfig")
+    child.expect("HWaddr: (?P<hwaddr>[A-Fa-f:0-9]+)")
+    hwaddr_dst = child.match.group("hwaddr").lower()
+    child.expect("(?P<lladdr>fe80::[A-Fa-f:0-9]+)")
+    lladdr_dst = child.match.group("lladdr").lower()
+    wakeups_before, frames_before, _ = expect_rx_stats(child)
+
+    sendp([Ether(dst=hwaddr_dst) / IPv6(dst=lladdr_dst) /
+           ICMPv6EchoRequest(seq=i) for i in range(BURST)],
+          iface=tap, verbose=0)
+    # give RIOT some time to handle the burst
+    for _ in range(10):
+        time.sleep(0.1)
+        child.sendline("ifconfig")
+        wakeups, frames, max_batch = expect_rx_stats(child)
+        wakeups -= wakeups_before
+        frames -= frames_before
+        if frames >= BURST:
+            break
+
+    # other traffic on the TAP (e.g. neighbor discovery) is counted as well
+    assert frames >= BURST
+    assert 0 < wakeups <= frames
+    assert 1 <= max_batch <= RX_QUEUE_SIZE
+    print("{:.2f} frames per wakeup".format(frames / wakeups))
+    print("SUCCESS")
+
+
+if __name__ == "__main__":
+    if os.geteuid() != 0:
+        print("\x1b[1;31mThis test requires root privileges.\n"
+              "It's constructing and sending Ethernet frames.\x1b[0m\n",
+              file=sys.stderr)
+        sys.exit(1)
+    sys.exit(run(testfunc, timeout=1, echo=False))
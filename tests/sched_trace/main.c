@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @ingroup     tests
+ * @{
+ *
+ * @file
+ * @brief       Test application for the scheduler trace
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ *
+ * @}
+ */
+
+#include <stdio.h>
+
+#include "msg.h"
+#include "sched_trace.h"
+#include "thread.h"
+
+#define TEST_MSG_TYPE       (0x1234)
+#define TEST_ENTRIES_NUMOF  (32U)
+
+static char _stack[THREAD_STACKSIZE_DEFAULT];
+static sched_trace_entry_t _entries[TEST_ENTRIES_NUMOF];
+
+static void *_receiver(void *arg)
+{
+    msg_t msg;
+
+    (void)arg;
+    msg_receive(&msg);
+    return NULL;
+}
+
+/* returns the index of the first matching entry starting at start or
+ * numof if there is none */
+static unsigned _find(unsigned start, unsigned numof, uint8_t event,
+                      kernel_pid_t a, kernel_pid_t b)
+{
+    for (unsigned i = start; i < numof; i++) {
+        if ((_entries[i].event == event) && (_entries[i].a == a) &&
+            (_entries[i].b == b)) {
+            return i;
+        }
+    }
+    return numof;
+}
+
+int main(void)
+{
+    msg_t msg = { .type = TEST_MSG_TYPE };
+    kernel_pid_t me = thread_getpid();
+    kernel_pid_t pid;
+    unsigned numof, idx;
+
+    puts("sched_trace test");
+    sched_trace_clear();
+    /* receiver preempts main and blocks waiting for the message */
+    pid = thread_create(_stack, sizeof(_stack), THREAD_PRIORITY_MAIN - 1,
+                        THREAD_CREATE_STACKTEST, _receiver, NULL, "receiver");
+    msg_send(&msg, pid);
+    sched_trace_enable(false);
+
+    numof = sched_trace_get(_entries, TEST_ENTRIES_NUMOF);
+    printf("recorded %u events\n", numof);
+    for (unsigned i = 1; i < numof; i++) {
+        if ((int32_t)(_entries[i].time - _entries[i - 1].time) < 0) {
+            puts("[FAILED] timestamps not in order");
+            return 1;
+        }
+    }
+
+    idx = _find(0, numof, SCHED_TRACE_MSG_SEND, me, pid);
+    if ((idx == numof) || (_entries[idx].value != TEST_MSG_TYPE)) {
+        puts("[FAILED] message not sent");
+        return 1;
+    }
+    idx = _find(idx, numof, SCHED_TRACE_SWITCH, me, pid);
+    if (idx == numof) {
+        puts("[FAILED] no switch to receiver");
+        return 1;
+    }
+    idx = _find(idx, numof, SCHED_TRACE_MSG_RECV, pid, me);
+    if ((idx == numof) || (_entries[idx].value != TEST_MSG_TYPE)) {
+        puts("[FAILED] message not received");
+        return 1;
+    }
+
+    puts("[SUCCESS]");
+    return 0;
+}
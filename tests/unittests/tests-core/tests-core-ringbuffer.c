@@ -131,11 +131,95 @@ static void tests_core_ringbuffer_remove(void)
 
 }
 
+static void tests_core_ringbuffer_remove_wrap(void)
+{
+    char mem[3];
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    ringbuffer_add_one(&buf, 0);
+    ringbuffer_add_one(&buf, 1);
+    ringbuffer_get_one(&buf);
+    ringbuffer_add_one(&buf, 2);
+    ringbuffer_add_one(&buf, 3);
+
+    /* the read position reaches the end of the buffer */
+    ringbuffer_remove(&buf, 2);
+
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_get_one(&buf));
+    TEST_ASSERT_EQUAL_INT(-1, ringbuffer_get_one(&buf));
+}
+
+static void tests_core_ringbuffer_add_get_wrap(void)
+{
+    char mem[5];
+    char data[] = { 1, 2, 3, 4, 5, 6 };
+    char out[sizeof(data)];
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_add(&buf, data, 3));
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_get(&buf, out, 2));
+    /* wraps around ... */
+    TEST_ASSERT_EQUAL_INT(3, ringbuffer_add(&buf, &data[3], 3));
+    /* ... and stops when full */
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_add(&buf, data, 2));
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_full(&buf));
+    TEST_ASSERT_EQUAL_INT(5, ringbuffer_get(&buf, out, sizeof(out)));
+    TEST_ASSERT_EQUAL_INT(3, out[0]);
+    TEST_ASSERT_EQUAL_INT(4, out[1]);
+    TEST_ASSERT_EQUAL_INT(5, out[2]);
+    TEST_ASSERT_EQUAL_INT(6, out[3]);
+    TEST_ASSERT_EQUAL_INT(1, out[4]);
+}
+
+static void tests_core_ringbuffer_reserve_commit(void)
+{
+    char mem[5];
+    char *region;
+    ringbuffer_t buf;
+    ringbuffer_init(&buf, mem, sizeof(mem));
+
+    ringbuffer_add_one(&buf, 0);
+    ringbuffer_add_one(&buf, 1);
+    ringbuffer_add_one(&buf, 2);
+    ringbuffer_remove(&buf, 1);
+
+    TEST_ASSERT_EQUAL_INT(2, ringbuffer_reserve(&buf, &region));
+    TEST_ASSERT(region == &mem[3]);
+    region[0] = 3;
+    region[1] = 4;
+    ringbuffer_commit(&buf, 2);
+    /* free space left at the beginning of the buffer */
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_reserve(&buf, &region));
+    TEST_ASSERT(region == &mem[0]);
+    region[0] = 5;
+    ringbuffer_commit(&buf, 1);
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_reserve(&buf, &region));
+
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_peek_region(&buf, &region));
+    TEST_ASSERT(region == &mem[1]);
+    TEST_ASSERT_EQUAL_INT(1, region[0]);
+    TEST_ASSERT_EQUAL_INT(4, ringbuffer_remove(&buf, 4));
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_peek_region(&buf, &region));
+    TEST_ASSERT(region == &mem[0]);
+    TEST_ASSERT_EQUAL_INT(5, region[0]);
+    TEST_ASSERT_EQUAL_INT(1, ringbuffer_remove(&buf, 1));
+    TEST_ASSERT_EQUAL_INT(0, ringbuffer_peek_region(&buf, &region));
+
+    /* an empty buffer offers all of its space at once */
+    TEST_ASSERT_EQUAL_INT(sizeof(mem), ringbuffer_reserve(&buf, &region));
+    TEST_ASSERT(region == &mem[0]);
+}
+
 Test *tests_core_ringbuffer_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
         new_TestFixture(tests_core_ringbuffer),
         new_TestFixture(tests_core_ringbuffer_remove),
+        new_TestFixture(tests_core_ringbuffer_remove_wrap),
+        new_TestFixture(tests_core_ringbuffer_add_get_wrap),
+        new_TestFixture(tests_core_ringbuffer_reserve_commit),
     };
 
     EMB_UNIT_TESTCALLER(ringbuffer_tests, NULL, NULL, fixtures);
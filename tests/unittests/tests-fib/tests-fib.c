@@ -976,6 +976,97 @@ static void test_fib_20_replace_prefix(void)
     fib_deinit(&test_fib_table);
 }
 
+/*
+* @brief testing that the longest matching prefix wins, also after removing
+*        the more specific prefixes
+*/
+static void test_fib_21_longest_prefix_match(void)
+{
+    size_t add_buf_size = 16;
+    uint8_t addr_dst[add_buf_size];
+    uint8_t addr_nxt[add_buf_size];
+    uint8_t addr_nxt_hop[add_buf_size];
+    uint8_t addr_lookup[add_buf_size];
+    kernel_pid_t iface_id = KERNEL_PID_UNDEF;
+    uint32_t next_hop_flags = 0;
+    /* 2001:db8::/32, 2001:db8:1::/48 and 2001:db8:1:2::/64 */
+    const uint8_t pfx_lens[] = { 32, 48, 64 };
+
+    memset(addr_dst, 0, add_buf_size);
+    memset(addr_nxt, 0, add_buf_size);
+    addr_dst[0] = 0x20;
+    addr_dst[1] = 0x01;
+    addr_dst[2] = 0x0d;
+    addr_dst[3] = 0xb8;
+    addr_nxt[0] = 0xfe;
+    addr_nxt[1] = 0x80;
+
+    for (unsigned i = 0; i < sizeof(pfx_lens); i++) {
+        if (i > 0) {
+            addr_dst[(pfx_lens[i] >> 3) - 1] = i;
+        }
+        addr_nxt[15] = pfx_lens[i];
+        TEST_ASSERT_EQUAL_INT(0, fib_add_entry(&test_fib_table, 42, addr_dst,
+                              add_buf_size,
+                              ((uint32_t)pfx_lens[i] << FIB_FLAG_NET_PREFIX_SHIFT),
+                              addr_nxt, add_buf_size, 0x23, 100000));
+    }
+
+    /* 2001:db8:1:2::5 */
+    memcpy(addr_lookup, addr_dst, add_buf_size);
+    addr_lookup[15] = 5;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt_hop, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x123));
+    TEST_ASSERT_EQUAL_INT(64, addr_nxt_hop[15]);
+
+    /* 2001:db8:1:3::5 */
+    addr_lookup[7] = 3;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt_hop, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x123));
+    TEST_ASSERT_EQUAL_INT(48, addr_nxt_hop[15]);
+
+    /* 2001:db8:2:3::5 */
+    addr_lookup[5] = 2;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt_hop, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x123));
+    TEST_ASSERT_EQUAL_INT(32, addr_nxt_hop[15]);
+
+    /* remove 2001:db8:1::/48, so 2001:db8:1:3::5 falls back to the /32 */
+    memcpy(addr_lookup, addr_dst, add_buf_size);
+    addr_lookup[7] = 0;
+    fib_remove_entry(&test_fib_table, addr_lookup, add_buf_size);
+    addr_lookup[7] = 3;
+    addr_lookup[15] = 5;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt_hop, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x123));
+    TEST_ASSERT_EQUAL_INT(32, addr_nxt_hop[15]);
+
+    /* 2001:db8:1:2::5 still matches the /64 */
+    addr_lookup[7] = 2;
+    TEST_ASSERT_EQUAL_INT(0, fib_get_next_hop(&test_fib_table, &iface_id,
+                          addr_nxt_hop, &add_buf_size, &next_hop_flags,
+                          addr_lookup, add_buf_size, 0x123));
+    TEST_ASSERT_EQUAL_INT(64, addr_nxt_hop[15]);
+
+    /* 2001:db9:1:2::5 is not covered at all */
+    addr_lookup[3] = 0xb9;
+    TEST_ASSERT_EQUAL_INT(-EHOSTUNREACH, fib_get_next_hop(&test_fib_table,
+                          &iface_id, addr_nxt_hop, &add_buf_size,
+                          &next_hop_flags, addr_lookup, add_buf_size, 0x123));
+
+#if (TEST_FIB_SHOW_OUTPUT == 1)
+    fib_print_fib_table(&test_fib_table);
+    puts("");
+    universal_address_print_table();
+    puts("");
+#endif
+    fib_deinit(&test_fib_table);
+}
+
 Test *tests_fib_tests(void)
 {
     fib_init(&test_fib_table);
@@ -1000,6 +1091,7 @@ Test *tests_fib_tests(void)
                         new_TestFixture(test_fib_18_get_next_hop_invalid_parameters),
                         new_TestFixture(test_fib_19_default_gateway),
                         new_TestFixture(test_fib_20_replace_prefix),
+                        new_TestFixture(test_fib_21_longest_prefix_match),
     };
 
     EMB_UNIT_TESTCALLER(fib_tests, NULL, NULL, fixtures);
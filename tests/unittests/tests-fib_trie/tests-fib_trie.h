@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``fib`` module with the ``fib_trie`` module
+ *
+ * The test cases are the ones of tests-fib.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef TESTS_FIB_TRIE_H
+#define TESTS_FIB_TRIE_H
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_fib_trie(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_FIB_TRIE_H */
+/** @} */
@@ -49,6 +49,54 @@ static gcoap_listener_t listener_second = {
 
 static const char *resource_list_str = "</act/switch>,</sensor/temp>,</test/info/all>,</second/part>";
 
+/*
+ * Resources with overlapping paths and subtrees for the resource lookup tests,
+ * registered after the resources above.
+ */
+static const coap_resource_t resources_find[] = {
+    { .path = "/idx", .methods = (COAP_GET) },
+    { .path = "/idx/sub", .methods = (COAP_GET | COAP_MATCH_SUBTREE) },
+    { .path = "/idx/sub/leaf", .methods = (COAP_POST) },
+};
+
+static const coap_resource_t resources_find_second[] = {
+    { .path = "/idx", .methods = (COAP_PUT) },
+    { .path = "/idx/other", .methods = (COAP_GET) },
+    { .path = "/idx/sub/x", .methods = (COAP_GET) },
+};
+
+/* exceeds GCOAP_RESOURCE_INDEX_SIZE together with the listeners above */
+static const coap_resource_t resources_find_overflow[] = {
+    { .path = "/ovf/0", .methods = (COAP_GET) },
+    { .path = "/ovf/1", .methods = (COAP_GET) },
+    { .path = "/ovf/2", .methods = (COAP_GET) },
+    { .path = "/ovf/3", .methods = (COAP_GET) },
+    { .path = "/ovf/4", .methods = (COAP_GET) },
+    { .path = "/ovf/5", .methods = (COAP_GET) },
+    { .path = "/ovf/6", .methods = (COAP_GET) },
+    { .path = "/ovf/7", .methods = (COAP_GET) },
+};
+
+static gcoap_listener_t listener_find = {
+    .resources     = &resources_find[0],
+    .resources_len = (sizeof(resources_find) / sizeof(resources_find[0])),
+    .next          = NULL
+};
+
+static gcoap_listener_t listener_find_second = {
+    .resources     = &resources_find_second[0],
+    .resources_len = (sizeof(resources_find_second) /
+                      sizeof(resources_find_second[0])),
+    .next          = NULL
+};
+
+static gcoap_listener_t listener_find_overflow = {
+    .resources     = &resources_find_overflow[0],
+    .resources_len = (sizeof(resources_find_overflow) /
+                      sizeof(resources_find_overflow[0])),
+    .next          = NULL
+};
+
 /*
  * Client GET request success case. Test request generation.
  * Request /time resource from libcoap example
@@ -390,6 +438,122 @@ static void test_gcoap__server_get_resource_list(void)
     TEST_ASSERT_EQUAL_STRING(resource_list_str, (char *)res);
 }
 
+/*
+ * Builds a request for path with method and looks up its resource.
+ */
+static int _find_resource(unsigned method, const char *path,
+                          const coap_resource_t **resource,
+                          gcoap_listener_t **listener)
+{
+    uint8_t buf[GCOAP_PDU_BUF_SIZE];
+    coap_pkt_t pdu;
+
+    *resource = NULL;
+    *listener = NULL;
+    gcoap_req_init(&pdu, &buf[0], sizeof(buf), method, path);
+    ssize_t len = coap_opt_finish(&pdu, COAP_OPT_FINISH_NONE);
+    if ((len < 0) || (coap_parse(&pdu, &buf[0], len) < 0)) {
+        return -EINVAL;
+    }
+    return gcoap_find_resource(&pdu, resource, listener);
+}
+
+/*
+ * Test the resource lookup for requests, with multiple listeners, overlapping
+ * paths and subtrees. Also run with module gcoap_resource_index, which must
+ * select the same resources as the linear search.
+ */
+static void test_gcoap__server_find_resource(void)
+{
+    const coap_resource_t *resource;
+    gcoap_listener_t *listener;
+
+    gcoap_register_listener(&listener_find);
+    gcoap_register_listener(&listener_find_second);
+
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[0] == resource);
+    TEST_ASSERT(&listener_find == listener);
+
+    /* same path in a later listener, selected by the method */
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_PUT, "/idx",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find_second[0] == resource);
+    TEST_ASSERT(&listener_find_second == listener);
+    TEST_ASSERT_EQUAL_INT(-1, _find_resource(COAP_METHOD_DELETE, "/idx",
+                                             &resource, &listener));
+
+    /* the subtree of the first listener wins over an exact path of a later
+     * listener, and matches any path it is a prefix of */
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx/sub/x",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[1] == resource);
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx/sub",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[1] == resource);
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx/subway",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[1] == resource);
+
+    /* a subtree with the wrong method does not hide later resources */
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_POST, "/idx/sub/leaf",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[2] == resource);
+    TEST_ASSERT(&listener_find == listener);
+
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx/other",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find_second[1] == resource);
+    TEST_ASSERT(&listener_find_second == listener);
+
+    TEST_ASSERT_EQUAL_INT(-2, _find_resource(COAP_METHOD_GET, "/idx/none",
+                                             &resource, &listener));
+    TEST_ASSERT_EQUAL_INT(-2, _find_resource(COAP_METHOD_GET, "/id",
+                                             &resource, &listener));
+    TEST_ASSERT_EQUAL_INT(-2, _find_resource(COAP_METHOD_GET, "/",
+                                             &resource, &listener));
+
+    /* resources of the listeners registered before */
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/second/part",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_second[0] == resource);
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET,
+                                            "/.well-known/core",
+                                            &resource, &listener));
+    TEST_ASSERT_EQUAL_STRING("/.well-known/core", resource->path);
+}
+
+/*
+ * Test the resource lookup once more resources are registered than the
+ * resource index holds.
+ */
+static void test_gcoap__server_find_resource_overflow(void)
+{
+    const coap_resource_t *resource;
+    gcoap_listener_t *listener;
+
+    gcoap_register_listener(&listener_find_overflow);
+
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/ovf/7",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find_overflow[7] == resource);
+    TEST_ASSERT(&listener_find_overflow == listener);
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/ovf/0",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find_overflow[0] == resource);
+
+    /* the resources registered before are still found */
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_GET, "/idx/sub/x",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find[1] == resource);
+    TEST_ASSERT_EQUAL_INT(0, _find_resource(COAP_METHOD_PUT, "/idx",
+                                            &resource, &listener));
+    TEST_ASSERT(&resources_find_second[0] == resource);
+    TEST_ASSERT_EQUAL_INT(-2, _find_resource(COAP_METHOD_GET, "/ovf/8",
+                                             &resource, &listener));
+}
+
 Test *tests_gcoap_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -403,7 +567,9 @@ Test *tests_gcoap_tests(void)
         new_TestFixture(test_gcoap__server_get_resp),
         new_TestFixture(test_gcoap__server_con_req),
         new_TestFixture(test_gcoap__server_con_resp),
-        new_TestFixture(test_gcoap__server_get_resource_list)
+        new_TestFixture(test_gcoap__server_get_resource_list),
+        new_TestFixture(test_gcoap__server_find_resource),
+        new_TestFixture(test_gcoap__server_find_resource_overflow),
     };
 
     EMB_UNIT_TESTCALLER(gcoap_tests, NULL, NULL, fixtures);
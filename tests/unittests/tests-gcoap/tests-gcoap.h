@@ -32,6 +32,13 @@ extern "C" {
  */
 void tests_gcoap(void);
 
+/**
+ * @brief   Generates tests for gcoap
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_gcoap_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,17 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+#include "embUnit.h"
+
+#include "../tests-gcoap/tests-gcoap.h"
+#include "tests-gcoap_index.h"
+
+void tests_gcoap_index(void)
+{
+    TESTS_RUN(tests_gcoap_tests());
+}
@@ -0,0 +1,39 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``gcoap`` module with the
+ *              ``gcoap_resource_index`` module
+ *
+ * The test cases are the ones of tests-gcoap.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef TESTS_GCOAP_INDEX_H
+#define TESTS_GCOAP_INDEX_H
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_gcoap_index(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_GCOAP_INDEX_H */
+/** @} */
@@ -29,12 +29,8 @@
 
 static void set_up(void)
 {
-    evtimer_event_t *tmp;
-
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    while (_nib_evtimer.events != NULL) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), _nib_evtimer.events);
     }
     _nib_init();
 }
@@ -34,12 +34,8 @@
 
 static void set_up(void)
 {
-    evtimer_event_t *tmp;
-
-    for (evtimer_event_t *ptr = _nib_evtimer.events;
-         (ptr != NULL) && (tmp = (ptr->next), 1);
-         ptr = tmp) {
-        evtimer_del((evtimer_t *)(&_nib_evtimer), ptr);
+    while (_nib_evtimer.events != NULL) {
+        evtimer_del((evtimer_t *)(&_nib_evtimer), _nib_evtimer.events);
     }
     _nib_init();
 }
@@ -718,6 +714,163 @@ static void test_nib_ft_iter__empty_pref_route_in_the_middle(void)
     TEST_ASSERT_EQUAL_INT(2, count);
 }
 
+/* nested routes for the longest prefix match tests below */
+static const struct {
+    const char *dst;
+    unsigned dst_len;
+} _nested[] = {
+    { "2001::", 16 },
+    { "2001:db8::", 32 },
+    { "2001:db8:1::", 48 },
+    { "2001:db8:2::", 48 },
+    { "2001:db8:1:1::", 64 },
+};
+
+#define NESTED_NUMOF    (sizeof(_nested) / sizeof(_nested[0]))
+
+static void _nested_add(unsigned i)
+{
+    ipv6_addr_t dst;
+    const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                            { .u64 = TEST_UINT64 + i } } };
+
+    TEST_ASSERT_NOT_NULL(ipv6_addr_from_str(&dst, _nested[i].dst));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_ipv6_nib_ft_add(&dst, _nested[i].dst_len,
+                                                  &next_hop, IFACE, 0));
+}
+
+static void _nested_del(unsigned i)
+{
+    ipv6_addr_t dst;
+
+    TEST_ASSERT_NOT_NULL(ipv6_addr_from_str(&dst, _nested[i].dst));
+    gnrc_ipv6_nib_ft_del(&dst, _nested[i].dst_len);
+}
+
+/*
+ * Returns the index in _nested of the route to addr, -1 if there is none.
+ */
+static int _nested_get(const char *addr)
+{
+    gnrc_ipv6_nib_ft_t fte;
+    ipv6_addr_t dst;
+
+    ipv6_addr_from_str(&dst, addr);
+    if (gnrc_ipv6_nib_ft_get(&dst, NULL, &fte) < 0) {
+        return -1;
+    }
+    for (unsigned i = 0; i < NESTED_NUMOF; i++) {
+        const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                { .u64 = TEST_UINT64 + i } } };
+
+        if ((fte.dst_len == _nested[i].dst_len) &&
+            ipv6_addr_equal(&fte.next_hop, &next_hop)) {
+            return i;
+        }
+    }
+    return -2;
+}
+
+static void _nested_add_all(void)
+{
+    for (unsigned i = 0; i < NESTED_NUMOF; i++) {
+        _nested_add(i);
+    }
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:2::1"));
+    TEST_ASSERT_EQUAL_INT(3, _nested_get("2001:db8:2::1"));
+    TEST_ASSERT_EQUAL_INT(1, _nested_get("2001:db8:3::1"));
+    TEST_ASSERT_EQUAL_INT(0, _nested_get("2001:1::1"));
+    TEST_ASSERT_EQUAL_INT(-1, _nested_get("2002::1"));
+}
+
+/*
+ * Adds nested routes, then removes the route to 2001:db8::/32 that has both
+ * shorter and longer routes and adds it again.
+ * Expected result: addresses only covered by the removed route fall back to
+ * 2001::/16, all other addresses keep their route
+ */
+static void test_nib_ft_get__nested_del_interior(void)
+{
+    _nested_add_all();
+    _nested_del(1);
+    TEST_ASSERT_EQUAL_INT(0, _nested_get("2001:db8:3::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:2::1"));
+    TEST_ASSERT_EQUAL_INT(3, _nested_get("2001:db8:2::1"));
+    _nested_add(1);
+    TEST_ASSERT_EQUAL_INT(1, _nested_get("2001:db8:3::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+}
+
+/*
+ * Adds nested routes, then removes the route to 2001:db8:1::/48 that has a
+ * single longer route and adds it again.
+ * Expected result: addresses only covered by the removed route fall back to
+ * 2001:db8::/32, 2001:db8:1:1::/64 is still found
+ */
+static void test_nib_ft_get__nested_del_interior_one_child(void)
+{
+    _nested_add_all();
+    _nested_del(2);
+    TEST_ASSERT_EQUAL_INT(1, _nested_get("2001:db8:1:2::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+    TEST_ASSERT_EQUAL_INT(3, _nested_get("2001:db8:2::1"));
+    _nested_add(2);
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:2::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+}
+
+/*
+ * Adds nested routes, then removes the routes without longer routes one after
+ * another and adds them again.
+ * Expected result: addresses covered by a removed route fall back to the next
+ * shorter route
+ */
+static void test_nib_ft_get__nested_del_leaves(void)
+{
+    _nested_add_all();
+    _nested_del(3);
+    TEST_ASSERT_EQUAL_INT(1, _nested_get("2001:db8:2::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:2::1"));
+    _nested_del(4);
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:1::1"));
+    _nested_add(3);
+    _nested_add(4);
+    TEST_ASSERT_EQUAL_INT(3, _nested_get("2001:db8:2::1"));
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+}
+
+/*
+ * Adds nested routes, removes all of them, starting in the middle, and adds
+ * them again in reverse order.
+ * Expected result: no route is found once all are removed, the same routes as
+ * before are found after adding them again
+ */
+static void test_nib_ft_get__nested_del_all(void)
+{
+    static const unsigned order[] = { 1, 0, 4, 2, 3 };
+    static const int expected1[] = { 4, 4, 2, -1, -1 };
+    static const int expected3[] = { 3, 3, 3, 3, -1 };
+
+    _nested_add_all();
+    for (unsigned i = 0; i < NESTED_NUMOF; i++) {
+        _nested_del(order[i]);
+        TEST_ASSERT_EQUAL_INT(expected1[i], _nested_get("2001:db8:1:1::1"));
+        TEST_ASSERT_EQUAL_INT(expected3[i], _nested_get("2001:db8:2::1"));
+    }
+    TEST_ASSERT_EQUAL_INT(-1, _nested_get("2001:1::1"));
+    for (int i = NESTED_NUMOF - 1; i >= 0; i--) {
+        _nested_add(i);
+    }
+    TEST_ASSERT_EQUAL_INT(4, _nested_get("2001:db8:1:1::1"));
+    TEST_ASSERT_EQUAL_INT(2, _nested_get("2001:db8:1:2::1"));
+    TEST_ASSERT_EQUAL_INT(3, _nested_get("2001:db8:2::1"));
+    TEST_ASSERT_EQUAL_INT(1, _nested_get("2001:db8:3::1"));
+    TEST_ASSERT_EQUAL_INT(0, _nested_get("2001:1::1"));
+}
+
 Test *tests_gnrc_ipv6_nib_ft_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -727,6 +880,10 @@ Test *tests_gnrc_ipv6_nib_ft_tests(void)
         new_TestFixture(test_nib_ft_get__success2),
         new_TestFixture(test_nib_ft_get__success3),
         new_TestFixture(test_nib_ft_get__success4),
+        new_TestFixture(test_nib_ft_get__nested_del_interior),
+        new_TestFixture(test_nib_ft_get__nested_del_interior_one_child),
+        new_TestFixture(test_nib_ft_get__nested_del_leaves),
+        new_TestFixture(test_nib_ft_get__nested_del_all),
         new_TestFixture(test_nib_ft_add__EINVAL_def_route_next_hop_NULL),
         new_TestFixture(test_nib_ft_add__EINVAL_iface0),
         new_TestFixture(test_nib_ft_add__ENOMEM_diff_def_router),
@@ -1448,6 +1448,29 @@ static void test_nib_offl_alloc__success_overwrite_unspecified(void)
     TEST_ASSERT(ipv6_addr_equal(&next_hop, &dst1->next_hop->ipv6));
 }
 
+/*
+ * Creates an off-link entry with no next hop address and then adds another
+ * off-link entry with the same prefix and interface but with a next hop address.
+ * Expected result: the on-link entry of the next hop can be found by its new
+ * address, but not by the unspecified address anymore
+ */
+static void test_nib_offl_alloc__success_overwrite_unspecified_get(void)
+{
+    _nib_offl_entry_t *dst;
+    static const ipv6_addr_t next_hop = { .u64 = { { .u8 = LINK_LOCAL_PREFIX },
+                                                 { .u64 = TEST_UINT64 } } };
+    static const ipv6_addr_t pfx = { .u64 = { { .u8 = GLOBAL_PREFIX } } };
+
+    TEST_ASSERT_NOT_NULL((dst = _nib_offl_alloc(NULL, IFACE, &pfx,
+                                                GLOBAL_PREFIX_LEN)));
+    dst->mode |= _PL;
+    TEST_ASSERT(dst->next_hop == _nib_onl_get(&ipv6_addr_unspecified, IFACE));
+    TEST_ASSERT(dst == _nib_offl_alloc(&next_hop, IFACE, &pfx,
+                                       GLOBAL_PREFIX_LEN));
+    TEST_ASSERT(dst->next_hop == _nib_onl_get(&next_hop, IFACE));
+    TEST_ASSERT_NULL(_nib_onl_get(&ipv6_addr_unspecified, IFACE));
+}
+
 /*
  * Creates an off-link entry.
  * Expected result: new entry should contain the given prefix, address and
@@ -2069,6 +2092,7 @@ Test *tests_gnrc_ipv6_nib_internal_tests(void)
         new_TestFixture(test_nib_offl_alloc__no_space_left_diff_next_hop_iface_pfx_pfx_len),
         new_TestFixture(test_nib_offl_alloc__success_duplicate),
         new_TestFixture(test_nib_offl_alloc__success_overwrite_unspecified),
+        new_TestFixture(test_nib_offl_alloc__success_overwrite_unspecified_get),
         new_TestFixture(test_nib_offl_alloc__success),
         new_TestFixture(test_nib_offl_clear__uncleared),
         new_TestFixture(test_nib_offl_clear__same_next_hop),
@@ -0,0 +1,289 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+#include "timex.h"
+
+#include "net/gnrc/tcp/cc.h"
+#include "internal/common.h"
+#include "internal/cc.h"
+
+#include "tests-gnrc_tcp_cc.h"
+
+#define SMSS    (500U)
+#define ISS     (1000U)
+
+/* a bare TCB: no segments are queued, so retransmissions do not send */
+static gnrc_tcp_tcb_t _tcb;
+
+static void set_up(void)
+{
+    memset(&_tcb, 0, sizeof(_tcb));
+    _tcb.mss = SMSS;
+    _tcb.snd_una = ISS;
+    _tcb.snd_nxt = ISS;
+    _tcb.srtt = RTO_UNINITIALIZED;
+    _tcb.rtt_var = RTO_UNINITIALIZED;
+    _tcb.rtt_min = INT32_MAX;
+    _tcb.rto = GNRC_TCP_RTO_LOWER_BOUND;
+}
+
+static void _start(const gnrc_tcp_cc_t *cc)
+{
+    _tcb.cc = cc;
+    _cc_init(&_tcb);
+}
+
+static void _send(uint32_t len)
+{
+    _tcb.snd_nxt += len;
+}
+
+static void _ack(uint32_t len)
+{
+    _tcb.snd_una += len;
+    _cc_ack(&_tcb, len);
+}
+
+static void _dup_acks(unsigned num)
+{
+    for (unsigned i = 0; i < num; i++) {
+        _cc_dup_ack(&_tcb);
+    }
+}
+
+static void test_gnrc_tcp_cc__newreno_init(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX, _tcb.ssthresh);
+    TEST_ASSERT(!(_tcb.status & (STATUS_RECOVERY | STATUS_FAST_RECOVERY)));
+}
+
+static void test_gnrc_tcp_cc__newreno_slow_start(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _send(4 * SMSS);
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(5 * SMSS, _tcb.cwnd);
+    _ack(SMSS / 2);
+    TEST_ASSERT_EQUAL_INT(5 * SMSS + SMSS / 2, _tcb.cwnd);
+    /* grows by one SMSS per ACK at most */
+    _ack(2 * SMSS);
+    TEST_ASSERT_EQUAL_INT(6 * SMSS + SMSS / 2, _tcb.cwnd);
+}
+
+static void test_gnrc_tcp_cc__newreno_congestion_avoidance(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _tcb.ssthresh = _tcb.cwnd;
+    _send(8 * SMSS);
+    _ack(SMSS);
+    _ack(SMSS);
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.cwnd);
+    /* one SMSS once a whole cwnd was acknowledged */
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(5 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.cwnd_acked);
+}
+
+static void test_gnrc_tcp_cc__newreno_fast_retransmit(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _send(8 * SMSS);
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD - 1);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.fast_retransmits);
+    TEST_ASSERT(!(_tcb.status & STATUS_RECOVERY));
+    _dup_acks(1);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.fast_retransmits);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(ISS + 8 * SMSS, _tcb.recover);
+    /* half of the flight size, plus the segments that left the network */
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.ssthresh);
+    TEST_ASSERT_EQUAL_INT(7 * SMSS, _tcb.cwnd);
+    /* further duplicate ACKs inflate cwnd */
+    _dup_acks(1);
+    TEST_ASSERT_EQUAL_INT(8 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.fast_retransmits);
+}
+
+static void test_gnrc_tcp_cc__newreno_partial_ack(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _send(8 * SMSS);
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    /* deflate by the data acknowledged, allow one new segment */
+    _ack(2 * SMSS);
+    TEST_ASSERT_EQUAL_INT(6 * SMSS, _tcb.cwnd);
+    TEST_ASSERT(_tcb.status & STATUS_FAST_RECOVERY);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.ssthresh);
+}
+
+static void test_gnrc_tcp_cc__newreno_full_ack(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _send(8 * SMSS);
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    /* new data sent during fast recovery */
+    _send(2 * SMSS);
+    _ack(8 * SMSS);
+    TEST_ASSERT(!(_tcb.status & (STATUS_RECOVERY | STATUS_FAST_RECOVERY)));
+    /* min(ssthresh, flight size + SMSS) */
+    TEST_ASSERT_EQUAL_INT(3 * SMSS, _tcb.cwnd);
+
+    /* the next loss is detected by duplicate ACKs again */
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    TEST_ASSERT_EQUAL_INT(2, _tcb.fast_retransmits);
+}
+
+static void test_gnrc_tcp_cc__newreno_timeout(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _send(8 * SMSS);
+    _cc_timeout(&_tcb);
+    TEST_ASSERT_EQUAL_INT(SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.ssthresh);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.timeouts);
+    TEST_ASSERT(_tcb.status & STATUS_RECOVERY);
+    TEST_ASSERT(!(_tcb.status & STATUS_FAST_RECOVERY));
+    /* no fast retransmit while recovering from a timeout */
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    TEST_ASSERT_EQUAL_INT(0, _tcb.fast_retransmits);
+    TEST_ASSERT_EQUAL_INT(SMSS, _tcb.cwnd);
+    /* partial ACKs in slow start do not deflate cwnd */
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(2 * SMSS, _tcb.cwnd);
+    TEST_ASSERT(_tcb.status & STATUS_RECOVERY);
+}
+
+static void test_gnrc_tcp_cc__newreno_backoff(void)
+{
+    _start(&gnrc_tcp_cc_newreno);
+    _tcb.srtt = 100 * US_PER_MS;
+    _tcb.rtt_var = 50 * US_PER_MS;
+    _cc_backoff(&_tcb);
+    TEST_ASSERT_EQUAL_INT(2 * GNRC_TCP_RTO_LOWER_BOUND, _tcb.rto);
+    TEST_ASSERT_EQUAL_INT(100 * US_PER_MS, _tcb.srtt);
+    /* the RTT estimation is discarded after five retries */
+    _tcb.retries = 5;
+    _cc_backoff(&_tcb);
+    TEST_ASSERT_EQUAL_INT(4 * GNRC_TCP_RTO_LOWER_BOUND, _tcb.rto);
+    TEST_ASSERT_EQUAL_INT(RTO_UNINITIALIZED, _tcb.srtt);
+    TEST_ASSERT_EQUAL_INT(RTO_UNINITIALIZED, _tcb.rtt_var);
+}
+
+static void test_gnrc_tcp_cc__cocoa_init(void)
+{
+    _start(&gnrc_tcp_cc_cocoa);
+    TEST_ASSERT_EQUAL_INT(2 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(UINT16_MAX, _tcb.ssthresh);
+}
+
+static void test_gnrc_tcp_cc__cocoa_backoff(void)
+{
+    static const struct {
+        int32_t rto;
+        int32_t backoff;
+    } vbf[] = {
+        { 500 * US_PER_MS, 1500 * US_PER_MS },  /* short RTO: * 3 */
+        { 1 * US_PER_SEC, 2 * US_PER_SEC },
+        { 2 * US_PER_SEC, 4 * US_PER_SEC },     /* * 2 */
+        { 3 * US_PER_SEC, 6 * US_PER_SEC },
+        { 4 * US_PER_SEC, 6 * US_PER_SEC },     /* long RTO: * 1.5 */
+    };
+
+    _start(&gnrc_tcp_cc_cocoa);
+    for (unsigned i = 0; i < sizeof(vbf) / sizeof(vbf[0]); i++) {
+        _tcb.rto = vbf[i].rto;
+        _cc_backoff(&_tcb);
+        TEST_ASSERT_EQUAL_INT(vbf[i].backoff, _tcb.rto);
+    }
+}
+
+static void test_gnrc_tcp_cc__cocoa_link_loss(void)
+{
+    _start(&gnrc_tcp_cc_cocoa);
+    _tcb.rtt_min = 100 * US_PER_MS;
+    _tcb.srtt = 110 * US_PER_MS;
+    _send(8 * SMSS);
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    TEST_ASSERT_EQUAL_INT(1, _tcb.fast_retransmits);
+    /* no queue built up: shrink by a quarter only */
+    TEST_ASSERT_EQUAL_INT(6 * SMSS, _tcb.ssthresh);
+    TEST_ASSERT_EQUAL_INT(9 * SMSS, _tcb.cwnd);
+}
+
+static void test_gnrc_tcp_cc__cocoa_congestion_loss(void)
+{
+    _start(&gnrc_tcp_cc_cocoa);
+    _tcb.rtt_min = 100 * US_PER_MS;
+    _tcb.srtt = 200 * US_PER_MS;
+    _send(8 * SMSS);
+    _dup_acks(GNRC_TCP_DUP_ACK_THRESHOLD);
+    TEST_ASSERT_EQUAL_INT(4 * SMSS, _tcb.ssthresh);
+    TEST_ASSERT_EQUAL_INT(7 * SMSS, _tcb.cwnd);
+    _cc_timeout(&_tcb);
+    TEST_ASSERT_EQUAL_INT(SMSS, _tcb.cwnd);
+}
+
+static void test_gnrc_tcp_cc__cocoa_delayed_ack(void)
+{
+    _start(&gnrc_tcp_cc_cocoa);
+    _tcb.rtt_min = 100 * US_PER_MS;
+    _tcb.srtt = 200 * US_PER_MS;
+    _send(4 * SMSS);
+    /* a queue builds up: leave slow start, keep cwnd */
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(2 * SMSS, _tcb.cwnd);
+    TEST_ASSERT_EQUAL_INT(2 * SMSS, _tcb.ssthresh);
+    /* the queue drained: congestion avoidance */
+    _tcb.srtt = 120 * US_PER_MS;
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(2 * SMSS, _tcb.cwnd);
+    _ack(SMSS);
+    TEST_ASSERT_EQUAL_INT(3 * SMSS, _tcb.cwnd);
+}
+
+Test *tests_gnrc_tcp_cc_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_gnrc_tcp_cc__newreno_init),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_slow_start),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_congestion_avoidance),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_fast_retransmit),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_partial_ack),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_full_ack),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_timeout),
+        new_TestFixture(test_gnrc_tcp_cc__newreno_backoff),
+        new_TestFixture(test_gnrc_tcp_cc__cocoa_init),
+        new_TestFixture(test_gnrc_tcp_cc__cocoa_backoff),
+        new_TestFixture(test_gnrc_tcp_cc__cocoa_link_loss),
+        new_TestFixture(test_gnrc_tcp_cc__cocoa_congestion_loss),
+        new_TestFixture(test_gnrc_tcp_cc__cocoa_delayed_ack),
+    };
+
+    EMB_UNIT_TESTCALLER(gnrc_tcp_cc_tests, set_up, NULL, fixtures);
+
+    return (Test *)&gnrc_tcp_cc_tests;
+}
+
+void tests_gnrc_tcp_cc(void)
+{
+    TESTS_RUN(tests_gnrc_tcp_cc_tests());
+}
+/** @} */
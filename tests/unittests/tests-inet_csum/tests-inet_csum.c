@@ -13,6 +13,7 @@
  */
 #include <errno.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "embUnit.h"
 
@@ -165,6 +166,29 @@ static void test_inet_csum__empty_app_buffer(void)
     TEST_ASSERT_EQUAL_INT(hdr_expected, pyld_sum);
 }
 
+static void test_inet_csum__unaligned(void)
+{
+    /* source: https://tools.ietf.org/html/rfc1071#section-3 */
+    static const uint8_t data[] = {
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+        0x00, 0x01, 0xf2, 0x03, 0xf4, 0xf5, 0xf6, 0xf7,
+    };
+    uint32_t buf[(sizeof(data) + 4) / sizeof(uint32_t)];
+
+    /* word-wise summing must not depend on the buffer's alignment */
+    for (unsigned i = 0; i < sizeof(uint32_t); i++) {
+        uint8_t *start = ((uint8_t *)buf) + i;
+
+        memcpy(start, data, sizeof(data));
+        /* 4 * 0xddf2 = 0x377c8 => 0x77cb */
+        TEST_ASSERT_EQUAL_INT(0x77cb, inet_csum(0, start, sizeof(data)));
+        /* odd length: last byte is top half of 16-bit word */
+        TEST_ASSERT_EQUAL_INT(0x76d4, inet_csum(0, start, sizeof(data) - 1));
+    }
+}
+
 Test *tests_inet_csum_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -176,6 +200,7 @@ Test *tests_inet_csum_tests(void)
         new_TestFixture(test_inet_csum__odd_len),
         new_TestFixture(test_inet_csum__two_app_snips),
         new_TestFixture(test_inet_csum__empty_app_buffer),
+        new_TestFixture(test_inet_csum__unaligned),
     };
 
     EMB_UNIT_TESTCALLER(inet_csum_tests, NULL, NULL, fixtures);
@@ -124,6 +124,17 @@ void test_netreg_num__2_entries(void)
     TEST_ASSERT_EQUAL_INT(2, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
 }
 
+void test_netreg_num__cached_other_ctx(void)
+{
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16 + 1));
+    TEST_ASSERT_EQUAL_INT(1, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+    TEST_ASSERT(&entries[0] == gnrc_netreg_lookup(GNRC_NETTYPE_TEST, TEST_UINT16));
+    gnrc_netreg_unregister(GNRC_NETTYPE_TEST, &entries[0]);
+    TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_num(GNRC_NETTYPE_TEST, TEST_UINT16));
+}
+
 void test_netreg_getnext__NULL(void)
 {
     TEST_ASSERT_EQUAL_INT(0, gnrc_netreg_register(GNRC_NETTYPE_TEST, &entries[0]));
@@ -153,6 +164,7 @@ Test *tests_netreg_tests(void)
         new_TestFixture(test_netreg_num__wrong_type_undef),
         new_TestFixture(test_netreg_num__wrong_type_numof),
         new_TestFixture(test_netreg_num__2_entries),
+        new_TestFixture(test_netreg_num__cached_other_ctx),
         new_TestFixture(test_netreg_getnext__NULL),
         new_TestFixture(test_netreg_getnext__2_entries),
     };
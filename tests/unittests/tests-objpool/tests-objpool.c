@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <string.h>
+
+#include "embUnit.h"
+#include "objpool.h"
+
+#include "tests-objpool.h"
+
+#define TEST_NUMOF      (4U)
+
+typedef struct {
+    uint8_t data[7];
+} test_obj_t;
+
+static objpool_t _pool;
+static test_obj_t _objs[TEST_NUMOF];
+
+static void set_up(void)
+{
+    objpool_init(&_pool, _objs, sizeof(_objs[0]), TEST_NUMOF);
+}
+
+static void test_objpool_alloc_all(void)
+{
+    test_obj_t *objs[TEST_NUMOF];
+
+    for (unsigned i = 0; i < TEST_NUMOF; i++) {
+        objs[i] = objpool_alloc(&_pool);
+        TEST_ASSERT_NOT_NULL(objs[i]);
+        /* blocks are part of the array and distinct */
+        TEST_ASSERT((objs[i] >= &_objs[0]) && (objs[i] <= &_objs[TEST_NUMOF - 1]));
+        for (unsigned j = 0; j < i; j++) {
+            TEST_ASSERT(objs[i] != objs[j]);
+        }
+        memset(objs[i], 0xff, sizeof(test_obj_t));
+    }
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+    TEST_ASSERT_EQUAL_INT(TEST_NUMOF, objpool_used(&_pool));
+    TEST_ASSERT_EQUAL_INT(TEST_NUMOF, objpool_max_used(&_pool));
+    TEST_ASSERT_EQUAL_INT(1, objpool_failed(&_pool));
+}
+
+static void test_objpool_free_realloc(void)
+{
+    test_obj_t *objs[TEST_NUMOF];
+
+    for (unsigned i = 0; i < TEST_NUMOF; i++) {
+        objs[i] = objpool_alloc(&_pool);
+    }
+    objpool_free(&_pool, objs[1]);
+    objpool_free(&_pool, objs[2]);
+    TEST_ASSERT_EQUAL_INT(TEST_NUMOF - 2, objpool_used(&_pool));
+    /* last freed is allocated first */
+    TEST_ASSERT(objpool_alloc(&_pool) == objs[2]);
+    TEST_ASSERT(objpool_alloc(&_pool) == objs[1]);
+    TEST_ASSERT_NULL(objpool_alloc(&_pool));
+    for (unsigned i = 0; i < TEST_NUMOF; i++) {
+        objpool_free(&_pool, objs[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, objpool_used(&_pool));
+    TEST_ASSERT_EQUAL_INT(TEST_NUMOF, objpool_max_used(&_pool));
+}
+
+static void test_objpool_high_water_mark(void)
+{
+    void *a = objpool_alloc(&_pool);
+    void *b = objpool_alloc(&_pool);
+
+    objpool_free(&_pool, a);
+    a = objpool_alloc(&_pool);
+    objpool_free(&_pool, a);
+    objpool_free(&_pool, b);
+    TEST_ASSERT_EQUAL_INT(0, objpool_used(&_pool));
+    TEST_ASSERT_EQUAL_INT(2, objpool_max_used(&_pool));
+    TEST_ASSERT_EQUAL_INT(0, objpool_failed(&_pool));
+}
+
+Test *tests_objpool_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_objpool_alloc_all),
+        new_TestFixture(test_objpool_free_realloc),
+        new_TestFixture(test_objpool_high_water_mark),
+    };
+
+    EMB_UNIT_TESTCALLER(objpool_tests, set_up, NULL, fixtures);
+
+    return (Test *)&objpool_tests;
+}
+
+void tests_objpool(void)
+{
+    TESTS_RUN(tests_objpool_tests());
+}
+/** @} */
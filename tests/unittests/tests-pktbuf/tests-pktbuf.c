@@ -202,6 +202,7 @@ static void test_pktbuf_add__memfull(void)
 }
 #endif
 
+#ifndef MODULE_GNRC_PKTBUF_SIZECLASS  /* size classes round up, so not all of these fit */
 static void test_pktbuf_add__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_prev = NULL;
@@ -225,6 +226,7 @@ static void test_pktbuf_add__success(void)
     }
     TEST_ASSERT(gnrc_pktbuf_is_sane());
 }
+#endif
 
 static void test_pktbuf_add__packed_struct(void)
 {
@@ -245,7 +247,9 @@ static void test_pktbuf_add__packed_struct(void)
     TEST_ASSERT_EQUAL_INT(data.s64, data_cpy->s64);
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC   /* alignment-handling left to malloc, so no certainty here */
+/* alignment-handling left to malloc, so no certainty here, size classes are
+ * always aligned */
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SIZECLASS)
 static void test_pktbuf_add__unaligned_in_aligned_hole(void)
 {
     gnrc_pktsnip_t *pkt1 = gnrc_pktbuf_add(NULL, NULL, 8, GNRC_NETTYPE_TEST);
@@ -813,7 +817,7 @@ static void test_pktbuf_start_write__pkt_users_2(void)
     TEST_ASSERT(gnrc_pktbuf_is_empty());
 }
 
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SIZECLASS)
 static void test_pktbuf_reverse_snips__too_full(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_huge;
@@ -837,6 +841,31 @@ static void test_pktbuf_reverse_snips__too_full(void)
 }
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
 
+#ifdef MODULE_GNRC_PKTBUF_SIZECLASS
+static void test_pktbuf_reverse_snips__too_full_sizeclass(void)
+{
+    gnrc_pktsnip_t *pkt, *pkt_next, *pkt_fill = NULL, *tmp;
+
+    pkt_next = gnrc_pktbuf_add(NULL, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt_next);
+    /* hold to enforce duplication */
+    gnrc_pktbuf_hold(pkt_next, 1);
+    pkt = gnrc_pktbuf_add(pkt_next, TEST_STRING8, 8, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(pkt);
+    /* filling up rest of packet buffer, every snip takes the smallest size
+     * class */
+    while ((tmp = gnrc_pktbuf_add(pkt_fill, NULL, 0, GNRC_NETTYPE_UNDEF)) != NULL) {
+        pkt_fill = tmp;
+    }
+    TEST_ASSERT_NOT_NULL(pkt_fill);
+    TEST_ASSERT_NULL(gnrc_pktbuf_reverse_snips(pkt));
+    gnrc_pktbuf_release(pkt_fill);
+    /* release because of hold above */
+    gnrc_pktbuf_release(pkt_next);
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+#endif
+
 static void test_pktbuf_reverse_snips__success(void)
 {
     gnrc_pktsnip_t *pkt, *pkt_next, *pkt_reversed;
@@ -866,9 +895,11 @@ Test *tests_pktbuf_tests(void)
 #ifndef MODULE_GNRC_PKTBUF_MALLOC
         new_TestFixture(test_pktbuf_add__memfull),
 #endif
+#ifndef MODULE_GNRC_PKTBUF_SIZECLASS
         new_TestFixture(test_pktbuf_add__success),
+#endif
         new_TestFixture(test_pktbuf_add__packed_struct),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SIZECLASS)
         new_TestFixture(test_pktbuf_add__unaligned_in_aligned_hole),
 #endif
         new_TestFixture(test_pktbuf_add__0_sized_release),
@@ -906,9 +937,12 @@ Test *tests_pktbuf_tests(void)
         new_TestFixture(test_pktbuf_start_write__NULL),
         new_TestFixture(test_pktbuf_start_write__pkt_users_1),
         new_TestFixture(test_pktbuf_start_write__pkt_users_2),
-#ifndef MODULE_GNRC_PKTBUF_MALLOC
+#if !defined(MODULE_GNRC_PKTBUF_MALLOC) && !defined(MODULE_GNRC_PKTBUF_SIZECLASS)
         new_TestFixture(test_pktbuf_reverse_snips__too_full),
 #endif /* MODULE_GNRC_PKTBUF_MALLOC */
+#ifdef MODULE_GNRC_PKTBUF_SIZECLASS
+        new_TestFixture(test_pktbuf_reverse_snips__too_full_sizeclass),
+#endif
         new_TestFixture(test_pktbuf_reverse_snips__success),
     };
 
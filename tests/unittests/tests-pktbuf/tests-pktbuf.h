@@ -29,6 +29,13 @@ extern "C" {
  */
 void tests_pktbuf(void);
 
+/**
+ * @brief   Generates tests for pktbuf
+ *
+ * @return  embUnit tests if successful, NULL if not.
+ */
+Test *tests_pktbuf_tests(void);
+
 #ifdef __cplusplus
 }
 #endif
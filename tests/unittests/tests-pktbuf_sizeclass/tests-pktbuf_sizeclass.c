@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @{
+ *
+ * @file
+ */
+#include <stdint.h>
+#include <string.h>
+
+#include "embUnit.h"
+
+#include "net/gnrc/nettype.h"
+#include "net/gnrc/pkt.h"
+#include "net/gnrc/pktbuf.h"
+
+#include "../tests-pktbuf/tests-pktbuf.h"
+#include "tests-pktbuf_sizeclass.h"
+
+#define BLOCK_SIZE      (GNRC_PKTBUF_SIZECLASS_BLOCK_SIZE)
+#define HDR_SIZE        (4U)
+/* every filler takes at least two blocks, one for its snip and one for its
+ * data */
+#define FILLER_NUMOF    (GNRC_PKTBUF_SIZE / (2 * BLOCK_SIZE))
+
+static gnrc_pktsnip_t *_fillers[FILLER_NUMOF];
+
+static void set_up(void)
+{
+    gnrc_pktbuf_init();
+}
+
+/* allocates packets of one byte until the packet buffer is full */
+static unsigned _fill(void)
+{
+    unsigned num;
+
+    for (num = 0; num < FILLER_NUMOF; num++) {
+        _fillers[num] = gnrc_pktbuf_add(NULL, NULL, 1, GNRC_NETTYPE_TEST);
+        if (_fillers[num] == NULL) {
+            break;
+        }
+    }
+    return num;
+}
+
+static void _release_fillers(unsigned start, unsigned num, unsigned step)
+{
+    for (unsigned i = start; i < num; i += step) {
+        gnrc_pktbuf_release(_fillers[i]);
+    }
+}
+
+static gnrc_pktsnip_t *_add_pattern(size_t size)
+{
+    gnrc_pktsnip_t *pkt = gnrc_pktbuf_add(NULL, NULL, size, GNRC_NETTYPE_TEST);
+
+    if (pkt != NULL) {
+        for (unsigned i = 0; i < size; i++) {
+            ((uint8_t *)pkt->data)[i] = (uint8_t)i;
+        }
+    }
+    return pkt;
+}
+
+static bool _has_pattern(const void *data, size_t size, unsigned offset)
+{
+    for (unsigned i = 0; i < size; i++) {
+        if (((uint8_t *)data)[i] != (uint8_t)(offset + i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_pktbuf_sizeclass__merge_buddies(void)
+{
+    unsigned num = _fill();
+
+    TEST_ASSERT(num > 2);
+    /* holding every second packet leaves no big chunk */
+    _release_fillers(0, num, 2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT_NULL(gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SIZE / 2,
+                                     GNRC_NETTYPE_TEST));
+    /* the freed buddies are merged to the initial chunks again */
+    _release_fillers(1, num, 2);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+    TEST_ASSERT_NOT_NULL(gnrc_pktbuf_add(NULL, NULL, GNRC_PKTBUF_SIZE / 2,
+                                         GNRC_NETTYPE_TEST));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+}
+
+static void test_pktbuf_sizeclass__realloc_data__shrink_in_place(void)
+{
+    gnrc_pktsnip_t *pkt = _add_pattern(4 * BLOCK_SIZE);
+    void *data;
+    unsigned num;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    num = _fill();
+    _release_fillers(0, num, 1);
+
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(pkt, 2 * BLOCK_SIZE));
+    TEST_ASSERT(data == pkt->data);
+    TEST_ASSERT_EQUAL_INT(2 * BLOCK_SIZE, pkt->size);
+    TEST_ASSERT(_has_pattern(pkt->data, pkt->size, 0));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    /* the surplus buddy of two blocks takes one more packet */
+    TEST_ASSERT_EQUAL_INT(num + 1, _fill());
+    TEST_ASSERT(_has_pattern(pkt->data, pkt->size, 0));
+    _release_fillers(0, num + 1, 1);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass__mark__shared_chunk(void)
+{
+    gnrc_pktsnip_t *pkt = _add_pattern(4 * BLOCK_SIZE);
+    gnrc_pktsnip_t *hdr, *other;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, HDR_SIZE, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT(((uint8_t *)data + HDR_SIZE) == pkt->data);
+    /* dropping the reference of the header keeps the chunk */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 0));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    other = _add_pattern(4 * BLOCK_SIZE);
+    TEST_ASSERT_NOT_NULL(other);
+    TEST_ASSERT(data != other->data);
+    TEST_ASSERT(_has_pattern(pkt->data, pkt->size, HDR_SIZE));
+    gnrc_pktbuf_release(other);
+    /* the chunk is freed with the last reference */
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass__mark__grow_shared_chunk(void)
+{
+    gnrc_pktsnip_t *pkt = _add_pattern(4 * BLOCK_SIZE);
+    gnrc_pktsnip_t *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, HDR_SIZE, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* growing the header in place would overwrite the payload */
+    TEST_ASSERT_EQUAL_INT(0, gnrc_pktbuf_realloc_data(hdr, 2 * HDR_SIZE));
+    TEST_ASSERT(data != hdr->data);
+    TEST_ASSERT(_has_pattern(hdr->data, HDR_SIZE, 0));
+    TEST_ASSERT(_has_pattern(pkt->data, pkt->size, HDR_SIZE));
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static void test_pktbuf_sizeclass__mark__whole_chunk(void)
+{
+    gnrc_pktsnip_t *pkt = _add_pattern(4 * BLOCK_SIZE);
+    gnrc_pktsnip_t *hdr;
+    void *data;
+
+    TEST_ASSERT_NOT_NULL(pkt);
+    data = pkt->data;
+    hdr = gnrc_pktbuf_mark(pkt, pkt->size, GNRC_NETTYPE_TEST);
+    TEST_ASSERT_NOT_NULL(hdr);
+    /* the chunk is handed over, not shared */
+    TEST_ASSERT(data == hdr->data);
+    TEST_ASSERT_NULL(pkt->data);
+    TEST_ASSERT_EQUAL_INT(0, pkt->size);
+    gnrc_pktbuf_release(pkt);
+    TEST_ASSERT(gnrc_pktbuf_is_sane());
+    TEST_ASSERT(gnrc_pktbuf_is_empty());
+}
+
+static Test *tests_pktbuf_sizeclass_tests(void)
+{
+    EMB_UNIT_TESTFIXTURES(fixtures) {
+        new_TestFixture(test_pktbuf_sizeclass__merge_buddies),
+        new_TestFixture(test_pktbuf_sizeclass__realloc_data__shrink_in_place),
+        new_TestFixture(test_pktbuf_sizeclass__mark__shared_chunk),
+        new_TestFixture(test_pktbuf_sizeclass__mark__grow_shared_chunk),
+        new_TestFixture(test_pktbuf_sizeclass__mark__whole_chunk),
+    };
+
+    EMB_UNIT_TESTCALLER(pktbuf_sizeclass_tests, set_up, NULL, fixtures);
+
+    return (Test *)&pktbuf_sizeclass_tests;
+}
+
+void tests_pktbuf_sizeclass(void)
+{
+    TESTS_RUN(tests_pktbuf_tests());
+    TESTS_RUN(tests_pktbuf_sizeclass_tests());
+}
+/** @} */
@@ -0,0 +1,38 @@
+/*
+ * Copyright (C) 2019 Freie Universität Berlin
+ *
+ * This file is subject to the terms and conditions of the GNU Lesser
+ * General Public License v2.1. See the file LICENSE in the top level
+ * directory for more details.
+ */
+
+/**
+ * @addtogroup  unittests
+ * @{
+ *
+ * @file
+ * @brief       Unittests for the ``gnrc_pktbuf_sizeclass`` module
+ *
+ * Runs the test cases of tests-pktbuf and tests of the buddy allocator.
+ *
+ * @author      Fabian Hüßler <fabian.huessler@ovgu.de>
+ */
+#ifndef TESTS_PKTBUF_SIZECLASS_H
+#define TESTS_PKTBUF_SIZECLASS_H
+#include "embUnit/embUnit.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+*  @brief   The entry point of this test suite.
+*/
+void tests_pktbuf_sizeclass(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TESTS_PKTBUF_SIZECLASS_H */
+/** @} */
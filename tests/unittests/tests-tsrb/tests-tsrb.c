@@ -162,6 +162,73 @@ static void test_add(void)
     }
 }
 
+static void test_add_get_wrap(void)
+{
+    for (int i = 0; i < (int)sizeof(_io_buffer); i++) {
+        _io_buffer[i] = TEST_INPUT + i;
+    }
+    /* move the read and write position close to the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_add(&_tsrb, _io_buffer,
+                                                    BUFFER_SIZE - 3));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_drop(&_tsrb, BUFFER_SIZE));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_add(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    memset(_io_buffer, IO_BUFFER_CANARY, sizeof(_io_buffer));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_get(&_tsrb, _io_buffer,
+                                                sizeof(_io_buffer)));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT((uint8_t)(TEST_INPUT + i), _io_buffer[i]);
+    }
+    for (int i = BUFFER_SIZE; i < (int)sizeof(_io_buffer); i++) {
+        TEST_ASSERT_EQUAL_INT(IO_BUFFER_CANARY, _io_buffer[i]);
+    }
+}
+
+static void test_reserve_commit(void)
+{
+    uint8_t *region;
+
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE, tsrb_reserve(&_tsrb, &region));
+    TEST_ASSERT(region == _tsrb_buffer);
+    memset(region, TEST_INPUT, BUFFER_SIZE - 3);
+    tsrb_commit(&_tsrb, BUFFER_SIZE - 3);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - 3, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_drop(&_tsrb, TEST_DROP_NUM));
+    /* only the space up to the end of the buffer is contiguous */
+    TEST_ASSERT_EQUAL_INT(3, tsrb_reserve(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[BUFFER_SIZE - 3]);
+    tsrb_commit(&_tsrb, 3);
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_reserve(&_tsrb, &region));
+    TEST_ASSERT(region == _tsrb_buffer);
+    tsrb_commit(&_tsrb, TEST_DROP_NUM);
+    TEST_ASSERT_EQUAL_INT(1, tsrb_full(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_reserve(&_tsrb, &region));
+}
+
+static void test_peek_region(void)
+{
+    uint8_t *region;
+
+    TEST_ASSERT_EQUAL_INT(0, tsrb_peek_region(&_tsrb, &region));
+    for (int i = 0; i < BUFFER_SIZE; i++) {
+        TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT + i));
+    }
+    TEST_ASSERT_EQUAL_INT(TEST_DROP_NUM, tsrb_drop(&_tsrb, TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(0, tsrb_add_one(&_tsrb, TEST_INPUT));
+    /* the region ends at the end of the buffer */
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_peek_region(&_tsrb, &region));
+    TEST_ASSERT(region == &_tsrb_buffer[TEST_DROP_NUM]);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT + TEST_DROP_NUM, region[0]);
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM + 1, tsrb_avail(&_tsrb));
+    TEST_ASSERT_EQUAL_INT(BUFFER_SIZE - TEST_DROP_NUM,
+                          tsrb_drop(&_tsrb, BUFFER_SIZE - TEST_DROP_NUM));
+    TEST_ASSERT_EQUAL_INT(1, tsrb_peek_region(&_tsrb, &region));
+    TEST_ASSERT(region == _tsrb_buffer);
+    TEST_ASSERT_EQUAL_INT(TEST_INPUT, region[0]);
+}
+
 static Test *tests_tsrb_tests(void)
 {
     EMB_UNIT_TESTFIXTURES(fixtures) {
@@ -174,6 +241,9 @@ static Test *tests_tsrb_tests(void)
         new_TestFixture(test_drop),
         new_TestFixture(test_add_one),
         new_TestFixture(test_add),
+        new_TestFixture(test_add_get_wrap),
+        new_TestFixture(test_reserve_commit),
+        new_TestFixture(test_peek_region),
     };
 
     EMB_UNIT_TESTCALLER(tsrb_tests, NULL, tear_down, fixtures);